@@ -153,6 +153,13 @@ u64 SignedBigInteger::to_u64() const
     return mp_get_u64(&m_mp);
 }
 
+Optional<i64> SignedBigInteger::to_i64_if_representable() const
+{
+    if (mp_count_bits(&m_mp) > 63)
+        return {};
+    return mp_get_i64(&m_mp);
+}
+
 double SignedBigInteger::to_double(UnsignedBigInteger::RoundingMode rounding_mode) const
 {
     int sign = mp_isneg(&m_mp) ? -1 : 1;
@@ -46,6 +46,8 @@ public:
 
     [[nodiscard]] i64 to_i64() const;
     [[nodiscard]] u64 to_u64() const;
+    // Returns the value if its magnitude fits in 63 bits, i.e. without truncation.
+    [[nodiscard]] Optional<i64> to_i64_if_representable() const;
     [[nodiscard]] double to_double(UnsignedBigInteger::RoundingMode rounding_mode = UnsignedBigInteger::RoundingMode::IEEERoundAndTiesToEvenMantissa) const;
 
     [[nodiscard]] UnsignedBigInteger unsigned_value() const;
@@ -12,7 +12,9 @@
 #include <LibDevTools/Actors/ConsoleActor.h>
 #include <LibDevTools/Actors/FrameActor.h>
 #include <LibDevTools/Actors/InspectorActor.h>
+#include <LibDevTools/Actors/MemoryActor.h>
 #include <LibDevTools/Actors/NetworkEventActor.h>
+#include <LibDevTools/Actors/ProfilerActor.h>
 #include <LibDevTools/Actors/StyleSheetsActor.h>
 #include <LibDevTools/Actors/TabActor.h>
 #include <LibDevTools/Actors/ThreadActor.h>
@@ -22,12 +24,12 @@
 
 namespace DevTools {
 
-NonnullRefPtr<FrameActor> FrameActor::create(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab, WeakPtr<CSSPropertiesActor> css_properties, WeakPtr<ConsoleActor> console, WeakPtr<InspectorActor> inspector, WeakPtr<StyleSheetsActor> style_sheets, WeakPtr<ThreadActor> thread, WeakPtr<AccessibilityActor> accessibility)
+NonnullRefPtr<FrameActor> FrameActor::create(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab, WeakPtr<CSSPropertiesActor> css_properties, WeakPtr<ConsoleActor> console, WeakPtr<InspectorActor> inspector, WeakPtr<StyleSheetsActor> style_sheets, WeakPtr<ThreadActor> thread, WeakPtr<AccessibilityActor> accessibility, WeakPtr<ProfilerActor> profiler, WeakPtr<MemoryActor> memory)
 {
-    return adopt_ref(*new FrameActor(devtools, move(name), move(tab), move(css_properties), move(console), move(inspector), move(style_sheets), move(thread), move(accessibility)));
+    return adopt_ref(*new FrameActor(devtools, move(name), move(tab), move(css_properties), move(console), move(inspector), move(style_sheets), move(thread), move(accessibility), move(profiler), move(memory)));
 }
 
-FrameActor::FrameActor(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab, WeakPtr<CSSPropertiesActor> css_properties, WeakPtr<ConsoleActor> console, WeakPtr<InspectorActor> inspector, WeakPtr<StyleSheetsActor> style_sheets, WeakPtr<ThreadActor> thread, WeakPtr<AccessibilityActor> accessibility)
+FrameActor::FrameActor(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab, WeakPtr<CSSPropertiesActor> css_properties, WeakPtr<ConsoleActor> console, WeakPtr<InspectorActor> inspector, WeakPtr<StyleSheetsActor> style_sheets, WeakPtr<ThreadActor> thread, WeakPtr<AccessibilityActor> accessibility, WeakPtr<ProfilerActor> profiler, WeakPtr<MemoryActor> memory)
     : Actor(devtools, move(name))
     , m_tab(move(tab))
     , m_css_properties(move(css_properties))
@@ -36,6 +38,8 @@ FrameActor::FrameActor(DevToolsServer& devtools, String name, WeakPtr<TabActor>
     , m_style_sheets(move(style_sheets))
     , m_thread(move(thread))
     , m_accessibility(move(accessibility))
+    , m_profiler(move(profiler))
+    , m_memory(move(memory))
 {
     if (auto tab = m_tab.strong_ref()) {
         // NB: We must notify WebContent that DevTools is connected before setting up listeners,
@@ -166,6 +170,10 @@ JsonObject FrameActor::serialize_target() const
         target.set("cssPropertiesActor"sv, css_properties->name());
     if (auto inspector = m_inspector.strong_ref())
         target.set("inspectorActor"sv, inspector->name());
+    if (auto memory = m_memory.strong_ref())
+        target.set("memoryActor"sv, memory->name());
+    if (auto profiler = m_profiler.strong_ref())
+        target.set("profilerActor"sv, profiler->name());
     if (auto style_sheets = m_style_sheets.strong_ref())
         target.set("styleSheetsActor"sv, style_sheets->name());
     if (auto thread = m_thread.strong_ref())
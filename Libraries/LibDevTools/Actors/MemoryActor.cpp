@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <LibDevTools/Actors/MemoryActor.h>
+#include <LibDevTools/Actors/TabActor.h>
+#include <LibDevTools/DevToolsDelegate.h>
+#include <LibDevTools/DevToolsServer.h>
+
+namespace DevTools {
+
+NonnullRefPtr<MemoryActor> MemoryActor::create(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+{
+    return adopt_ref(*new MemoryActor(devtools, move(name), move(tab)));
+}
+
+MemoryActor::MemoryActor(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+    : Actor(devtools, move(name))
+    , m_tab(move(tab))
+{
+}
+
+MemoryActor::~MemoryActor() = default;
+
+void MemoryActor::handle_message(Message const& message)
+{
+    JsonObject response;
+
+    if (message.type == "attach"sv || message.type == "detach"sv) {
+        m_is_attached = message.type == "attach"sv;
+        response.set("type"sv, m_is_attached ? "attached"sv : "detached"sv);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "getState"sv) {
+        response.set("state"sv, m_is_attached ? "attached"sv : "detached"sv);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "saveHeapSnapshot"sv) {
+        auto tab = m_tab.strong_ref();
+        if (!tab) {
+            response.set("error"sv, "unknownError"sv);
+            response.set("message"sv, "The tab has been closed"sv);
+            send_response(message, move(response));
+            return;
+        }
+
+        devtools().delegate().take_heap_snapshot(tab->description(),
+            [weak_self = make_weak_ptr<MemoryActor>(), message_id = message.id](ErrorOr<LexicalPath, String> result) {
+                auto self = weak_self.strong_ref();
+                if (!self)
+                    return;
+
+                JsonObject response;
+
+                // https://firefox-source-docs.mozilla.org/devtools/backend/protocol.html#error-packets
+                if (result.is_error()) {
+                    response.set("error"sv, "unknownError"sv);
+                    response.set("message"sv, result.release_error());
+                } else {
+                    response.set("snapshotId"sv, MUST(String::from_byte_string(result.value().string())));
+                }
+
+                self->send_response({ .id = message_id }, move(response));
+            });
+
+        return;
+    }
+
+    send_unrecognized_packet_type_error(message);
+}
+
+}
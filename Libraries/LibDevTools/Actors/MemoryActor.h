@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <LibDevTools/Actor.h>
+#include <LibDevTools/Forward.h>
+
+namespace DevTools {
+
+// Takes heap snapshots of the tab's JavaScript VM. Snapshots are written in the V8 .heapsnapshot format, and the
+// snapshot ID we hand back is the path of the file they were written to.
+class DEVTOOLS_API MemoryActor final : public Actor {
+public:
+    static constexpr auto base_name = "memory"sv;
+
+    static NonnullRefPtr<MemoryActor> create(DevToolsServer&, String name, WeakPtr<TabActor>);
+    virtual ~MemoryActor() override;
+
+private:
+    MemoryActor(DevToolsServer&, String name, WeakPtr<TabActor>);
+
+    virtual void handle_message(Message const&) override;
+
+    WeakPtr<TabActor> m_tab;
+    bool m_is_attached { false };
+};
+
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <LibDevTools/Actors/ProfilerActor.h>
+#include <LibDevTools/Actors/TabActor.h>
+#include <LibDevTools/DevToolsDelegate.h>
+#include <LibDevTools/DevToolsServer.h>
+
+namespace DevTools {
+
+NonnullRefPtr<ProfilerActor> ProfilerActor::create(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+{
+    return adopt_ref(*new ProfilerActor(devtools, move(name), move(tab)));
+}
+
+ProfilerActor::ProfilerActor(DevToolsServer& devtools, String name, WeakPtr<TabActor> tab)
+    : Actor(devtools, move(name))
+    , m_tab(move(tab))
+{
+}
+
+ProfilerActor::~ProfilerActor()
+{
+    if (!m_is_active)
+        return;
+
+    if (auto tab = m_tab.strong_ref())
+        devtools().delegate().stop_javascript_profiler(tab->description(), [](auto) { });
+}
+
+void ProfilerActor::handle_message(Message const& message)
+{
+    JsonObject response;
+
+    if (message.type == "isActive"sv) {
+        response.set("isActive"sv, m_is_active);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "startProfiler"sv) {
+        if (auto tab = m_tab.strong_ref(); tab && !m_is_active) {
+            devtools().delegate().start_javascript_profiler(tab->description());
+            m_is_active = true;
+        }
+
+        response.set("isActive"sv, m_is_active);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "getProfileAndStopProfiler"sv || message.type == "stopProfilerAndDiscardProfile"sv) {
+        auto tab = m_tab.strong_ref();
+        if (!tab || !m_is_active) {
+            send_response(message, move(response));
+            return;
+        }
+
+        m_is_active = false;
+
+        if (message.type == "stopProfilerAndDiscardProfile"sv) {
+            devtools().delegate().stop_javascript_profiler(tab->description(), [](auto) { });
+            send_response(message, move(response));
+            return;
+        }
+
+        devtools().delegate().stop_javascript_profiler(tab->description(),
+            async_handler(message, [](auto&, JsonValue profile, JsonObject& response) {
+                response.set("profile"sv, move(profile));
+            }));
+
+        return;
+    }
+
+    send_unrecognized_packet_type_error(message);
+}
+
+}
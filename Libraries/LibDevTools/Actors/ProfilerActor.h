@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <LibDevTools/Actor.h>
+#include <LibDevTools/Forward.h>
+
+namespace DevTools {
+
+// Drives the sampling profiler of the tab's JavaScript VM. The recorded profile is returned in the .cpuprofile format.
+class DEVTOOLS_API ProfilerActor final : public Actor {
+public:
+    static constexpr auto base_name = "profiler"sv;
+
+    static NonnullRefPtr<ProfilerActor> create(DevToolsServer&, String name, WeakPtr<TabActor>);
+    virtual ~ProfilerActor() override;
+
+private:
+    ProfilerActor(DevToolsServer&, String name, WeakPtr<TabActor>);
+
+    virtual void handle_message(Message const&) override;
+
+    WeakPtr<TabActor> m_tab;
+    bool m_is_active { false };
+};
+
+}
@@ -12,7 +12,9 @@
 #include <LibDevTools/Actors/ConsoleActor.h>
 #include <LibDevTools/Actors/FrameActor.h>
 #include <LibDevTools/Actors/InspectorActor.h>
+#include <LibDevTools/Actors/MemoryActor.h>
 #include <LibDevTools/Actors/NetworkParentActor.h>
+#include <LibDevTools/Actors/ProfilerActor.h>
 #include <LibDevTools/Actors/StyleSheetsActor.h>
 #include <LibDevTools/Actors/TabActor.h>
 #include <LibDevTools/Actors/TargetConfigurationActor.h>
@@ -106,8 +108,10 @@ void WatcherActor::handle_message(Message const& message)
             auto& style_sheets = devtools().register_actor<StyleSheetsActor>(m_tab);
             auto& thread = devtools().register_actor<ThreadActor>();
             auto& accessibility = devtools().register_actor<AccessibilityActor>(m_tab);
+            auto& profiler = devtools().register_actor<ProfilerActor>(m_tab);
+            auto& memory = devtools().register_actor<MemoryActor>(m_tab);
 
-            auto& target = devtools().register_actor<FrameActor>(m_tab, css_properties, console, inspector, style_sheets, thread, accessibility);
+            auto& target = devtools().register_actor<FrameActor>(m_tab, css_properties, console, inspector, style_sheets, thread, accessibility, profiler, memory);
             m_target = target;
 
             response.set("type"sv, "target-available-form"sv);
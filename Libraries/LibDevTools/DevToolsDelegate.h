@@ -9,6 +9,7 @@
 #include <AK/Error.h>
 #include <AK/Function.h>
 #include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
 #include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibDevTools/Actors/CSSPropertiesActor.h>
@@ -80,6 +81,14 @@ public:
     virtual void listen_for_console_messages(TabDescription const&, OnConsoleMessage) const { }
     virtual void stop_listening_for_console_messages(TabDescription const&) const { }
 
+    using OnJavaScriptProfileReceived = Function<void(ErrorOr<JsonValue>)>;
+    virtual void start_javascript_profiler(TabDescription const&) const { }
+    virtual void stop_javascript_profiler(TabDescription const&, OnJavaScriptProfileReceived) const { }
+
+    // Carries the path of the written snapshot, or the reason WebContent gave for not writing it.
+    using OnHeapSnapshotTaken = Function<void(ErrorOr<LexicalPath, String>)>;
+    virtual void take_heap_snapshot(TabDescription const&, OnHeapSnapshotTaken) const { }
+
     struct NetworkRequestData {
         u64 request_id { 0 };
         String url;
@@ -24,6 +24,7 @@ class FrameActor;
 class HighlighterActor;
 class InspectorActor;
 class LayoutInspectorActor;
+class MemoryActor;
 class NetworkEventActor;
 class NetworkParentActor;
 class NodeActor;
@@ -31,6 +32,7 @@ class PageStyleActor;
 class ParentAccessibilityActor;
 class PreferenceActor;
 class ProcessActor;
+class ProfilerActor;
 class RootActor;
 class StyleSheetsActor;
 class TabActor;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Format.h>
 #include <AK/Forward.h>
 #include <AK/HashMap.h>
@@ -50,11 +51,28 @@ public:
     static constexpr bool OVERRIDES_MUST_SURVIVE_GARBAGE_COLLECTION = false;
     static constexpr bool OVERRIDES_FINALIZE = false;
 
+    // Set this for cell types whose destructor only releases memory the cell owns outright (no non-atomic reference
+    // counts, no other cells or global state) and that report no external memory. Dead cells of such types can be
+    // swept on the background sweeper thread, unless the type also overrides finalize() or
+    // must_survive_garbage_collection(). Note that fly strings and the global tables some destructors update (e.g. the
+    // intrinsic accessor table of JS::Object) are not thread-safe, which rules out most objects, strings and
+    // environments.
+    static constexpr bool CAN_BE_SWEPT_CONCURRENTLY = false;
+
     virtual ~Cell() = default;
 
     bool is_marked() const { return m_mark; }
     void set_marked(bool b) { m_mark = b; }
 
+    // Sets the mark bit atomically, for use while several threads are marking at once. Returns true if this call
+    // marked the cell, i.e. the caller is now responsible for visiting its edges.
+    ALWAYS_INLINE bool try_set_marked()
+    {
+        if (AK::atomic_load(&m_mark, AK::MemoryOrder::memory_order_relaxed))
+            return false;
+        return !AK::atomic_exchange(&m_mark, true, AK::MemoryOrder::memory_order_relaxed);
+    }
+
     enum class State : bool {
         Live,
         Dead,
@@ -67,6 +85,27 @@ public:
 
     class GC_API Visitor {
     public:
+        // How heap snapshots label an edge. Edges visited through plain visit() calls are elements.
+        enum class EdgeType : u8 {
+            Element,
+            Property,
+            Internal,
+        };
+
+        // Visits an edge that tools presenting the heap, such as heap snapshots, can show by name. Marking ignores the
+        // name. Names that take work to build should only be built when wants_edge_names() is true.
+        template<typename T>
+        void visit_named(EdgeType type, StringView name, T const& edge)
+        {
+            m_edge_type = type;
+            m_edge_name = name;
+            visit(edge);
+            m_edge_type = EdgeType::Element;
+            m_edge_name = {};
+        }
+
+        bool wants_edge_names() const { return m_wants_edge_names; }
+
         void visit(Cell* cell)
         {
             if (cell)
@@ -217,6 +256,16 @@ public:
         virtual void visit_impl(Cell&) = 0;
         virtual void visit_impl(ReadonlySpan<NanBoxedValue>) = 0;
         virtual ~Visitor() = default;
+
+        // The type and name of the edge being visited, if visit_named() is visiting it.
+        EdgeType edge_type() const { return m_edge_type; }
+        StringView edge_name() const { return m_edge_name; }
+
+        bool m_wants_edge_names { false };
+
+    private:
+        EdgeType m_edge_type { EdgeType::Element };
+        StringView m_edge_name;
     };
 
     MUST_UPCALL virtual void visit_edges(Visitor&) { }
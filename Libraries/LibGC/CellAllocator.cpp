@@ -12,11 +12,12 @@
 
 namespace GC {
 
-CellAllocator::CellAllocator(size_t cell_size, Optional<StringView> class_name, bool overrides_must_survive_garbage_collection, bool overrides_finalize)
+CellAllocator::CellAllocator(size_t cell_size, Optional<StringView> class_name, bool overrides_must_survive_garbage_collection, bool overrides_finalize, bool can_be_swept_concurrently)
     : m_class_name(class_name)
     , m_cell_size(cell_size)
     , m_overrides_must_survive_garbage_collection(overrides_must_survive_garbage_collection)
     , m_overrides_finalize(overrides_finalize)
+    , m_can_be_swept_concurrently(can_be_swept_concurrently)
 {
 }
 
@@ -26,6 +27,8 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
         heap.register_cell_allocator({}, *this);
 
     if (m_usable_blocks.is_empty() && heap.is_incremental_sweep_active() && !heap.is_gc_deferred()) {
+        // Blocks the background sweeper has finished with may have made room.
+        heap.adopt_concurrently_swept_blocks();
         // Sweep our own pending blocks first to try to find free cells
         // before allocating a new block.
         while (!m_usable_blocks.is_empty() || !m_blocks_pending_sweep.is_empty()) {
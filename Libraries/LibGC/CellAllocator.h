@@ -18,13 +18,13 @@
     static GC::TypeIsolatingCellAllocator<ClassName> cell_allocator
 
 #define GC_DEFINE_ALLOCATOR(ClassName) \
-    GC::TypeIsolatingCellAllocator<ClassName> ClassName::cell_allocator { #ClassName##sv, ClassName::OVERRIDES_MUST_SURVIVE_GARBAGE_COLLECTION, ClassName::OVERRIDES_FINALIZE }
+    GC::TypeIsolatingCellAllocator<ClassName> ClassName::cell_allocator { #ClassName##sv, ClassName::OVERRIDES_MUST_SURVIVE_GARBAGE_COLLECTION, ClassName::OVERRIDES_FINALIZE, ClassName::CAN_BE_SWEPT_CONCURRENTLY }
 
 namespace GC {
 
 class GC_API CellAllocator {
 public:
-    CellAllocator(size_t cell_size, Optional<StringView> = {}, bool overrides_must_survive_garbage_collection = false, bool overrides_finalize = false);
+    CellAllocator(size_t cell_size, Optional<StringView> = {}, bool overrides_must_survive_garbage_collection = false, bool overrides_finalize = false, bool can_be_swept_concurrently = false);
     ~CellAllocator() = default;
 
     Optional<StringView> class_name() const { return m_class_name; }
@@ -32,6 +32,7 @@ public:
 
     Cell* allocate_cell(Heap&);
 
+    // Also visits blocks the background sweeper is still working on; see HeapBlock::is_being_swept_concurrently().
     template<typename Callback>
     IterationDecision for_each_block(Callback callback)
     {
@@ -43,6 +44,10 @@ public:
             if (callback(block) == IterationDecision::Break)
                 return IterationDecision::Break;
         }
+        for (auto& block : m_blocks_in_concurrent_sweep) {
+            if (callback(block) == IterationDecision::Break)
+                return IterationDecision::Break;
+        }
         return IterationDecision::Continue;
     }
 
@@ -51,6 +56,9 @@ public:
 
     bool has_blocks_pending_sweep() const { return !m_blocks_pending_sweep.is_empty(); }
 
+    // Whether this allocator's blocks can be handed to the background sweeper thread. See Cell::CAN_BE_SWEPT_CONCURRENTLY.
+    bool can_be_swept_concurrently() const { return m_can_be_swept_concurrently && !m_overrides_must_survive_garbage_collection && !m_overrides_finalize; }
+
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
 
@@ -73,11 +81,14 @@ private:
     using SweepBlockList = IntrusiveList<&HeapBlock::m_sweep_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
+    // Handed to the background sweeper. Kept here rather than on the other lists so that nothing allocates from them.
+    BlockList m_blocks_in_concurrent_sweep;
     SweepBlockList m_blocks_pending_sweep;
     FlatPtr m_min_block_address { explode_byte(0xff) };
     FlatPtr m_max_block_address { 0 };
     bool m_overrides_must_survive_garbage_collection { false };
     bool m_overrides_finalize { false };
+    bool m_can_be_swept_concurrently { false };
 };
 
 template<typename T>
@@ -85,8 +96,8 @@ class GC_API TypeIsolatingCellAllocator {
 public:
     using CellType = T;
 
-    TypeIsolatingCellAllocator(StringView class_name, bool overrides_must_survive_garbage_collection, bool overrides_finalize)
-        : allocator(sizeof(T), class_name, overrides_must_survive_garbage_collection, overrides_finalize)
+    TypeIsolatingCellAllocator(StringView class_name, bool overrides_must_survive_garbage_collection, bool overrides_finalize, bool can_be_swept_concurrently)
+        : allocator(sizeof(T), class_name, overrides_must_survive_garbage_collection, overrides_finalize, can_be_swept_concurrently)
     {
     }
 
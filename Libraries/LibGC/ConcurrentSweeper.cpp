@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/Cell.h>
+#include <LibGC/ConcurrentSweeper.h>
+#include <LibGC/HeapBlock.h>
+#include <LibThreading/Thread.h>
+
+namespace GC {
+
+static void sweep_block(HeapBlock& block)
+{
+    u32 live_cells = 0;
+    block.for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+        if (!cell->is_marked()) {
+            block.deallocate(cell);
+            return;
+        }
+        cell->set_marked(false);
+        ++live_cells;
+    });
+    block.m_concurrently_swept_live_cells = live_cells;
+}
+
+ConcurrentSweeper::ConcurrentSweeper()
+{
+    m_thread = Threading::Thread::construct("GCSweeper"sv, [this] {
+        run();
+        return static_cast<intptr_t>(0);
+    });
+    m_thread->start();
+}
+
+ConcurrentSweeper::~ConcurrentSweeper()
+{
+    {
+        Sync::MutexLocker locker(m_mutex);
+        m_should_exit = true;
+    }
+    m_work_cv.signal();
+    (void)m_thread->join();
+}
+
+void ConcurrentSweeper::sweep(Vector<HeapBlock*>&& blocks)
+{
+    {
+        Sync::MutexLocker locker(m_mutex);
+        m_unswept_block_count += blocks.size();
+        m_pending_blocks.extend(move(blocks));
+    }
+    m_work_cv.signal();
+}
+
+HeapBlock* ConcurrentSweeper::take_swept_blocks()
+{
+    return m_swept_blocks.exchange(nullptr, AK::MemoryOrder::memory_order_acquire);
+}
+
+void ConcurrentSweeper::wait()
+{
+    Sync::MutexLocker locker(m_mutex);
+    while (m_unswept_block_count > 0)
+        m_idle_cv.wait();
+}
+
+void ConcurrentSweeper::run()
+{
+    while (true) {
+        HeapBlock* block = nullptr;
+        {
+            Sync::MutexLocker locker(m_mutex);
+            while (m_pending_blocks.is_empty() && !m_should_exit)
+                m_work_cv.wait();
+            if (m_should_exit)
+                return;
+            block = m_pending_blocks.take_last();
+        }
+
+        sweep_block(*block);
+
+        auto* head = m_swept_blocks.load(AK::MemoryOrder::memory_order_relaxed);
+        do {
+            block->m_next_concurrently_swept_block = head;
+        } while (!m_swept_blocks.compare_exchange_strong(head, block, AK::MemoryOrder::memory_order_release));
+
+        {
+            Sync::MutexLocker locker(m_mutex);
+            --m_unswept_block_count;
+            if (m_unswept_block_count == 0)
+                m_idle_cv.broadcast();
+        }
+    }
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Noncopyable.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibGC/Forward.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+#include <LibThreading/Forward.h>
+
+namespace GC {
+
+// Background thread that sweeps the blocks of cell types whose dead cells can be destroyed off the main thread (see
+// Cell::CAN_BE_SWEPT_CONCURRENTLY). Blocks handed to sweep() belong to the sweeper until they come back out of
+// take_swept_blocks(); the main thread must not allocate from them or look at their dead cells in the meantime.
+class ConcurrentSweeper {
+    AK_MAKE_NONCOPYABLE(ConcurrentSweeper);
+    AK_MAKE_NONMOVABLE(ConcurrentSweeper);
+
+public:
+    ConcurrentSweeper();
+    ~ConcurrentSweeper();
+
+    // Queues blocks for sweeping. Dead cells are freed and survivors are unmarked.
+    void sweep(Vector<HeapBlock*>&&);
+
+    // Returns the blocks swept since the last call, linked through HeapBlock::m_next_concurrently_swept_block, with
+    // HeapBlock::m_concurrently_swept_live_cells set. Never blocks.
+    HeapBlock* take_swept_blocks();
+
+    // Blocks until every block passed to sweep() has been swept.
+    void wait();
+
+private:
+    void run();
+
+    Sync::Mutex m_mutex;
+    Sync::ConditionVariable m_work_cv { m_mutex };
+    Sync::ConditionVariable m_idle_cv { m_mutex };
+    Vector<HeapBlock*> m_pending_blocks;
+    size_t m_unswept_block_count { 0 };
+    bool m_should_exit { false };
+    RefPtr<Threading::Thread> m_thread;
+
+    // Lock-free stack of swept blocks, pushed by the sweeper thread and emptied in one go by the main thread.
+    Atomic<HeapBlock*> m_swept_blocks { nullptr };
+};
+
+}
@@ -7,6 +7,7 @@
 
 #include <AK/Badge.h>
 #include <AK/BinarySearch.h>
+#include <AK/ByteString.h>
 #include <AK/Checked.h>
 #include <AK/Debug.h>
 #include <AK/Function.h>
@@ -17,6 +18,7 @@
 #include <AK/NumberFormat.h>
 #include <AK/Platform.h>
 #include <AK/ScopeGuard.h>
+#include <AK/Stream.h>
 #include <AK/StackInfo.h>
 #include <AK/StackUnwinder.h>
 #include <AK/TemporaryChange.h>
@@ -27,9 +29,11 @@
 #include <LibCore/Timer.h>
 #include <LibGC/BlockAllocator.h>
 #include <LibGC/CellAllocator.h>
+#include <LibGC/ConcurrentSweeper.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
 #include <LibGC/NanBoxedValue.h>
+#include <LibGC/ParallelMarking.h>
 #include <LibGC/Root.h>
 #include <LibGC/Weak.h>
 #include <setjmp.h>
@@ -77,9 +81,24 @@ i32 libgc_log_level()
     return level;
 }
 
+bool concurrent_sweep_enabled_by_default()
+{
+    char const* env = getenv("LIBGC_CONCURRENT_SWEEP");
+    return !env || atoi(env) > 0;
+}
+
+struct MarkingThreadStats {
+    size_t cells_marked { 0 };
+    size_t segments_published { 0 };
+    size_t segments_stolen { 0 };
+    i64 busy_us { 0 };
+};
+
 // Per-phase timings recorded during a single collect_garbage() call. We keep
 // these at file scope (instead of threading more parameters through the GC's
 // internal helpers) since GC is single-threaded, guarded by m_collecting_garbage.
+// Marking helper threads report into their own MarkingThreadStats, which the
+// collecting thread copies in here once they have finished.
 struct PhaseTimings {
     // Top-level phases.
     i64 gather_roots_us { 0 };
@@ -107,6 +126,9 @@ struct PhaseTimings {
     i64 mark_bfs_us { 0 };
     i64 mark_clear_uprooted_us { 0 };
 
+    // Per-thread stats for the BFS marking subphase. Index 0 is the collecting thread, the rest are helpers.
+    Vector<MarkingThreadStats> marking_threads;
+
     // sweep_dead_cells() subphases. Only populated for CollectEverything;
     // normal collections defer sweep to the incremental sweeper.
     i64 sweep_block_iteration_us { 0 };
@@ -136,6 +158,7 @@ struct IncrementalSweepBatchStats {
 struct IncrementalSweepStats {
     bool should_report { false };
     size_t total_blocks { 0 };
+    size_t concurrent_blocks { 0 };
     Vector<IncrementalSweepBatchStats> batches;
     Core::ElapsedTimer timer { Core::TimerType::Precise };
 };
@@ -181,6 +204,11 @@ void print_gc_report(i64 total_us, size_t live_block_count)
     dbgln("    initial visit               {:>10} us ({:>5.1f}%)", t.mark_initial_visit_us, pct(t.mark_initial_visit_us));
     dbgln("    BFS marking                 {:>10} us ({:>5.1f}%)", t.mark_bfs_us, pct(t.mark_bfs_us));
     dbgln("    clear uprooted              {:>10} us ({:>5.1f}%)", t.mark_clear_uprooted_us, pct(t.mark_clear_uprooted_us));
+    for (size_t i = 0; i < t.marking_threads.size(); ++i) {
+        auto const& thread = t.marking_threads[i];
+        dbgln("      thread #{:<2}                {:>10} us ({:>5.1f}%), {} cells, {} segments published, {} stolen",
+            i, thread.busy_us, pct(thread.busy_us), thread.cells_marked, thread.segments_published, thread.segments_stolen);
+    }
     dbgln("  finalize_unmarked_cells       {:>10} us ({:>5.1f}%)", t.finalize_unmarked_cells_us, pct(t.finalize_unmarked_cells_us));
     dbgln("  sweep_weak_blocks             {:>10} us ({:>5.1f}%)", t.sweep_weak_blocks_us, pct(t.sweep_weak_blocks_us));
     dbgln("  prune_weak_containers         {:>10} us ({:>5.1f}%)", t.prune_weak_containers_us, pct(t.prune_weak_containers_us));
@@ -231,6 +259,7 @@ void print_incremental_sweep_report(size_t live_cell_bytes, size_t live_external
     dbgln("       Batch time: {} us", batch_time_us);
     dbgln("          Batches: {}", g_incremental_sweep_stats.batches.size());
     dbgln("    Swept blocks: {} / {} ({})", swept_blocks, g_incremental_sweep_stats.total_blocks, human_readable_size(swept_blocks * HeapBlock::BLOCK_SIZE));
+    dbgln(" Swept in background: {} / {}", g_incremental_sweep_stats.concurrent_blocks, g_incremental_sweep_stats.total_blocks);
     dbgln("     Live cells: {}", human_readable_size(live_cell_bytes));
     dbgln("  Live external: {}", human_readable_size(live_external_bytes));
     dbgln("  Next threshold: {}", human_readable_size(next_gc_bytes_threshold));
@@ -283,6 +312,7 @@ Heap::Heap(AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> gather_embedder_roo
 {
     s_the = this;
     m_gc_bytes_threshold = GC_MIN_BYTES_THRESHOLD;
+    m_concurrent_sweep_enabled = concurrent_sweep_enabled_by_default();
     static_assert(HeapBlock::min_possible_cell_size <= 32, "Heap Cell tracking uses too much data!");
 }
 
@@ -569,6 +599,278 @@ AK::JsonObject Heap::dump_graph()
     return graph;
 }
 
+// Writes the reachable heap in the V8 .heapsnapshot format. The format needs every node's edge count, and the index
+// of every edge's target, before any edge is written, so the graph is walked twice: once to number the cells and count
+// their edges, and once more to write out the edges as they are visited. Per cell, only its node index and edge count
+// are kept in memory. Edges that visit_edges() names through visit_named() become property or internal edges, and the
+// rest are numbered elements.
+class HeapSnapshotWriter final : public Cell::Visitor {
+public:
+    HeapSnapshotWriter(Heap& heap, Stream& stream, HashMap<Cell*, HeapRoot> const& roots)
+        : m_heap(heap)
+        , m_stream(stream)
+    {
+        m_wants_edge_names = true;
+        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
+
+        // Node 0 is the synthetic root that DevTools measures retaining paths from. Below it sits one synthetic node
+        // per kind of heap root, so leaks can be traced back to what is holding on to them.
+        m_nodes.append({ .name = string_index("(GC roots)"sv) });
+        for (auto& [root, root_origin] : roots) {
+            auto category_name = root_type_name(root_origin.type);
+            auto category = m_root_categories.find_first_index_if([&](auto const& category) { return category.name == category_name; });
+            if (!category.has_value()) {
+                m_nodes.append({ .name = string_index(category_name) });
+                m_root_categories.append({ .name = category_name, .node_index = static_cast<u32>(m_nodes.size() - 1) });
+                category = m_root_categories.size() - 1;
+            }
+            m_root_categories[*category].roots.append(root);
+        }
+        m_nodes[0].edge_count = m_root_categories.size();
+        for (auto& category : m_root_categories) {
+            m_nodes[category.node_index].edge_count = category.roots.size();
+            for (auto* root : category.roots)
+                ensure_node(*root);
+        }
+    }
+
+    ErrorOr<void> write()
+    {
+        discover_nodes();
+
+        size_t edge_count = 0;
+        for (auto const& node : m_nodes)
+            edge_count += node.edge_count;
+
+        m_builder.append("{\"snapshot\":{\"meta\":{"sv);
+        m_builder.append("\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\",\"detachedness\"],"sv);
+        m_builder.append("\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",\"number\",\"native\",\"synthetic\",\"concatenated string\",\"sliced string\",\"symbol\",\"bigint\",\"object shape\"],\"string\",\"number\",\"number\",\"number\",\"number\",\"number\"],"sv);
+        m_builder.append("\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"sv);
+        m_builder.append("\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",\"weak\"],\"string_or_number\",\"node\"],"sv);
+        m_builder.append("\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",\"line\",\"column\"],"sv);
+        m_builder.append("\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],"sv);
+        m_builder.append("\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],"sv);
+        m_builder.append("\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},"sv);
+        m_builder.appendff("\"node_count\":{},\"edge_count\":{},\"trace_function_count\":0}},\n", m_nodes.size(), edge_count);
+
+        m_builder.append("\"nodes\":["sv);
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            auto const& node = m_nodes[i];
+            auto type = node.cell ? NODE_TYPE_OBJECT : NODE_TYPE_SYNTHETIC;
+            size_t self_size = 0;
+            if (node.cell)
+                self_size = HeapBlock::from_cell(node.cell)->cell_size() + node.cell->external_memory_size();
+            // Object ids are odd in V8 snapshots; DevTools doesn't care, but other tools might.
+            m_builder.appendff("{}{},{},{},{},{},0,0\n", i == 0 ? ""sv : ","sv, type, node.name, i * 2 + 1, self_size, node.edge_count);
+            TRY(flush_if_needed());
+        }
+        m_builder.append("],\n\"edges\":["sv);
+
+        m_writing_edges = true;
+        for (auto const& category : m_root_categories)
+            append_edge(category.node_index);
+        for (auto const& category : m_root_categories) {
+            m_edge_ordinal = 0;
+            for (auto* root : category.roots)
+                append_edge(m_node_indices.get(root).value());
+            TRY(flush_if_needed());
+        }
+        for (auto& node : m_nodes) {
+            if (!node.cell)
+                continue;
+            m_edge_ordinal = 0;
+            node.cell->visit_edges(*this);
+            TRY(flush_if_needed());
+        }
+        m_builder.append("],\n"sv);
+
+        m_builder.append("\"trace_function_infos\":[],\"trace_tree\":[],\"samples\":[],\"locations\":[],\n\"strings\":["sv);
+        for (size_t i = 0; i < m_strings.size(); ++i) {
+            if (i > 0)
+                m_builder.append(',');
+            m_builder.append('"');
+            m_builder.append_escaped_for_json(m_strings[i]);
+            m_builder.append('"');
+        }
+        m_builder.append("]}\n"sv);
+
+        return flush();
+    }
+
+    virtual void visit_impl(Cell& cell) override
+    {
+        if (m_writing_edges) {
+            auto to_node_index = m_node_indices.get(&cell).value();
+            if (edge_name().is_empty())
+                append_edge(to_node_index);
+            else
+                append_named_edge(edge_type(), edge_name(), to_node_index);
+            return;
+        }
+        ++m_nodes[m_node_being_visited].edge_count;
+        ensure_node(cell);
+    }
+
+    virtual void visit_impl(ReadonlySpan<NanBoxedValue> values) override
+    {
+        for (auto const& value : values)
+            visit(value);
+    }
+
+    virtual void visit_possible_values(ReadonlyBytes bytes) override
+    {
+        HashMap<FlatPtr, HeapRoot> possible_pointers;
+
+        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
+            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
+
+        for_each_cell_among_possible_pointers(m_heap.m_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+            if (cell->state() == Cell::State::Live)
+                visit_impl(*cell);
+        });
+    }
+
+private:
+    static constexpr u32 NODE_FIELD_COUNT = 7;
+    static constexpr u32 NODE_TYPE_OBJECT = 3;
+    static constexpr u32 NODE_TYPE_SYNTHETIC = 9;
+    static constexpr u32 EDGE_TYPE_ELEMENT = 1;
+    static constexpr u32 EDGE_TYPE_PROPERTY = 2;
+    static constexpr u32 EDGE_TYPE_INTERNAL = 3;
+    static constexpr size_t FLUSH_THRESHOLD = 64 * KiB;
+
+    struct Node {
+        Cell* cell { nullptr };
+        u32 name { 0 };
+        u32 edge_count { 0 };
+    };
+
+    struct RootCategory {
+        StringView name;
+        u32 node_index { 0 };
+        Vector<Cell*> roots;
+    };
+
+    static StringView root_type_name(HeapRoot::Type type)
+    {
+        switch (type) {
+        case HeapRoot::Type::ConservativeHashMap:
+            return "(ConservativeHashMap roots)"sv;
+        case HeapRoot::Type::ConservativeVector:
+            return "(ConservativeVector roots)"sv;
+        case HeapRoot::Type::HeapFunctionCapturedPointer:
+            return "(HeapFunction captures)"sv;
+        case HeapRoot::Type::MustSurviveGC:
+            return "(Must survive GC)"sv;
+        case HeapRoot::Type::Root:
+            return "(Root handles)"sv;
+        case HeapRoot::Type::RootVector:
+            return "(RootVector roots)"sv;
+        case HeapRoot::Type::RootHashMap:
+            return "(RootHashMap roots)"sv;
+        case HeapRoot::Type::RootHashTable:
+            return "(RootHashTable roots)"sv;
+        case HeapRoot::Type::RegisterPointer:
+            return "(Register roots)"sv;
+        case HeapRoot::Type::StackPointer:
+            return "(Stack roots)"sv;
+        case HeapRoot::Type::VM:
+            return "(VM roots)"sv;
+        }
+        VERIFY_NOT_REACHED();
+    }
+
+    // Edge names are usually built on the fly, so the string table keeps its own copies.
+    u32 string_index(StringView string)
+    {
+        if (auto it = m_string_indices.find(string); it != m_string_indices.end())
+            return it->value;
+        auto index = static_cast<u32>(m_strings.size());
+        ByteString owned_string { string };
+        m_strings.append(owned_string);
+        m_string_indices.set(move(owned_string), index);
+        return index;
+    }
+
+    void ensure_node(Cell& cell)
+    {
+        m_node_indices.ensure(&cell, [&] {
+            m_nodes.append({ .cell = &cell, .name = string_index(cell.class_name()) });
+            m_work_queue.append(&cell);
+            return static_cast<u32>(m_nodes.size() - 1);
+        });
+    }
+
+    void discover_nodes()
+    {
+        while (!m_work_queue.is_empty()) {
+            auto* cell = m_work_queue.take_last();
+            m_node_being_visited = m_node_indices.get(cell).value();
+            cell->visit_edges(*this);
+        }
+    }
+
+    void append_edge(u32 to_node_index)
+    {
+        m_builder.appendff("{}{},{},{}\n", m_first_edge ? ""sv : ","sv, EDGE_TYPE_ELEMENT, m_edge_ordinal++, to_node_index * NODE_FIELD_COUNT);
+        m_first_edge = false;
+    }
+
+    // Named edges refer to their name in the string table instead of carrying an element index.
+    void append_named_edge(EdgeType type, StringView name, u32 to_node_index)
+    {
+        auto edge_type = type == EdgeType::Internal ? EDGE_TYPE_INTERNAL : EDGE_TYPE_PROPERTY;
+        m_builder.appendff("{}{},{},{}\n", m_first_edge ? ""sv : ","sv, edge_type, string_index(name), to_node_index * NODE_FIELD_COUNT);
+        m_first_edge = false;
+    }
+
+    ErrorOr<void> flush_if_needed()
+    {
+        if (m_builder.length() < FLUSH_THRESHOLD)
+            return {};
+        return flush();
+    }
+
+    ErrorOr<void> flush()
+    {
+        TRY(m_stream.write_until_depleted(m_builder.string_view().bytes()));
+        m_builder.clear();
+        return {};
+    }
+
+    Heap& m_heap;
+    Stream& m_stream;
+    StringBuilder m_builder;
+
+    Vector<Node> m_nodes;
+    HashMap<Cell*, u32> m_node_indices;
+    Vector<RootCategory> m_root_categories;
+    Vector<Cell*> m_work_queue;
+    u32 m_node_being_visited { 0 };
+
+    Vector<ByteString> m_strings;
+    HashMap<ByteString, u32> m_string_indices;
+
+    bool m_writing_edges { false };
+    bool m_first_edge { true };
+    u32 m_edge_ordinal { 0 };
+
+    FlatPtr m_min_block_address;
+    FlatPtr m_max_block_address;
+};
+
+ErrorOr<void> Heap::write_heap_snapshot(Stream& stream)
+{
+    // Same as dump_graph(): don't let the conservative scan pick up cells that a pending sweep is about to free.
+    finish_pending_incremental_sweep();
+
+    HashMap<Cell*, HeapRoot> roots;
+    gather_roots(roots);
+    HeapSnapshotWriter writer(*this, stream, roots);
+    return writer.write();
+}
+
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
 {
     VERIFY(!m_collecting_garbage);
@@ -695,12 +997,19 @@ void Heap::dump_allocators()
             size_t total_cells { 0 };
         };
         Vector<BlockStats> blocks;
+        size_t blocks_being_swept = 0;
 
         size_t total_live_cells = 0;
         size_t total_dead_cells = 0;
         size_t cell_count = (HeapBlock::BLOCK_SIZE - sizeof(HeapBlock)) / allocator.cell_size();
 
         allocator.for_each_block([&](HeapBlock& heap_block) {
+            // Its cells are being swept on another thread, so only the block itself can be reported.
+            if (heap_block.is_being_swept_concurrently()) {
+                ++blocks_being_swept;
+                return IterationDecision::Continue;
+            }
+
             BlockStats block { heap_block };
 
             heap_block.for_each_cell([&](Cell* cell) {
@@ -718,10 +1027,10 @@ void Heap::dump_allocators()
             return IterationDecision::Continue;
         });
 
-        if (blocks.is_empty())
+        if (blocks.is_empty() && blocks_being_swept == 0)
             continue;
 
-        total_in_committed_blocks += blocks.size() * HeapBlock::BLOCK_SIZE;
+        total_in_committed_blocks += (blocks.size() + blocks_being_swept) * HeapBlock::BLOCK_SIZE;
 
         StringBuilder builder;
         if (allocator.class_name().has_value())
@@ -731,7 +1040,7 @@ void Heap::dump_allocators()
 
         builder.appendff(" x {}", total_live_cells);
 
-        size_t cost = blocks.size() * HeapBlock::BLOCK_SIZE / KiB;
+        size_t cost = (blocks.size() + blocks_being_swept) * HeapBlock::BLOCK_SIZE / KiB;
         size_t reserved = allocator.block_allocator().block_count() * HeapBlock::BLOCK_SIZE / KiB;
         builder.appendff(", cost: {} KiB, reserved: {} KiB", cost, reserved);
 
@@ -741,6 +1050,9 @@ void Heap::dump_allocators()
             total_waste += total_dead_bytes;
         }
 
+        if (blocks_being_swept)
+            builder.appendff(", {} blocks being swept in background", blocks_being_swept);
+
         dbgln("{}", builder.string_view());
 
         for (auto& block : blocks) {
@@ -990,6 +1302,9 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     }
 }
 
+// Below this many live blocks, waking the helper threads costs more than they save.
+static constexpr size_t PARALLEL_MARKING_MIN_LIVE_BLOCKS = 2048;
+
 class MarkingVisitor final : public Cell::Visitor {
 public:
     explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
@@ -1001,13 +1316,21 @@ public:
         }
     }
 
+    // Visitor for a helper thread joining a parallel mark. It starts out empty and steals work from the pool.
+    MarkingVisitor(Heap& heap, MarkingWorkPool& pool, FlatPtr min_block_address, FlatPtr max_block_address)
+        : m_heap(heap)
+        , m_pool(&pool)
+        , m_min_block_address(min_block_address)
+        , m_max_block_address(max_block_address)
+    {
+    }
+
     virtual void visit_impl(Cell& cell) override
     {
-        if (cell.is_marked())
+        if (!mark(cell))
             return;
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
-        cell.set_marked(true);
         m_work_queue.append(cell);
     }
 
@@ -1019,11 +1342,10 @@ public:
             if (!value.is_cell())
                 continue;
             auto& cell = value.as_cell();
-            if (cell.is_marked())
+            if (!mark(cell))
                 continue;
             dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
-            cell.set_marked(true);
             m_work_queue.unchecked_append(cell);
         }
     }
@@ -1037,29 +1359,142 @@ public:
             add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
 
         for_each_cell_among_possible_pointers(m_heap.m_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (cell->is_marked())
-                return;
             if (cell->state() != Cell::State::Live)
                 return;
-            cell->set_marked(true);
+            if (!mark(*cell))
+                return;
             m_work_queue.append(*cell);
         });
     }
 
+    // Switches this visitor to atomic marking and hands out everything but one segment of its work to the pool,
+    // so that the helper threads have something to start on.
+    void start_parallel_marking(MarkingWorkPool& pool)
+    {
+        m_pool = &pool;
+        while (m_work_queue.size() > MARK_STACK_SEGMENT_SIZE)
+            publish_segment();
+    }
+
     void mark_all_live_cells()
     {
-        while (!m_work_queue.is_empty()) {
-            m_work_queue.take_last()->visit_edges(*this);
+        Core::ElapsedTimer busy_timer { Core::TimerType::Precise };
+        if (g_recording_phase_timings)
+            busy_timer.start();
+
+        i64 idle_us = 0;
+        if (m_pool) {
+            idle_us = mark_all_live_cells_in_parallel();
+        } else {
+            while (!m_work_queue.is_empty()) {
+                m_work_queue.take_last()->visit_edges(*this);
+            }
         }
+
+        if (g_recording_phase_timings)
+            m_stats.busy_us = busy_timer.elapsed_time().to_microseconds() - idle_us;
     }
 
+    MarkingThreadStats const& stats() const { return m_stats; }
+    FlatPtr min_block_address() const { return m_min_block_address; }
+    FlatPtr max_block_address() const { return m_max_block_address; }
+
 private:
+    // Returns the time spent waiting for work, in microseconds.
+    i64 mark_all_live_cells_in_parallel()
+    {
+        Core::ElapsedTimer idle_timer { Core::TimerType::Precise };
+        i64 idle_us = 0;
+
+        while (true) {
+            while (!m_work_queue.is_empty()) {
+                m_work_queue.take_last()->visit_edges(*this);
+                if (m_work_queue.size() >= 2 * MARK_STACK_SEGMENT_SIZE && m_pool->has_idle_participants())
+                    publish_segment();
+            }
+
+            if (g_recording_phase_timings)
+                idle_timer.start();
+            bool stole_segment = m_pool->take_or_wait_for_termination(m_work_queue);
+            if (g_recording_phase_timings)
+                idle_us += idle_timer.elapsed_time().to_microseconds();
+
+            if (!stole_segment)
+                return idle_us;
+            ++m_stats.segments_stolen;
+        }
+    }
+
+    ALWAYS_INLINE bool mark(Cell& cell)
+    {
+        if (m_pool) {
+            if (!cell.try_set_marked())
+                return false;
+        } else {
+            if (cell.is_marked())
+                return false;
+            cell.set_marked(true);
+        }
+        ++m_stats.cells_marked;
+        return true;
+    }
+
+    // Gives away the top of the mark stack. Taking it from the top keeps this proportional to the segment size, where
+    // taking the bottom would shift everything above it down.
+    void publish_segment()
+    {
+        auto segment_start = m_work_queue.size() - MARK_STACK_SEGMENT_SIZE;
+        Vector<Ref<Cell>> segment;
+        segment.ensure_capacity(MARK_STACK_SEGMENT_SIZE);
+        segment.unchecked_append(m_work_queue.data() + segment_start, MARK_STACK_SEGMENT_SIZE);
+        m_work_queue.shrink(segment_start, true);
+        m_pool->publish(move(segment));
+        ++m_stats.segments_published;
+    }
+
     Heap& m_heap;
+    MarkingWorkPool* m_pool { nullptr };
     Vector<Ref<Cell>> m_work_queue;
+    MarkingThreadStats m_stats;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
+// Marks from the collecting thread plus the helper threads, each draining its own mark stack and stealing from the
+// others through a shared segment pool. This relies on visit_edges() only reading the cell it is called on, which
+// holds for every cell type as long as the mutator is stopped.
+bool Heap::mark_live_cells_in_parallel(MarkingVisitor& visitor)
+{
+    // Check the heap size first, so that small heaps never spawn the helper threads.
+    if (m_live_heap_blocks.size() < PARALLEL_MARKING_MIN_LIVE_BLOCKS)
+        return false;
+
+    auto& helpers = MarkingHelperThreads::the();
+    if (helpers.thread_count() == 0)
+        return false;
+
+    MarkingWorkPool pool { helpers.thread_count() + 1 };
+    Vector<MarkingThreadStats> stats;
+    stats.resize(helpers.thread_count() + 1);
+
+    Function<void(size_t)> job = [&](size_t helper_index) {
+        MarkingVisitor helper_visitor { *this, pool, visitor.min_block_address(), visitor.max_block_address() };
+        helper_visitor.mark_all_live_cells();
+        stats[helper_index + 1] = helper_visitor.stats();
+    };
+    if (!helpers.start(job))
+        return false;
+
+    visitor.start_parallel_marking(pool);
+    visitor.mark_all_live_cells();
+    helpers.wait();
+
+    stats[0] = visitor.stats();
+    if (g_recording_phase_timings)
+        g_phase_timings.marking_threads = move(stats);
+    return true;
+}
+
 void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
@@ -1072,7 +1507,11 @@ void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
 
     {
         ScopedPhaseTimer timer { g_recording_phase_timings, g_phase_timings.mark_bfs_us };
-        visitor->mark_all_live_cells();
+        if (!mark_live_cells_in_parallel(*visitor)) {
+            visitor->mark_all_live_cells();
+            if (g_recording_phase_timings)
+                g_phase_timings.marking_threads.append(visitor->stats());
+        }
     }
 
     {
@@ -1272,6 +1711,7 @@ void Heap::start_incremental_sweep()
     m_sweep_live_external_bytes = 0;
     g_incremental_sweep_stats.should_report = false;
     g_incremental_sweep_stats.total_blocks = 0;
+    g_incremental_sweep_stats.concurrent_blocks = 0;
     g_incremental_sweep_stats.batches.clear();
     g_incremental_sweep_stats.should_report = g_next_incremental_sweep_should_report;
     g_next_incremental_sweep_should_report = false;
@@ -1280,11 +1720,18 @@ void Heap::start_incremental_sweep()
 
     // Populate each allocator's pending sweep list with its current blocks.
     // Blocks allocated during incremental sweep won't be on these lists
-    // and don't need sweeping.
+    // and don't need sweeping. Blocks whose dead cells can be destroyed
+    // off the main thread go to the background sweeper instead.
     size_t total_blocks = 0;
+    Vector<HeapBlock*> concurrent_blocks;
     for (auto& allocator : m_all_cell_allocators) {
+        bool sweep_concurrently = m_concurrent_sweep_enabled && allocator.can_be_swept_concurrently();
         allocator.for_each_block([&](HeapBlock& block) {
-            allocator.m_blocks_pending_sweep.append(block);
+            VERIFY(!block.is_being_swept_concurrently());
+            if (sweep_concurrently)
+                concurrent_blocks.append(&block);
+            else
+                allocator.m_blocks_pending_sweep.append(block);
             ++total_blocks;
             return IterationDecision::Continue;
         });
@@ -1292,14 +1739,65 @@ void Heap::start_incremental_sweep()
             m_allocators_to_sweep.append(allocator);
     }
     g_incremental_sweep_stats.total_blocks = total_blocks;
+    g_incremental_sweep_stats.concurrent_blocks = concurrent_blocks.size();
+
+    if (!concurrent_blocks.is_empty()) {
+        // Park the blocks on their allocators' in-flight lists so nothing gets allocated
+        // from them until adopt_concurrently_swept_blocks() puts them back.
+        for (auto* block : concurrent_blocks) {
+            block->m_being_swept_concurrently = true;
+            block->cell_allocator().m_blocks_in_concurrent_sweep.append(*block);
+        }
+        if (!m_concurrent_sweeper)
+            m_concurrent_sweeper = make<ConcurrentSweeper>();
+        m_blocks_in_concurrent_sweep = concurrent_blocks.size();
+        m_concurrent_sweeper->sweep(move(concurrent_blocks));
+    }
 
-    dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] {} blocks to sweep", total_blocks);
+    dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] {} blocks to sweep ({} in background)", total_blocks, g_incremental_sweep_stats.concurrent_blocks);
 
     start_incremental_sweep_timer();
 }
 
+void Heap::adopt_concurrently_swept_blocks()
+{
+    if (m_blocks_in_concurrent_sweep == 0)
+        return;
+
+    auto* block = m_concurrent_sweeper->take_swept_blocks();
+    while (block) {
+        auto* next = exchange(block->m_next_concurrently_swept_block, nullptr);
+        VERIFY(m_blocks_in_concurrent_sweep > 0);
+        --m_blocks_in_concurrent_sweep;
+
+        // Concurrently swept cell types report no external memory, so the live cells are all there is to count.
+        auto live_cells = block->m_concurrently_swept_live_cells;
+        m_sweep_live_cell_bytes += live_cells * block->cell_size();
+
+        auto& allocator = block->cell_allocator();
+        block->m_being_swept_concurrently = false;
+        if (live_cells == 0) {
+            dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] Block @ {} freed in background", block);
+            allocator.m_usable_blocks.append(*block);
+            allocator.block_did_become_empty({}, *block);
+        } else if (block->is_full()) {
+            allocator.m_full_blocks.append(*block);
+        } else {
+            allocator.block_did_become_usable({}, *block);
+        }
+        block = next;
+    }
+}
+
 void Heap::finish_incremental_sweep()
 {
+    // The threshold update below needs the live bytes from every block, including the ones still in the background.
+    if (m_blocks_in_concurrent_sweep > 0) {
+        m_concurrent_sweeper->wait();
+        adopt_concurrently_swept_blocks();
+    }
+    VERIFY(m_blocks_in_concurrent_sweep == 0);
+
     update_gc_bytes_threshold(m_sweep_live_cell_bytes, m_sweep_live_external_bytes);
 
     dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] === Sweep complete ===");
@@ -1365,12 +1863,18 @@ void Heap::sweep_on_timer()
     if (is_gc_deferred())
         return;
 
+    adopt_concurrently_swept_blocks();
+
     size_t blocks_swept = 0;
     bool finished_sweep = false;
     auto start_time = MonotonicTime::now();
     auto deadline = start_time + AK::Duration::from_milliseconds(GC_INCREMENTAL_SWEEP_SLICE_MS);
     while (MonotonicTime::now() < deadline) {
         if (sweep_next_block()) {
+            // Don't block the event loop on the background sweeper; check back on the next tick.
+            adopt_concurrently_swept_blocks();
+            if (m_blocks_in_concurrent_sweep > 0)
+                break;
             auto elapsed = MonotonicTime::now() - start_time;
             record_incremental_sweep_batch(blocks_swept, elapsed.to_microseconds(), false);
             finish_incremental_sweep();
@@ -19,6 +19,7 @@
 #include <LibCore/Forward.h>
 #include <LibGC/Cell.h>
 #include <LibGC/CellAllocator.h>
+#include <LibGC/ConcurrentSweeper.h>
 #include <LibGC/ConservativeHashMap.h>
 #include <LibGC/ConservativeVector.h>
 #include <LibGC/Forward.h>
@@ -33,6 +34,8 @@
 
 namespace GC {
 
+class MarkingVisitor;
+
 struct StackFrameInfo {
     String label;
     size_t size_bytes { 0 };
@@ -75,6 +78,10 @@ public:
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
 
+    // Writes every reachable cell to the stream in the V8 .heapsnapshot format, which the Chrome DevTools memory panel
+    // can load. The output is written as the heap is walked, so even very large heaps can be dumped.
+    ErrorOr<void> write_heap_snapshot(Stream&);
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
@@ -108,6 +115,9 @@ public:
 
     void sweep_block(HeapBlock&);
 
+    // Puts blocks the background sweeper has finished with back into their allocators' block lists.
+    void adopt_concurrently_swept_blocks();
+
     bool is_live_heap_block(HeapBlock* block) const { return m_live_heap_blocks.contains(block); }
 
     void enqueue_post_gc_task(AK::Function<void()>);
@@ -122,6 +132,7 @@ private:
     friend class HeapBlock;
     friend class MarkingVisitor;
     friend class GraphConstructorVisitor;
+    friend class HeapSnapshotWriter;
     friend class DeferGC;
 
     void defer_gc();
@@ -148,6 +159,7 @@ private:
     void gather_conservative_roots(HashMap<Cell*, HeapRoot>&, Vector<StackFrameInfo>* out_stack_frames = nullptr);
     void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address, FlatPtr stack_reference, FlatPtr stack_top);
     void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
+    bool mark_live_cells_in_parallel(MarkingVisitor&);
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
     void sweep_weak_blocks();
@@ -212,6 +224,11 @@ private:
     CellAllocator::SweepList m_allocators_to_sweep;
     RefPtr<Core::Timer> m_incremental_sweep_timer;
 
+    // Created the first time there is something to sweep concurrently. LIBGC_CONCURRENT_SWEEP=0 turns it off.
+    bool m_concurrent_sweep_enabled { true };
+    OwnPtr<ConcurrentSweeper> m_concurrent_sweeper;
+    size_t m_blocks_in_concurrent_sweep { 0 };
+
     RefPtr<Core::Timer> m_idle_gc_timer;
     u64 m_total_allocated_bytes { 0 };
     IdleCollectionPolicy m_idle_collection_policy;
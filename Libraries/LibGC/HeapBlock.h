@@ -91,6 +91,14 @@ public:
     IntrusiveListNode<HeapBlock> m_list_node;
     IntrusiveListNode<HeapBlock> m_sweep_list_node;
 
+    // Set by the background sweeper, which hands swept blocks back to the main thread through a lock-free stack.
+    HeapBlock* m_next_concurrently_swept_block { nullptr };
+    u32 m_concurrently_swept_live_cells { 0 };
+
+    // Set and cleared by the main thread. While set, the cells belong to the background sweeper and must not be touched.
+    bool is_being_swept_concurrently() const { return m_being_swept_concurrently; }
+    bool m_being_swept_concurrently { false };
+
     CellAllocator& cell_allocator() { return m_cell_allocator; }
 
     bool overrides_must_survive_garbage_collection() const { return m_overrides_must_survive_garbage_collection; }
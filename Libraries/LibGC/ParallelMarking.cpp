@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/NeverDestroyed.h>
+#include <LibCore/System.h>
+#include <LibGC/Cell.h>
+#include <LibGC/ParallelMarking.h>
+#include <LibThreading/Thread.h>
+#include <stdlib.h>
+
+namespace GC {
+
+// Beyond this, the extra threads mostly contend for the same memory bandwidth.
+static constexpr size_t MAX_MARKING_HELPER_THREADS = 7;
+
+void MarkingWorkPool::publish(Vector<Ref<Cell>>&& segment)
+{
+    {
+        Sync::MutexLocker locker(m_mutex);
+        m_segments.append(move(segment));
+    }
+    m_cv.signal();
+}
+
+bool MarkingWorkPool::take_or_wait_for_termination(Vector<Ref<Cell>>& mark_stack)
+{
+    Sync::MutexLocker locker(m_mutex);
+    m_idle_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    while (true) {
+        if (!m_segments.is_empty()) {
+            m_idle_count.fetch_sub(1, AK::MemoryOrder::memory_order_relaxed);
+            mark_stack = m_segments.take_last();
+            return true;
+        }
+        if (m_done)
+            return false;
+        // Nobody is left holding work that could be published, so the mark is complete.
+        if (m_idle_count.load(AK::MemoryOrder::memory_order_relaxed) == m_participant_count) {
+            m_done = true;
+            m_cv.broadcast();
+            return false;
+        }
+        m_cv.wait();
+    }
+}
+
+static size_t marking_helper_thread_count()
+{
+    if (auto const* env = getenv("LIBGC_MARKING_THREADS"); env && *env) {
+        auto threads = atoi(env);
+        if (threads <= 1)
+            return 0;
+        return min(static_cast<size_t>(threads - 1), MAX_MARKING_HELPER_THREADS);
+    }
+    auto cores = static_cast<size_t>(Core::System::hardware_concurrency());
+    if (cores <= 1)
+        return 0;
+    return min(cores - 1, MAX_MARKING_HELPER_THREADS);
+}
+
+MarkingHelperThreads& MarkingHelperThreads::the()
+{
+    static AK::NeverDestroyed<MarkingHelperThreads> instance;
+    return *instance;
+}
+
+MarkingHelperThreads::MarkingHelperThreads()
+    : m_thread_count(marking_helper_thread_count())
+{
+    for (size_t i = 0; i < m_thread_count; ++i) {
+        auto thread = Threading::Thread::construct(ByteString::formatted("GCMarker{}", i), [this, i] {
+            run(i);
+            return static_cast<intptr_t>(0);
+        });
+        thread->start();
+        thread->detach();
+        m_threads.append(move(thread));
+    }
+}
+
+bool MarkingHelperThreads::start(Function<void(size_t)>& job)
+{
+    {
+        Sync::MutexLocker locker(m_mutex);
+        if (m_in_use || m_thread_count == 0)
+            return false;
+        m_in_use = true;
+        m_job = &job;
+        m_running_count = m_thread_count;
+        ++m_job_generation;
+    }
+    m_job_cv.broadcast();
+    return true;
+}
+
+void MarkingHelperThreads::wait()
+{
+    Sync::MutexLocker locker(m_mutex);
+    while (m_running_count > 0)
+        m_done_cv.wait();
+    m_job = nullptr;
+    m_in_use = false;
+}
+
+void MarkingHelperThreads::run(size_t index)
+{
+    u64 last_seen_generation = 0;
+    while (true) {
+        Function<void(size_t)>* job = nullptr;
+        {
+            Sync::MutexLocker locker(m_mutex);
+            while (m_job_generation == last_seen_generation)
+                m_job_cv.wait();
+            last_seen_generation = m_job_generation;
+            job = m_job;
+        }
+
+        (*job)(index);
+
+        {
+            Sync::MutexLocker locker(m_mutex);
+            --m_running_count;
+        }
+        m_done_cv.signal();
+    }
+}
+
+}
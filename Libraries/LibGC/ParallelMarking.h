@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibGC/Forward.h>
+#include <LibGC/Ptr.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+#include <LibThreading/Forward.h>
+
+namespace GC {
+
+// Mark stacks are handed between marking threads in segments of this many cells.
+static constexpr size_t MARK_STACK_SEGMENT_SIZE = 256;
+
+// Shared pool of mark stack segments for a single parallel mark. Each marking thread drains its own mark stack and
+// only touches the pool to publish surplus work while others are idle, or to steal work once its own stack runs dry.
+class MarkingWorkPool {
+public:
+    explicit MarkingWorkPool(size_t participant_count)
+        : m_participant_count(participant_count)
+    {
+    }
+
+    // Cheap hint for the marking loop: is anyone waiting for work right now?
+    bool has_idle_participants() const { return m_idle_count.load(AK::MemoryOrder::memory_order_relaxed) > 0; }
+
+    void publish(Vector<Ref<Cell>>&& segment);
+
+    // Moves a published segment into `mark_stack`, blocking until one is available. Returns false once every
+    // participant is idle and the pool is empty, i.e. marking has finished.
+    bool take_or_wait_for_termination(Vector<Ref<Cell>>& mark_stack);
+
+private:
+    Sync::Mutex m_mutex;
+    Sync::ConditionVariable m_cv { m_mutex };
+    Vector<Vector<Ref<Cell>>> m_segments;
+    size_t const m_participant_count { 0 };
+    Atomic<size_t> m_idle_count { 0 };
+    bool m_done { false };
+};
+
+// Persistent pool of helper threads for parallel marking. The threads are spawned on first use and then sleep
+// between collections.
+class MarkingHelperThreads {
+public:
+    static MarkingHelperThreads& the();
+
+    MarkingHelperThreads();
+
+    // Number of helpers to use per collection. Defaults to one fewer than the number of cores (capped), and can be
+    // overridden with LIBGC_MARKING_THREADS=N, where N counts the collecting thread too; N <= 1 disables helpers.
+    size_t thread_count() const { return m_thread_count; }
+
+    // Starts `job` on every helper thread, passing each one its index. Returns false without running anything if
+    // another heap is already using the helpers.
+    bool start(Function<void(size_t)>& job);
+
+    // Blocks until every helper has returned from the job passed to start().
+    void wait();
+
+private:
+    void run(size_t index);
+
+    Sync::Mutex m_mutex;
+    Sync::ConditionVariable m_job_cv { m_mutex };
+    Sync::ConditionVariable m_done_cv { m_mutex };
+    Vector<NonnullRefPtr<Threading::Thread>> m_threads;
+    Function<void(size_t)>* m_job { nullptr };
+    u64 m_job_generation { 0 };
+    size_t m_running_count { 0 };
+    size_t m_thread_count { 0 };
+    bool m_in_use { false };
+};
+
+}
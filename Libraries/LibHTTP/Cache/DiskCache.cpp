@@ -5,6 +5,7 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/QuickSort.h>
 #include <AK/ScopeGuard.h>
 #include <LibCore/Directory.h>
 #include <LibCore/EventLoop.h>
@@ -20,6 +21,7 @@
 namespace HTTP {
 
 static constexpr auto INDEX_DATABASE = "INDEX"sv;
+static constexpr auto SHARED_ASSOCIATED_DATA_DIRECTORY = "Shared"sv;
 
 static ErrorOr<u64> compute_associated_data_size(LexicalPath const& cache_directory, u64 cache_key, u64 vary_key)
 {
@@ -322,6 +324,158 @@ ErrorOr<Optional<CacheEntryBodyFile>> DiskCache::retrieve_associated_data_file(U
     };
 }
 
+ErrorOr<bool> DiskCache::store_shared_associated_data(ReadonlyBytes content_hash, CacheEntryAssociatedData associated_data, ReadonlyBytes data)
+{
+    if (!has_shared_associated_data() || content_hash.size() != SHARED_ASSOCIATED_DATA_CONTENT_HASH_SIZE)
+        return false;
+    if (data.size() > MAXIMUM_SHARED_ASSOCIATED_DATA_SIZE / 8)
+        return false;
+
+    auto directory = shared_associated_data_directory();
+    TRY(Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes));
+
+    // An existing entry is replaced. The same content may have been stored by an older format of the data, or the
+    // data may have been refined since, e.g. bytecode that now carries a profile of its hot functions.
+    auto path = path_for_shared_associated_data(directory, content_hash, associated_data);
+
+    auto temporary_path = LexicalPath::join(directory.string(), ByteString::formatted("{}.tmp", path.basename()));
+    ArmedScopeGuard remove_temporary_file = [&]() {
+        (void)FileSystem::remove(temporary_path.string(), FileSystem::RecursionMode::Disallowed);
+    };
+
+    {
+        auto file = TRY(Core::File::open(temporary_path.string(), Core::File::OpenMode::Write));
+        TRY(file->write_until_depleted(data));
+    }
+
+    TRY(Core::System::rename(temporary_path.string(), path.string()));
+    remove_temporary_file.disarm();
+
+    if (auto previous_entry = shared_associated_data_entries().get(path.string()); previous_entry.has_value())
+        m_shared_associated_data_size -= previous_entry->size;
+    shared_associated_data_entries().set(path.string(), { .size = data.size(), .last_access_time = UnixDateTime::now() });
+    m_shared_associated_data_size += data.size();
+    remove_shared_associated_data_exceeding_limit();
+    return shared_associated_data_entries().contains(path.string());
+}
+
+ErrorOr<Optional<CacheEntryBodyFile>> DiskCache::retrieve_shared_associated_data_file(ReadonlyBytes content_hash, CacheEntryAssociatedData associated_data)
+{
+    if (!has_shared_associated_data() || content_hash.size() != SHARED_ASSOCIATED_DATA_CONTENT_HASH_SIZE)
+        return Optional<CacheEntryBodyFile> {};
+
+    auto path = path_for_shared_associated_data(shared_associated_data_directory(), content_hash, associated_data);
+    if (!shared_associated_data_entries().contains(path.string()))
+        return Optional<CacheEntryBodyFile> {};
+
+    auto file = Core::File::open(path.string(), Core::File::OpenMode::Read);
+    if (file.is_error()) {
+        if (file.error().is_errno() && file.error().code() == ENOENT) {
+            remove_shared_associated_data(path.string());
+            return Optional<CacheEntryBodyFile> {};
+        }
+        return file.release_error();
+    }
+
+    auto size = TRY(file.value()->size());
+    if (!AK::is_within_range<u64>(size))
+        return Error::from_errno(EOVERFLOW);
+
+    touch_shared_associated_data(path.string());
+
+    return CacheEntryBodyFile {
+        .fd = file.value()->leak_fd(),
+        .offset = 0,
+        .size = static_cast<u64>(size),
+    };
+}
+
+bool DiskCache::has_shared_associated_data() const
+{
+    // Partitioned caches must not observe data stored on behalf of other partitions.
+    return m_mode != Mode::Partitioned;
+}
+
+LexicalPath DiskCache::shared_associated_data_directory() const
+{
+    return m_cache_directory.append(SHARED_ASSOCIATED_DATA_DIRECTORY);
+}
+
+HashMap<ByteString, DiskCache::SharedAssociatedDataEntry>& DiskCache::shared_associated_data_entries()
+{
+    if (m_shared_associated_data_entries.has_value())
+        return *m_shared_associated_data_entries;
+
+    // Entries are touched whenever they are read, so their modification time is the last time they were accessed.
+    auto& entries = m_shared_associated_data_entries.emplace();
+    m_shared_associated_data_size = 0;
+
+    (void)Core::Directory::for_each_entry(
+        shared_associated_data_directory().string(),
+        static_cast<Core::DirIterator::Flags>(Core::DirIterator::SkipDots | Core::DirIterator::NoStat),
+        [&](Core::DirectoryEntry const& entry, Core::Directory const& parent) -> ErrorOr<IterationDecision> {
+            if (entry.type != Core::DirectoryEntry::Type::File)
+                return IterationDecision::Continue;
+
+            auto path = LexicalPath::join(parent.path().string(), entry.name).string();
+            auto stat = Core::System::stat(path);
+            if (stat.is_error() || stat.value().st_size < 0)
+                return IterationDecision::Continue;
+
+            auto size = static_cast<u64>(stat.value().st_size);
+            entries.set(move(path), { .size = size, .last_access_time = UnixDateTime::from_seconds_since_epoch(stat.value().st_mtime) });
+            m_shared_associated_data_size += size;
+            return IterationDecision::Continue;
+        });
+
+    return entries;
+}
+
+void DiskCache::touch_shared_associated_data(ByteString const& path)
+{
+    auto entry = shared_associated_data_entries().get(path);
+    if (!entry.has_value())
+        return;
+    entry->last_access_time = UnixDateTime::now();
+
+#ifndef AK_OS_WINDOWS
+    // Persist the access time, so that eviction stays least-recently-used across restarts.
+    (void)Core::System::utimensat(AT_FDCWD, path, nullptr, 0);
+#endif
+}
+
+void DiskCache::remove_shared_associated_data(ByteString const& path)
+{
+    auto entry = shared_associated_data_entries().take(path);
+    if (!entry.has_value())
+        return;
+
+    (void)FileSystem::remove(path, FileSystem::RecursionMode::Disallowed);
+    m_shared_associated_data_size -= entry->size;
+}
+
+void DiskCache::remove_shared_associated_data_exceeding_limit()
+{
+    auto& entries = shared_associated_data_entries();
+    if (m_shared_associated_data_size <= MAXIMUM_SHARED_ASSOCIATED_DATA_SIZE)
+        return;
+
+    Vector<ByteString> paths;
+    paths.ensure_capacity(entries.size());
+    for (auto const& it : entries)
+        paths.unchecked_append(it.key);
+
+    quick_sort(paths, [&](auto const& lhs, auto const& rhs) {
+        return entries.get(lhs)->last_access_time < entries.get(rhs)->last_access_time;
+    });
+
+    for (auto const& path : paths) {
+        if (m_shared_associated_data_size <= MAXIMUM_SHARED_ASSOCIATED_DATA_SIZE)
+            break;
+        remove_shared_associated_data(path);
+    }
+}
+
 bool DiskCache::check_if_cache_has_open_entry(CacheRequest& request, u64 cache_key, URL::URL const& url, CheckReaderEntries check_reader_entries)
 {
     // FIXME: We purposefully do not use the vary key here, as we do not yet have it when creating a CacheEntryWriter
@@ -365,7 +519,15 @@ void DiskCache::set_maximum_disk_cache_size(u64 maximum_disk_cache_size)
 
 Requests::CacheSizes DiskCache::estimate_cache_size_accessed_since(UnixDateTime since)
 {
-    return m_index.estimate_cache_size_accessed_since(since);
+    auto sizes = m_index.estimate_cache_size_accessed_since(since);
+
+    for (auto const& it : shared_associated_data_entries()) {
+        if (it.value.last_access_time >= since)
+            sizes.since_requested_time += it.value.size;
+        sizes.total += it.value.size;
+    }
+
+    return sizes;
 }
 
 void DiskCache::remove_entries_accessed_since(UnixDateTime since)
@@ -373,6 +535,14 @@ void DiskCache::remove_entries_accessed_since(UnixDateTime since)
     m_index.remove_entries_accessed_since(since, [&](auto cache_key, auto vary_key) {
         delete_entry(cache_key, vary_key);
     });
+
+    Vector<ByteString> paths_to_remove;
+    for (auto const& it : shared_associated_data_entries()) {
+        if (it.value.last_access_time >= since)
+            paths_to_remove.append(it.key);
+    }
+    for (auto const& path : paths_to_remove)
+        remove_shared_associated_data(path);
 }
 
 void DiskCache::cache_entry_closed(Badge<CacheEntry>, CacheEntry const& cache_entry)
@@ -58,6 +58,11 @@ public:
     ErrorOr<Optional<ByteBuffer>> retrieve_associated_data(URL::URL const&, StringView method, HeaderList const& request_headers, Optional<u64> vary_key, CacheEntryAssociatedData);
     ErrorOr<Optional<CacheEntryBodyFile>> retrieve_associated_data_file(URL::URL const&, StringView method, HeaderList const& request_headers, Optional<u64> vary_key, CacheEntryAssociatedData);
 
+    // Associated data that is derived purely from a response body (such as compiled bytecode) may be shared between
+    // all URLs serving the same content. These entries are keyed by a hash of that content rather than by URL.
+    ErrorOr<bool> store_shared_associated_data(ReadonlyBytes content_hash, CacheEntryAssociatedData, ReadonlyBytes);
+    ErrorOr<Optional<CacheEntryBodyFile>> retrieve_shared_associated_data_file(ReadonlyBytes content_hash, CacheEntryAssociatedData);
+
     void remove_entries_exceeding_cache_limit();
     void set_maximum_disk_cache_size(u64 maximum_disk_cache_size);
 
@@ -79,6 +84,18 @@ private:
 
     void delete_entry(u64 cache_key, u64 vary_key);
 
+    bool has_shared_associated_data() const;
+    LexicalPath shared_associated_data_directory() const;
+
+    struct SharedAssociatedDataEntry {
+        u64 size { 0 };
+        UnixDateTime last_access_time;
+    };
+    HashMap<ByteString, SharedAssociatedDataEntry>& shared_associated_data_entries();
+    void touch_shared_associated_data(ByteString const& path);
+    void remove_shared_associated_data(ByteString const& path);
+    void remove_shared_associated_data_exceeding_limit();
+
     Mode m_mode;
     Optional<String> m_partitioned_cache_key;
 
@@ -93,6 +110,11 @@ private:
 
     LexicalPath m_cache_directory;
     CacheIndex m_index;
+
+    // Size and last access time of every shared associated data file, keyed by path. This is loaded from the directory
+    // on first use and kept up to date afterwards, so that storing an entry does not have to scan the directory.
+    Optional<HashMap<ByteString, SharedAssociatedDataEntry>> m_shared_associated_data_entries;
+    u64 m_shared_associated_data_size { 0 };
 };
 
 }
@@ -5,6 +5,7 @@
  */
 
 #include <AK/GenericLexer.h>
+#include <AK/Hex.h>
 #include <AK/QuickSort.h>
 #include <AK/StringBuilder.h>
 #include <AK/StringConversions.h>
@@ -137,6 +138,12 @@ LexicalPath path_for_cache_entry_associated_data(LexicalPath const& cache_direct
     return cache_directory.append(file);
 }
 
+LexicalPath path_for_shared_associated_data(LexicalPath const& shared_directory, ReadonlyBytes content_hash, CacheEntryAssociatedData associated_data)
+{
+    auto file = ByteString::formatted("{}.{}", encode_hex(content_hash), cache_entry_associated_data_suffix(associated_data));
+    return shared_directory.append(file);
+}
+
 Optional<CacheEntryData> cache_entry_data_for_file(LexicalPath const& cache_file)
 {
     CacheEntryData result;
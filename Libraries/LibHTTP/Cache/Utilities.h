@@ -8,6 +8,7 @@
 
 #include <AK/Array.h>
 #include <AK/LexicalPath.h>
+#include <AK/Span.h>
 #include <AK/StringView.h>
 #include <AK/Time.h>
 #include <AK/Types.h>
@@ -23,6 +24,10 @@ constexpr inline auto TEST_CACHE_REVALIDATION_STATUS_HEADER = "X-Ladybird-Revali
 constexpr inline auto TEST_CACHE_REQUEST_TIME_OFFSET = "X-Ladybird-Request-Time-Offset"sv;
 
 constexpr inline u64 DEFAULT_MAXIMUM_DISK_CACHE_SIZE = 5 * GiB;
+constexpr inline u64 MAXIMUM_SHARED_ASSOCIATED_DATA_SIZE = 256 * MiB;
+
+// Shared associated data is keyed by the SHA-256 digest of the content it was derived from.
+constexpr inline size_t SHARED_ASSOCIATED_DATA_CONTENT_HASH_SIZE = 32;
 
 enum class CacheEntryAssociatedData {
     JavaScriptBytecode,
@@ -37,6 +42,7 @@ u64 create_cache_key(StringView url, StringView method, Optional<String const&>
 u64 create_vary_key(HeaderList const& request_headers, HeaderList const& response_headers);
 LexicalPath path_for_cache_entry(LexicalPath const& cache_directory, u64 cache_key, u64 vary_key);
 LexicalPath path_for_cache_entry_associated_data(LexicalPath const& cache_directory, u64 cache_key, u64 vary_key, CacheEntryAssociatedData);
+LexicalPath path_for_shared_associated_data(LexicalPath const& shared_directory, ReadonlyBytes content_hash, CacheEntryAssociatedData);
 
 struct CacheEntryData {
     u64 cache_key { 0 };
@@ -1702,16 +1702,48 @@ fn emit_instruction(
         }
 
         // load_operand dst_reg, byte_offset
-        // Load u32 operand from bytecode, use as index into values array
+        // Load u32 operand from bytecode, use as index into values array,
+        // or into the executable's constant pool if it is a constant.
         "load_operand" => {
             if insn.operands.len() >= 2 {
                 let dst = resolve_op(&insn.operands[0], handler, program);
                 let offset = resolve_op(&insn.operands[1], handler, program);
                 let offset_val: i64 = offset.parse().expect("invalid offset in load_operand");
+                let executable_offset = program
+                    .constants
+                    .get("EXECUTION_CONTEXT_EXECUTABLE")
+                    .copied()
+                    .expect("EXECUTION_CONTEXT_EXECUTABLE constant required for load_operand");
+                let constants_data_offset = program
+                    .constants
+                    .get("EXECUTABLE_CONSTANTS_DATA")
+                    .copied()
+                    .expect("EXECUTABLE_CONSTANTS_DATA constant required for load_operand");
+                // The cold block must not need x9 to materialize an offset, since x9 holds the operand.
+                assert!(
+                    [executable_offset, constants_data_offset]
+                        .iter()
+                        .all(|&offset| (0..32760).contains(&offset) && offset % 8 == 0),
+                    "load_operand constant pool offsets must fit an ldr immediate"
+                );
+                let id = state.unique_counter;
+                state.unique_counter += 1;
+                let constant_label = format!(".Lasm_{}.load_constant_{id}", handler.name);
+                let ret_label = format!(".Lasm_{}.load_constant_{id}_ret", handler.name);
                 // x21 = pb + pc (pinned at handler entry); load operand index
                 emit_ldr32(out, "w9", "x21", offset_val);
+                // Constant pool operands have bit 31 set (Operand::constant_pool_bit)
+                w!(out, "    tbnz w9, #31, {constant_label}");
                 // dst = values[w9] (scaled by 8)
                 w!(out, "    ldr {dst}, [x27, x9, lsl #3]");
+                w!(out, "{ret_label}:");
+                // Cold block: dst = exec_ctx->executable->constants_data[w9 & 0x7FFFFFFF]
+                w!(state.cold_blocks, "{constant_label}:");
+                w!(state.cold_blocks, "    and w9, w9, #0x7FFFFFFF");
+                emit_ldr64(&mut state.cold_blocks, &dst, "x28", executable_offset);
+                emit_ldr64(&mut state.cold_blocks, &dst, &dst, constants_data_offset);
+                w!(state.cold_blocks, "    ldr {dst}, [{dst}, x9, lsl #3]");
+                w!(state.cold_blocks, "    b {ret_label}");
             }
         }
 
@@ -1175,10 +1175,35 @@ fn emit_instruction(
             if insn.operands.len() >= 2 {
                 let dst = resolve_op(&insn.operands[0], handler, program);
                 let offset = resolve_op(&insn.operands[1], handler, program);
+                let executable_offset = program
+                    .constants
+                    .get("EXECUTION_CONTEXT_EXECUTABLE")
+                    .copied()
+                    .expect("EXECUTION_CONTEXT_EXECUTABLE constant required for load_operand");
+                let constants_data_offset = program
+                    .constants
+                    .get("EXECUTABLE_CONSTANTS_DATA")
+                    .copied()
+                    .expect("EXECUTABLE_CONSTANTS_DATA constant required for load_operand");
+                let id = state.unique_counter;
+                state.unique_counter += 1;
+                let constant_label = format!(".Lasm_{}.load_constant_{id}", handler.name);
+                let ret_label = format!(".Lasm_{}.load_constant_{id}_ret", handler.name);
                 // Load the u32 operand raw value from bytecode
                 w!(out, "    mov eax, DWORD PTR [r14 + r13 + {offset}]");
+                // Constant pool operands have the sign bit set (Operand::constant_pool_bit)
+                w!(out, "    test eax, eax");
+                w!(out, "    js {constant_label}");
                 // Use it as index into values array (scaled by 8)
                 w!(out, "    mov {dst}, QWORD PTR [r15 + rax * 8]");
+                w!(out, "{ret_label}:");
+                // Cold block: read the constant from the running executable's constant pool
+                w!(state.cold_blocks, "{constant_label}:");
+                w!(state.cold_blocks, "    and eax, 0x7FFFFFFF");
+                w!(state.cold_blocks, "    mov {dst}, QWORD PTR [rbx + {executable_offset}]");
+                w!(state.cold_blocks, "    mov {dst}, QWORD PTR [{dst} + {constants_data_offset}]");
+                w!(state.cold_blocks, "    mov {dst}, QWORD PTR [{dst} + rax * 8]");
+                w!(state.cold_blocks, "    jmp {ret_label}");
             }
         }
 
@@ -1737,4 +1762,30 @@ mod tests {
         assert!(out.contains("jnc .Lasm_Call.slow"));
         assert!(!out.contains("test rdx, 4294967296"));
     }
+
+    #[test]
+    fn load_operand_reads_constants_from_the_executable_in_a_cold_block() {
+        let mut program = test_program();
+        program
+            .constants
+            .insert("EXECUTION_CONTEXT_EXECUTABLE".into(), 48);
+        program
+            .constants
+            .insert("EXECUTABLE_CONSTANTS_DATA".into(), 200);
+        let handler = call_handler();
+        let instruction = AsmInstruction {
+            mnemonic: "load_operand".into(),
+            operands: vec![Operand::Register("rdx".into()), Operand::Immediate(8)],
+        };
+        let mut out = String::new();
+        let mut state = HandlerState::new();
+
+        emit_instruction(&mut out, &instruction, &handler, &program, &mut state);
+
+        assert!(out.contains("js .Lasm_Call.load_constant_0"));
+        assert!(out.contains("mov rdx, QWORD PTR [r15 + rax * 8]"));
+        assert!(state.cold_blocks.contains("mov rdx, QWORD PTR [rbx + 48]"));
+        assert!(state.cold_blocks.contains("mov rdx, QWORD PTR [rdx + 200]"));
+        assert!(state.cold_blocks.contains("jmp .Lasm_Call.load_constant_0_ret"));
+    }
 }
@@ -9,6 +9,7 @@
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/PropertyAccess.h>
+#include <LibJS/Bytecode/TypeFeedback.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -115,7 +116,7 @@ void AsmInterpreter::run(VM& vm, [[maybe_unused]] size_t entry_point)
 
     auto& context = vm.running_execution_context();
     auto* bytecode = context.executable->bytecode.data();
-    auto* values = context.registers_and_constants_and_locals_and_arguments_span().data();
+    auto* values = context.registers_and_locals_and_arguments_span().data();
 
     asm_interpreter_entry(bytecode, static_cast<u32>(entry_point), values, &vm);
 #endif
@@ -207,6 +208,26 @@ ALWAYS_INLINE static i64 slow_path_nonthrowing(VM& vm, u32 pc)
 ALWAYS_INLINE static void bump_slow_path(VM&, u32) { }
 #endif
 
+template<ObservedType observed_type>
+static i64 record_type_feedback_from_asm(VM& vm, u32 pc)
+{
+    auto& executable = vm.current_executable();
+    auto& insn = *reinterpret_cast<Instruction const*>(&executable.bytecode.data()[pc]);
+    u32 type_feedback_slot = 0;
+    switch (insn.type()) {
+    case Instruction::Type::Add:
+        type_feedback_slot = static_cast<Op::Add const&>(insn).type_feedback();
+        break;
+    case Instruction::Type::GetByValue:
+        type_feedback_slot = static_cast<Op::GetByValue const&>(insn).type_feedback();
+        break;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+    record_type_feedback(executable, insn, type_feedback_slot, observed_type);
+    return 0;
+}
+
 extern "C" {
 
 // Forward declarations for all functions called from assembly.
@@ -272,6 +293,12 @@ u64 asm_helper_single_ascii_character_string(u64 encoded_value);
 u64 asm_helper_single_utf16_code_unit_string(u64 encoded_value);
 i64 asm_helper_handle_raw_native_exception(u64 encoded_exception);
 i64 asm_try_inline_call(VM*, u32 pc);
+i64 asm_take_profiler_sample(VM*, u32 pc);
+i64 asm_record_int32_type_feedback(VM*, u32 pc);
+i64 asm_record_double_type_feedback(VM*, u32 pc);
+i64 asm_record_packed_array_type_feedback(VM*, u32 pc);
+i64 asm_slow_path_add_int32(VM*, u32 pc);
+i64 asm_slow_path_get_by_value_packed_array(VM*, u32 pc);
 i64 asm_try_put_by_id_cache(VM*, u32 pc);
 i64 asm_try_get_by_id_cache(VM*, u32 pc);
 i64 asm_slow_path_initialize_lexical_binding(VM*, u32 pc);
@@ -518,6 +545,13 @@ i64 asm_slow_path_add(VM* vm, u32 pc)
     return slow_path_throwing<Op::Add>(*vm, pc);
 }
 
+i64 asm_slow_path_add_int32(VM* vm, u32 pc)
+{
+    auto& executable = vm->current_executable();
+    deoptimize(executable, *reinterpret_cast<Instruction const*>(&executable.bytecode.data()[pc]), Instruction::Type::Add);
+    return slow_path_throwing<Op::Add>(*vm, pc);
+}
+
 i64 asm_slow_path_sub(VM* vm, u32 pc)
 {
     return slow_path_throwing<Op::Sub>(*vm, pc);
@@ -684,6 +718,13 @@ i64 asm_slow_path_get_by_value(VM* vm, u32 pc)
     return slow_path_throwing<Op::GetByValue>(*vm, pc);
 }
 
+i64 asm_slow_path_get_by_value_packed_array(VM* vm, u32 pc)
+{
+    auto& executable = vm->current_executable();
+    deoptimize(executable, *reinterpret_cast<Instruction const*>(&executable.bytecode.data()[pc]), Instruction::Type::GetByValue);
+    return slow_path_throwing<Op::GetByValue>(*vm, pc);
+}
+
 i64 asm_slow_path_get_length(VM* vm, u32 pc)
 {
     return slow_path_throwing<Op::GetLength>(*vm, pc);
@@ -899,6 +940,33 @@ i64 asm_try_put_by_value_holey_array(VM* vm, u32 pc)
     return 0;
 }
 
+// Record a sampling profiler sample at a loop back-edge or function entry.
+// Always returns 0; the handler resumes at pc.
+i64 asm_take_profiler_sample(VM* vm, u32 pc)
+{
+    vm->running_execution_context().program_counter = pc;
+    vm->take_profiler_sample();
+    return 0;
+}
+
+// Record the operand type a quickenable handler took its fast path for.
+// Always returns 0; the handler continues. May quicken the instruction at pc,
+// which keeps its size, so the handler's dispatch_next is unaffected.
+i64 asm_record_int32_type_feedback(VM* vm, u32 pc)
+{
+    return record_type_feedback_from_asm<ObservedType::Int32>(*vm, pc);
+}
+
+i64 asm_record_double_type_feedback(VM* vm, u32 pc)
+{
+    return record_type_feedback_from_asm<ObservedType::Double>(*vm, pc);
+}
+
+i64 asm_record_packed_array_type_feedback(VM* vm, u32 pc)
+{
+    return record_type_feedback_from_asm<ObservedType::PackedArray>(*vm, pc);
+}
+
 // Try to inline a JS-to-JS call by building the callee frame through the
 // shared VM::push_inline_frame() helper. Returns 0 on success (callee frame
 // pushed) and 1 on failure (caller should keep handling the Call itself).
@@ -7,7 +7,7 @@
 # Register conventions (pinned in callee-saved regs, survive C++ calls):
 #   pc       = program counter (byte offset into bytecode, 32-bit)
 #   pb       = bytecode base pointer (u8 const*)
-#   values   = pointer to Value[] array (registers+constants+locals+arguments)
+#   values   = pointer to Value[] array (registers+locals+arguments)
 #   exec_ctx = running ExecutionContext*
 #   dispatch = dispatch table base pointer (256 entries, 8 bytes each)
 #
@@ -320,10 +320,10 @@ macro jump_binary_epilogue(slow_path_func)
     call_slow_path slow_path_func
 .take_true:
     load_label target, m_true_target
-    goto_handler target
+    goto_jump_target target
 .take_false:
     load_label target, m_false_target
-    goto_handler target
+    goto_jump_target target
 end
 
 # Coerce two operands to int32 for bitwise operations.
@@ -437,6 +437,34 @@ macro dispatch_current()
     goto_handler pc
 end
 
+# Dispatch to the handler at pc, first letting the sampling profiler record
+# the stack if its timer thread has asked for a sample since the last poll.
+macro poll_profiler_and_dispatch()
+    temp vm_ptr, requested, result
+    load_vm vm_ptr
+    load8 requested, [vm_ptr, VM_PROFILER_SAMPLE_REQUESTED]
+    branch_nonzero requested, .take_sample
+    goto_handler pc
+.take_sample:
+    call_interp asm_take_profiler_sample, result
+    goto_handler pc
+end
+
+# Take a jump to the bytecode address in target. A target at or before the
+# current pc is a loop back-edge, which bumps the executable's hotness counter.
+macro goto_jump_target(target)
+    temp exe
+    branch_ge_unsigned pc, target, .back_edge
+    goto_handler target
+.back_edge:
+    load64 exe, [exec_ctx, EXECUTION_CONTEXT_EXECUTABLE]
+    inc32_mem [exe, EXECUTABLE_BACK_EDGE_COUNT]
+    mov pc, target
+    # Loops are one of the two places (with function entry) where we poll for
+    # profiler samples, so a long-running loop still gets sampled.
+    poll_profiler_and_dispatch
+end
+
 # Walk the environment chain using a statically computed EnvironmentCoordinate.
 # Input: m_cache_field is the offset of the EnvironmentCoordinate inside
 # the bytecode instruction.
@@ -546,6 +574,21 @@ macro load_property_lookup_cache(cache, fail_label)
 .data_loaded:
 end
 
+# Report the operand type a quickenable handler took its fast path for, until
+# the instruction's type feedback slot has warmed up. See TypeFeedback.h.
+macro record_type_feedback(record_function)
+    temp slot, exe, count, result
+    load32 slot, [pb, pc, m_type_feedback]
+    mul slot, slot, TYPE_FEEDBACK_SLOT_SIZE
+    load64 exe, [exec_ctx, EXECUTION_CONTEXT_EXECUTABLE]
+    load64 exe, [exe, EXECUTABLE_TYPE_FEEDBACK_SLOTS_DATA]
+    add slot, exe
+    load8 count, [slot, TYPE_FEEDBACK_SLOT_EXECUTION_COUNT]
+    branch_eq count, TYPE_FEEDBACK_WARMUP_THRESHOLD, .warm
+    call_interp record_function, result
+.warm:
+end
+
 macro load_global_variable_cache(cache)
     temp exe, caches
     load32 cache, [pb, pc, m_cache]
@@ -604,12 +647,14 @@ handler Add
     fp_add lhs_dbl, rhs_dbl
     box_double_or_int32 dst, lhs_dbl
     store_operand m_dst, dst
+    record_type_feedback asm_record_double_type_feedback
     dispatch_next
 .both_int:
     # 32-bit add with hardware overflow detection
     add32_overflow lhs_int, rhs_int, .overflow
     box_int32_clean dst, lhs_int
     store_operand m_dst, dst
+    record_type_feedback asm_record_int32_type_feedback
     dispatch_next
 .overflow:
     # Int32 overflow: convert both to double and redo the operation
@@ -620,11 +665,32 @@ handler Add
     fp_add lhs_dbl, rhs_dbl
     fp_mov dst, lhs_dbl
     store_operand m_dst, dst
+    record_type_feedback asm_record_int32_type_feedback
     dispatch_next
 .slow:
     call_slow_path asm_slow_path_add
 end
 
+# Quickened Add for sites that have only seen int32 operands. Anything else,
+# including overflow, rewrites the instruction back to Add and runs that.
+handler AddInt32
+    temp lhs, rhs, lhs_tag, rhs_tag, lhs_int, rhs_int, dst
+    load_operand lhs, m_lhs
+    load_operand rhs, m_rhs
+    extract_tag lhs_tag, lhs
+    branch_ne lhs_tag, INT32_TAG, .deoptimize
+    extract_tag rhs_tag, rhs
+    branch_ne rhs_tag, INT32_TAG, .deoptimize
+    unbox_int32 lhs_int, lhs
+    unbox_int32 rhs_int, rhs
+    add32_overflow lhs_int, rhs_int, .deoptimize
+    box_int32_clean dst, lhs_int
+    store_operand m_dst, dst
+    dispatch_next
+.deoptimize:
+    call_slow_path asm_slow_path_add_int32
+end
+
 # Same pattern as Add but with subtraction.
 handler Sub
     temp lhs, rhs, lhs_int, rhs_int, dst
@@ -701,7 +767,7 @@ end
 handler Jump
     temp target
     load_label target, m_target
-    goto_handler target
+    goto_jump_target target
 end
 
 # Conditional jumps: check boolean first (most common), then int32, then slow path.
@@ -728,10 +794,10 @@ handler JumpIf
     jmp .take_false
 .take_true:
     load_label target, m_true_target
-    goto_handler target
+    goto_jump_target target
 .take_false:
     load_label target, m_false_target
-    goto_handler target
+    goto_jump_target target
 end
 
 handler JumpTrue
@@ -752,7 +818,7 @@ handler JumpTrue
     dispatch_next
 .take:
     load_label target, m_target
-    goto_handler target
+    goto_jump_target target
 end
 
 handler JumpFalse
@@ -773,7 +839,7 @@ handler JumpFalse
     dispatch_next
 .take:
     load_label target, m_target
-    goto_handler target
+    goto_jump_target target
 end
 
 # Nullish check: undefined and null tags differ only in bit 0,
@@ -786,10 +852,10 @@ handler JumpNullish
     and tag, 0xFFFE
     branch_eq tag, UNDEFINED_TAG, .nullish
     load_label target, m_false_target
-    goto_handler target
+    goto_jump_target target
 .nullish:
     load_label target, m_true_target
-    goto_handler target
+    goto_jump_target target
 end
 
 handler JumpUndefined
@@ -798,10 +864,10 @@ handler JumpUndefined
     mov undef, UNDEFINED_SHIFTED
     branch_eq condition, undef, .is_undefined
     load_label target, m_false_target
-    goto_handler target
+    goto_jump_target target
 .is_undefined:
     load_label target, m_true_target
-    goto_handler target
+    goto_jump_target target
 end
 
 
@@ -1660,6 +1726,22 @@ end
 # Property access (indexed + named + inline caches)
 # ============================================================================
 
+# Keep the object's IndexedElementKind in sync with a value about to be stored
+# into Packed/Holey storage. Int32 values fit every kind and doubles widen
+# Int32 to Double; anything else stored into a numeric array goes to fail so
+# the C++ side can widen the kind to Any.
+macro widen_indexed_element_kind(obj, value, fail)
+    temp element_kind, tag
+    load8 element_kind, [obj, OBJECT_INDEXED_ELEMENT_KIND]
+    branch_eq element_kind, INDEXED_ELEMENT_KIND_ANY, .done
+    extract_tag tag, value
+    branch_eq tag, INT32_TAG, .done
+    check_tag_is_double tag, fail
+    branch_eq element_kind, INDEXED_ELEMENT_KIND_DOUBLE, .done
+    store8 [obj, OBJECT_INDEXED_ELEMENT_KIND], INDEXED_ELEMENT_KIND_DOUBLE
+.done:
+end
+
 # Fast path for array[int32_index] = value with Packed/Holey indexed storage.
 handler PutByValue
     temp kind, base, prop, base_tag, prop_tag, index, obj, flags, storage_kind, size, elements, src, capacity_addr, capacity, slot, empty_tag, kind_byte, addr, src_int32, max, result
@@ -1691,6 +1773,7 @@ handler PutByValue
     load64 elements, [obj, OBJECT_INDEXED_ELEMENTS]
     assert_nonzero elements
     load_operand src, m_src
+    widen_indexed_element_kind obj, src, .slow
     store64 [elements, index, 8], src
     dispatch_next
 .not_packed:
@@ -1708,6 +1791,7 @@ handler PutByValue
     mov empty_tag, EMPTY_TAG_SHIFTED
     branch_eq slot, empty_tag, .try_holey_array_slow
     load_operand src, m_src
+    widen_indexed_element_kind obj, src, .slow
     store64 [elements, index, 8], src
     dispatch_next
 .try_holey_array_slow:
@@ -1915,6 +1999,7 @@ handler GetByValue
     # NB: No accessor check needed -- Packed/Holey storage
     #     can only hold default-attributed data properties.
     store_operand m_dst, dst
+    record_type_feedback asm_record_packed_array_type_feedback
     dispatch_next
 .not_packed:
     branch_ne storage_kind, INDEXED_STORAGE_KIND_HOLEY, .slow
@@ -2023,6 +2108,37 @@ handler GetByValue
     call_slow_path asm_slow_path_get_by_value
 end
 
+# Quickened GetByValue for sites that have only read in-bounds elements of
+# packed arrays. Anything else rewrites the instruction back to GetByValue
+# and runs that.
+handler GetByValuePackedArray
+    temp base, prop, base_tag, prop_tag, index, obj, flags, storage_kind, size, elements, dst
+    load_operand base, m_base
+    load_operand prop, m_property
+    extract_tag base_tag, base
+    branch_ne base_tag, OBJECT_TAG, .deoptimize
+    extract_tag prop_tag, prop
+    branch_ne prop_tag, INT32_TAG, .deoptimize
+    mov index, prop
+    and index, 0xFFFFFFFF
+    branch_bit_set index, 31, .deoptimize
+    unbox_object obj, base
+    load8 flags, [obj, OBJECT_FLAGS]
+    branch_bits_set flags, OBJECT_FLAG_IS_TYPED_ARRAY, .deoptimize
+    branch_bits_set flags, OBJECT_FLAG_MAY_INTERFERE, .deoptimize
+    load8 storage_kind, [obj, OBJECT_INDEXED_STORAGE_KIND]
+    branch_ne storage_kind, INDEXED_STORAGE_KIND_PACKED, .deoptimize
+    load32 size, [obj, OBJECT_INDEXED_ARRAY_LIKE_SIZE]
+    branch_ge_unsigned index, size, .deoptimize
+    load64 elements, [obj, OBJECT_INDEXED_ELEMENTS]
+    assert_nonzero elements
+    load64 dst, [elements, index, 8]
+    store_operand m_dst, dst
+    dispatch_next
+.deoptimize:
+    call_slow_path asm_slow_path_get_by_value_packed_array
+end
+
 # Fast path for Array.length (magical length property).
 # Also includes IC fast path for non-array objects (same as GetById).
 handler GetLength
@@ -2194,9 +2310,10 @@ handler Call
     #   1. Validate the callee and load its shared function metadata.
     #   2. Bind `this` inline when we can do so without allocations.
     #   3. Reserve an InterpreterStack frame and populate ExecutionContext.
-    #   4. Materialize [registers | locals | constants | arguments].
+    #   4. Materialize [registers | locals | arguments]. Constants stay in
+    #      the callee Executable's constant pool and are never copied.
     #   5. Swap VM state over to the callee frame and dispatch at pc = 0.
-    temp callee, callee_value, flags, shared_data, exec_ptr, meta, this_value, tag, scratch, formal_count, passed_count, arg_count, total_slots, regs_locals_count, frame_bytes, vm_ptr, stack_limit, frame_base, value_tail, realm, lex_env, priv_env, empty_tag, som_src, som_lo, som_hi, return_pc, return_dst, base_pc, slot_offset, slot_end, const_count, const_data, const_idx, const_value, write_idx, arg_idx, arg_ops, arg_value, undef_slot, fill_end, native_func, variant, native_return, helper_arg, native_pc, exception_pc, native_total_bytes, after_pc, dst_offset, after_offset, result
+    temp callee, callee_value, flags, shared_data, exec_ptr, meta, this_value, tag, scratch, formal_count, passed_count, arg_count, total_slots, frame_bytes, vm_ptr, stack_limit, frame_base, value_tail, realm, lex_env, priv_env, empty_tag, som_src, som_lo, som_hi, return_pc, return_dst, base_pc, slot_offset, slot_end, write_idx, arg_idx, arg_ops, arg_value, undef_slot, fill_end, native_func, variant, native_return, helper_arg, native_pc, exception_pc, native_total_bytes, after_pc, dst_offset, after_offset, result
     load_operand callee_value, m_callee
     extract_tag tag, callee_value
     branch_ne tag, OBJECT_TAG, .call_slow
@@ -2260,11 +2377,11 @@ handler Call
     branch_ge_unsigned formal_count, passed_count, .arg_count_ready
     mov formal_count, passed_count
 .arg_count_ready:
-    load_pair32 regs_locals_count, total_slots, [exec_ptr, EXECUTABLE_REGISTERS_AND_LOCALS_COUNT], [exec_ptr, EXECUTABLE_REGISTERS_AND_LOCALS_AND_CONSTANTS_COUNT]
     assert_nonzero exec_ptr
-    assert_ge_unsigned total_slots, regs_locals_count
+    load32 total_slots, [exec_ptr, EXECUTABLE_REGISTERS_AND_LOCALS_COUNT]
 
     # Inline InterpreterStack::allocate().
+    mov slot_end, total_slots
     add total_slots, formal_count
     mov frame_bytes, total_slots
     shl frame_bytes, 3
@@ -2287,7 +2404,7 @@ handler Call
     # Set up the callee ExecutionContext header exactly the way
     # VM::push_inline_frame() / run_executable() would see it.
     lea value_tail, [frame_base, SIZEOF_EXECUTION_CONTEXT]
-    store_pair32 [frame_base, EXECUTION_CONTEXT_REGISTERS_AND_CONSTANTS_AND_LOCALS_AND_ARGUMENTS_COUNT], [frame_base, EXECUTION_CONTEXT_ARGUMENT_COUNT], total_slots, formal_count
+    store_pair32 [frame_base, EXECUTION_CONTEXT_REGISTERS_AND_LOCALS_AND_ARGUMENTS_COUNT], [frame_base, EXECUTION_CONTEXT_ARGUMENT_COUNT], total_slots, formal_count
     load32 scratch, [pb, pc, m_argument_count]
     store32 [frame_base, EXECUTION_CONTEXT_PASSED_ARGUMENT_COUNT], scratch
 
@@ -2330,10 +2447,11 @@ handler Call
     add return_pc, base_pc
     store_pair32 [frame_base, EXECUTION_CONTEXT_CALLER_RETURN_PC], [frame_base, EXECUTION_CONTEXT_CALLER_DST_RAW], return_pc, return_dst
 
-    # values = [registers | locals | constants | arguments]
+    # values = [registers | locals | arguments]
     # Walk value_tail with two cursors: slot_offset for the byte index and
-    # write_idx for the element index when copying constants/arguments.
-    mov slot_end, regs_locals_count
+    # write_idx for the element index when copying arguments.
+    # slot_end still holds the callee's registers+locals count here.
+    mov write_idx, slot_end
     shl slot_end, 3
     mov slot_offset, RESERVED_REGISTERS_SIZE
 .clear_registers_and_locals:
@@ -2345,43 +2463,41 @@ handler Call
     jmp .clear_registers_and_locals
 
 .clear_registers_and_locals_tail:
-    branch_ge_unsigned slot_offset, slot_end, .copy_constants
+    branch_ge_unsigned slot_offset, slot_end, .copy_arguments
     store64 [value_tail, slot_offset], empty_tag
 
-.copy_constants:
-    load64 const_data, [frame_base, EXECUTION_CONTEXT_EXECUTABLE]
-    load_pair64 const_count, const_data, [const_data, EXECUTABLE_ASM_CONSTANTS_SIZE], [const_data, EXECUTABLE_ASM_CONSTANTS_DATA]
-    mov write_idx, regs_locals_count
-    xor const_idx, const_idx
-.copy_constants_loop:
-    branch_ge_unsigned const_idx, const_count, .copy_arguments
-    assert_nonzero const_data
-    load64 const_value, [const_data, const_idx, 8]
-    store64 [value_tail, write_idx, 8], const_value
-    add const_idx, 1
-    add write_idx, 1
-    jmp .copy_constants_loop
-
 .copy_arguments:
     load32 arg_count, [pb, pc, m_argument_count]
     assert_ge_unsigned formal_count, arg_count
-    mov write_idx, regs_locals_count
-    add write_idx, const_count
     lea scratch, [exec_ctx, SIZEOF_EXECUTION_CONTEXT]
     lea arg_ops, [pb, pc]
     add arg_ops, m_expression_string
     add arg_ops, 4
     xor arg_idx, arg_idx
 .copy_arguments_loop:
-    # The operand array in the bytecode stores caller register indices.
+    # The operand array in the bytecode stores caller operands: either an
+    # index into the caller's values, or a caller constant pool index.
     branch_ge_unsigned arg_idx, arg_count, .fill_missing_arguments
     load32 arg_value, [arg_ops, arg_idx, 4]
+    branch_bits_set arg_value, OPERAND_CONSTANT_POOL_BIT, .copy_constant_argument
     load64 arg_value, [scratch, arg_value, 8]
+.store_argument:
     store64 [value_tail, write_idx, 8], arg_value
     add arg_idx, 1
     add write_idx, 1
     jmp .copy_arguments_loop
 
+.copy_constant_argument:
+    # Every other temp is live here, so borrow scratch for the caller's
+    # constant pool and point it back at the caller's values afterwards.
+    and arg_value, OPERAND_CONSTANT_POOL_INDEX_MASK
+    load64 scratch, [exec_ctx, EXECUTION_CONTEXT_EXECUTABLE]
+    load64 scratch, [scratch, EXECUTABLE_CONSTANTS_DATA]
+    assert_nonzero scratch
+    load64 arg_value, [scratch, arg_value, 8]
+    lea scratch, [exec_ctx, SIZEOF_EXECUTION_CONTEXT]
+    jmp .store_argument
+
 .fill_missing_arguments:
     mov fill_end, write_idx
     add fill_end, formal_count
@@ -2395,6 +2511,7 @@ handler Call
 
 .enter_callee:
     load64 pb, [frame_base, EXECUTION_CONTEXT_EXECUTABLE]
+    inc32_mem [pb, EXECUTABLE_CALL_COUNT]
     load64 pb, [pb, EXECUTABLE_BYTECODE_DATA]
     assert_nonzero pb
     load_vm vm_ptr
@@ -2402,7 +2519,9 @@ handler Call
     mov exec_ctx, frame_base
     lea values, [exec_ctx, SIZEOF_EXECUTION_CONTEXT]
     xor pc, pc
-    goto_handler pc
+    # Inline calls never leave the asm interpreter, so poll for profiler
+    # samples on entry with the callee's frame already running.
+    poll_profiler_and_dispatch
 .call_interp_inline:
     # Shared escape hatch for the cases that need C++ help to build the
     # inline frame correctly but can still stay in the asm-managed inline-frame
@@ -2470,9 +2589,8 @@ handler Call
     # the argument Value array.
     lea value_tail, [frame_base, SIZEOF_EXECUTION_CONTEXT]
     # For natives, argument_count and "registers+..." total are both just
-    # the call-site argument count: there are no registers, locals, or
-    # constants.
-    store_pair32 [frame_base, EXECUTION_CONTEXT_REGISTERS_AND_CONSTANTS_AND_LOCALS_AND_ARGUMENTS_COUNT], [frame_base, EXECUTION_CONTEXT_ARGUMENT_COUNT], arg_count, arg_count
+    # the call-site argument count: there are no registers or locals.
+    store_pair32 [frame_base, EXECUTION_CONTEXT_REGISTERS_AND_LOCALS_AND_ARGUMENTS_COUNT], [frame_base, EXECUTION_CONTEXT_ARGUMENT_COUNT], arg_count, arg_count
     store32 [frame_base, EXECUTION_CONTEXT_PASSED_ARGUMENT_COUNT], arg_count
 
     # Shape stores a Realm pointer; use it as the callee EC realm.
@@ -2543,11 +2661,22 @@ handler Call
 .copy_native_arguments_loop:
     branch_ge_unsigned arg_idx, arg_count, .enter_raw_native
     load32 arg_value, [arg_ops, arg_idx, 4]
+    branch_bits_set arg_value, OPERAND_CONSTANT_POOL_BIT, .copy_native_constant_argument
     load64 arg_value, [scratch, arg_value, 8]
+.store_native_argument:
     store64 [value_tail, arg_idx, 8], arg_value
     add arg_idx, 1
     jmp .copy_native_arguments_loop
 
+.copy_native_constant_argument:
+    and arg_value, OPERAND_CONSTANT_POOL_INDEX_MASK
+    load64 scratch, [exec_ctx, EXECUTION_CONTEXT_EXECUTABLE]
+    load64 scratch, [scratch, EXECUTABLE_CONSTANTS_DATA]
+    assert_nonzero scratch
+    load64 arg_value, [scratch, arg_value, 8]
+    lea scratch, [exec_ctx, SIZEOF_EXECUTION_CONTEXT]
+    jmp .store_native_argument
+
 .enter_raw_native:
     # Swap the running ExecutionContext over to the callee and point the
     # asm `values` register at its argument array. After this, we look like
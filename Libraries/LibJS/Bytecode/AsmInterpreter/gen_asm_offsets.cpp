@@ -54,6 +54,7 @@ int main()
     EMIT_OFFSET(OBJECT_NAMED_PROPERTIES, Object, m_named_properties);
     EMIT_OFFSET(OBJECT_INDEXED_ELEMENTS, Object, m_indexed_elements);
     EMIT_OFFSET(OBJECT_INDEXED_STORAGE_KIND, Object, m_indexed_storage_kind);
+    EMIT_OFFSET(OBJECT_INDEXED_ELEMENT_KIND, Object, m_indexed_element_kind);
     EMIT_OFFSET(OBJECT_INDEXED_ARRAY_LIKE_SIZE, Object, m_indexed_array_like_size);
     EMIT_SIZEOF(OBJECT_SIZE, Object);
 
@@ -90,6 +91,12 @@ int main()
     EMIT_OFFSET(PROPERTY_LOOKUP_CACHE_ENTRY_PROTOTYPE_CHAIN_VALIDITY, PropertyLookupCache::Entry, prototype_chain_validity);
     EMIT_SIZEOF(PROPERTY_LOOKUP_CACHE_ENTRY_SIZE, PropertyLookupCache::Entry);
 
+    // TypeFeedbackSlot layout
+    outln("\n# TypeFeedbackSlot layout");
+    EMIT_OFFSET(TYPE_FEEDBACK_SLOT_EXECUTION_COUNT, TypeFeedbackSlot, execution_count);
+    EMIT_SIZEOF(TYPE_FEEDBACK_SLOT_SIZE, TypeFeedbackSlot);
+    outln("const TYPE_FEEDBACK_WARMUP_THRESHOLD = {}", TypeFeedbackSlot::warmup_threshold);
+
     // ObjectPropertyIteratorCacheData layout
     outln("\n# ObjectPropertyIteratorCacheData layout");
     EMIT_OFFSET(OBJECT_PROPERTY_ITERATOR_CACHE_DATA_PROPERTIES, ObjectPropertyIteratorCacheData, m_properties);
@@ -126,9 +133,9 @@ int main()
     EMIT_OFFSET(EXECUTABLE_GLOBAL_VARIABLE_CACHES, Executable, global_variable_caches);
     EMIT_OFFSET(EXECUTABLE_ENVIRONMENT_COORDINATE_CACHES, Executable, environment_coordinate_caches);
     EMIT_OFFSET(EXECUTABLE_REGISTERS_AND_LOCALS_COUNT, Executable, registers_and_locals_count);
-    EMIT_OFFSET(EXECUTABLE_REGISTERS_AND_LOCALS_AND_CONSTANTS_COUNT, Executable, registers_and_locals_and_constants_count);
-    EMIT_OFFSET(EXECUTABLE_ASM_CONSTANTS_SIZE, Executable, asm_constants_size);
-    EMIT_OFFSET(EXECUTABLE_ASM_CONSTANTS_DATA, Executable, asm_constants_data);
+    EMIT_OFFSET(EXECUTABLE_CONSTANTS_DATA, Executable, constants_data);
+    EMIT_OFFSET(EXECUTABLE_CALL_COUNT, Executable, call_count);
+    EMIT_OFFSET(EXECUTABLE_BACK_EDGE_COUNT, Executable, back_edge_count);
 
     // ExecutionContext layout
     outln("\n# ExecutionContext layout");
@@ -151,7 +158,7 @@ int main()
     EMIT_OFFSET(EXECUTION_CONTEXT_CALLER_RETURN_PC, ExecutionContext, caller_return_pc);
     EMIT_OFFSET(EXECUTION_CONTEXT_CALLER_DST_RAW, ExecutionContext, caller_dst_raw);
     EMIT_OFFSET(EXECUTION_CONTEXT_PROGRAM_COUNTER, ExecutionContext, program_counter);
-    EMIT_OFFSET(EXECUTION_CONTEXT_REGISTERS_AND_CONSTANTS_AND_LOCALS_AND_ARGUMENTS_COUNT, ExecutionContext, registers_and_constants_and_locals_and_arguments_count);
+    EMIT_OFFSET(EXECUTION_CONTEXT_REGISTERS_AND_LOCALS_AND_ARGUMENTS_COUNT, ExecutionContext, registers_and_locals_and_arguments_count);
     EMIT_OFFSET(EXECUTION_CONTEXT_ARGUMENT_COUNT, ExecutionContext, argument_count);
     EMIT_SIZEOF(SIZEOF_EXECUTION_CONTEXT, ExecutionContext);
     outln("const ALIGNOF_EXECUTION_CONTEXT = {}", alignof(ExecutionContext));
@@ -175,6 +182,7 @@ int main()
     EMIT_OFFSET(VM_INTERPRETER_STACK, VM, m_interpreter_stack);
     EMIT_OFFSET(VM_STACK_INFO, VM, m_stack_info);
     EMIT_OFFSET(VM_EXECUTION_GENERATION, VM, m_execution_generation);
+    EMIT_OFFSET(VM_PROFILER_SAMPLE_REQUESTED, VM, m_profiler_sample_requested);
     outln("const VM_INTERPRETER_STACK_TOP = {}", offsetof(VM, m_interpreter_stack) + offsetof(InterpreterStack, m_top));
 #if defined(HAS_ADDRESS_SANITIZER)
     outln("const VM_STACK_SPACE_LIMIT = {}", 96 * KiB);
@@ -193,6 +201,12 @@ int main()
     outln("const INDEXED_STORAGE_KIND_HOLEY = {}", static_cast<u8>(IndexedStorageKind::Holey));
     outln("const INDEXED_STORAGE_KIND_DICTIONARY = {}", static_cast<u8>(IndexedStorageKind::Dictionary));
 
+    // IndexedElementKind enum values
+    outln("\n# IndexedElementKind enum values");
+    outln("const INDEXED_ELEMENT_KIND_INT32 = {}", static_cast<u8>(IndexedElementKind::Int32));
+    outln("const INDEXED_ELEMENT_KIND_DOUBLE = {}", static_cast<u8>(IndexedElementKind::Double));
+    outln("const INDEXED_ELEMENT_KIND_ANY = {}", static_cast<u8>(IndexedElementKind::Any));
+
     // ObjectPropertyIteratorFastPath enum values
     outln("\n# ObjectPropertyIteratorFastPath enum values");
     outln("const OBJECT_PROPERTY_ITERATOR_FAST_PATH_NONE = {}", static_cast<u8>(ObjectPropertyIteratorFastPath::None));
@@ -214,8 +228,7 @@ int main()
         outln("const EXECUTABLE_PROPERTY_LOOKUP_CACHES_DATA = {}", offsetof(Executable, property_lookup_caches) + vec_data);
         outln("const EXECUTABLE_GLOBAL_VARIABLE_CACHES_DATA = {}", offsetof(Executable, global_variable_caches) + vec_data);
         outln("const EXECUTABLE_ENVIRONMENT_COORDINATE_CACHES_DATA = {}", offsetof(Executable, environment_coordinate_caches) + vec_data);
-        outln("const EXECUTABLE_CONSTANTS_DATA = {}", offsetof(Executable, constants) + vec_data);
-        outln("const EXECUTABLE_CONSTANTS_SIZE = {}", offsetof(Executable, constants) + vec_size);
+        outln("const EXECUTABLE_TYPE_FEEDBACK_SLOTS_DATA = {}", offsetof(Executable, type_feedback_slots) + vec_data);
         outln("const OBJECT_PROPERTY_ITERATOR_CACHE_DATA_PROPERTY_VALUES_DATA = {}", offsetof(ObjectPropertyIteratorCacheData, m_property_values) + vec_data);
         outln("const OBJECT_PROPERTY_ITERATOR_CACHE_DATA_PROPERTY_VALUES_SIZE = {}", offsetof(ObjectPropertyIteratorCacheData, m_property_values) + vec_size);
     }
@@ -414,6 +427,8 @@ int main()
     outln("const RETURN_VALUE_REG_OFFSET = {}", static_cast<size_t>(Register::return_value().index()) * sizeof(Value));
     outln("const SAVED_LEXICAL_ENVIRONMENT_REG_OFFSET = {}", static_cast<size_t>(Register::saved_lexical_environment().index()) * sizeof(Value));
     outln("const RESERVED_REGISTERS_SIZE = {}", static_cast<size_t>(Register::reserved_register_count) * sizeof(Value));
+    outln("const OPERAND_CONSTANT_POOL_BIT = 0x{:X}", Operand::constant_pool_bit);
+    outln("const OPERAND_CONSTANT_POOL_INDEX_MASK = 0x{:X}", ~Operand::constant_pool_bit);
 
     return 0;
 }
@@ -69,6 +69,40 @@ size_t InstructionStream::external_memory_size() const
         });
 }
 
+SourceMap::SourceMap(Vector<SourceMapEntry> entries)
+    : m_storage(move(entries))
+{
+    auto const& owned_entries = m_storage.get<Vector<SourceMapEntry>>();
+    m_data = owned_entries.data();
+    m_size = owned_entries.size();
+}
+
+SourceMap::SourceMap(Core::ImmutableBytes blob, size_t offset, size_t count)
+    : m_storage(move(blob))
+{
+    auto bytes = m_storage.get<Core::ImmutableBytes>().bytes();
+    VERIFY(offset <= bytes.size());
+    VERIFY(count <= (bytes.size() - offset) / sizeof(SourceMapEntry));
+    if (count == 0)
+        return;
+    auto const* data = bytes.data() + offset;
+    VERIFY(reinterpret_cast<FlatPtr>(data) % alignof(SourceMapEntry) == 0);
+    m_data = reinterpret_cast<SourceMapEntry const*>(data);
+    m_size = count;
+}
+
+size_t SourceMap::external_memory_size() const
+{
+    return m_storage.visit(
+        [](Vector<SourceMapEntry> const& entries) -> size_t {
+            return vector_external_memory_size(entries);
+        },
+        [](Core::ImmutableBytes const&) -> size_t {
+            // The blob is accounted for by the instruction stream that shares it.
+            return 0;
+        });
+}
+
 static_assert(alignof(PropertyLookupCache::MonomorphicData) > PropertyLookupCache::polymorphic_data_tag);
 static_assert(alignof(PropertyLookupCache::PolymorphicData) > PropertyLookupCache::polymorphic_data_tag);
 static_assert(offsetof(PropertyLookupCache::MonomorphicData, entry) == 0);
@@ -284,6 +318,7 @@ Executable::Executable(
     size_t number_of_template_object_caches,
     size_t number_of_object_shape_caches,
     size_t number_of_object_property_iterator_caches,
+    size_t number_of_type_feedback_slots,
     size_t number_of_registers,
     Strict strict)
     : GC::WeakContainer(heap())
@@ -305,8 +340,8 @@ Executable::Executable(
         template_object_caches.append(heap().allocate<TemplateObjectCache>());
     object_shape_caches.resize(number_of_object_shape_caches);
     object_property_iterator_caches.resize(number_of_object_property_iterator_caches);
-    asm_constants_size = this->constants.size();
-    asm_constants_data = this->constants.data();
+    type_feedback_slots.resize(number_of_type_feedback_slots);
+    constants_data = this->constants.data();
 }
 
 Executable::~Executable() = default;
@@ -603,6 +638,9 @@ void Executable::copy_runtime_caches_from(Executable const& other)
         for (size_t i = 0; i < object_property_iterator_caches.size(); ++i)
             object_property_iterator_caches[i].data = other.object_property_iterator_caches[i].data;
     }
+
+    // NB: Type feedback is not copied. The new bytecode starts out unquickened, and a slot that
+    //     has already finished warming up would never quicken it again.
 }
 
 size_t Executable::external_memory_size() const
@@ -618,6 +656,7 @@ size_t Executable::external_memory_size() const
     for (auto const& cache : object_shape_caches)
         size = saturating_add_external_memory_size(size, vector_external_memory_size(cache.property_offsets));
     size = saturating_add_external_memory_size(size, vector_external_memory_size(object_property_iterator_caches));
+    size = saturating_add_external_memory_size(size, vector_external_memory_size(type_feedback_slots));
     size = saturating_add_external_memory_size(size, string_table->external_memory_size());
     size = saturating_add_external_memory_size(size, identifier_table->external_memory_size());
     size = saturating_add_external_memory_size(size, property_key_table->external_memory_size());
@@ -628,7 +667,7 @@ size_t Executable::external_memory_size() const
     for (auto const& blueprint : class_blueprints)
         size = saturating_add_external_memory_size(size, vector_external_memory_size(blueprint.elements));
     size = saturating_add_external_memory_size(size, vector_external_memory_size(exception_handlers));
-    size = saturating_add_external_memory_size(size, vector_external_memory_size(source_map));
+    size = saturating_add_external_memory_size(size, source_map.external_memory_size());
     size = saturating_add_external_memory_size(size, vector_external_memory_size(local_variable_names));
     size = saturating_add_external_memory_size(size, hash_map_external_memory_size(m_source_range_cache));
     return size;
@@ -739,13 +778,13 @@ SourceRange const& Executable::get_source_range(u32 program_counter)
 
 Operand Executable::original_operand_from_raw(u32 raw) const
 {
-    // NB: Layout is [registers | locals | constants | arguments]
+    // NB: Layout is [registers | locals | arguments]; constants are tagged indices into the constant pool.
+    if (raw & Operand::constant_pool_bit)
+        return Operand { Operand::Type::Constant, raw & ~Operand::constant_pool_bit };
     if (raw < number_of_registers)
         return Operand { Operand::Type::Register, raw };
     if (raw < registers_and_locals_count)
         return Operand { Operand::Type::Local, raw - local_index_base };
-    if (raw < argument_index_base)
-        return Operand { Operand::Type::Constant, raw - registers_and_locals_count };
     return Operand { Operand::Type::Argument, raw - argument_index_base };
 }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/EnumBits.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
@@ -45,6 +46,9 @@ public:
     [[nodiscard]] size_t external_memory_size() const;
     [[nodiscard]] u8 operator[](size_t index) const { return m_data[index]; }
 
+    // Owned streams can be quickened in place. Cache-backed streams are mapped read-only, so this returns null for them.
+    [[nodiscard]] u8* writable_data() LIFETIME_BOUND { return m_storage.has<Vector<u8>>() ? const_cast<u8*>(m_data) : nullptr; }
+
     operator ReadonlyBytes() const LIFETIME_BOUND { return span(); }
 
     static constexpr size_t data_member_offset() { return offsetof(InstructionStream, m_data); }
@@ -261,12 +265,56 @@ struct ObjectPropertyIteratorCache {
     GC::Ptr<Object> reusable_property_name_iterator;
 };
 
+// Kinds of operands a quickenable instruction has seen.
+enum class ObservedType : u8 {
+    None = 0,
+    Int32 = 1 << 0,
+    Double = 1 << 1,
+    String = 1 << 2,
+    PackedArray = 1 << 3,
+    Object = 1 << 4,
+    Other = 1 << 5,
+};
+
+AK_ENUM_BITWISE_OPERATORS(ObservedType);
+
+// Per-instruction type feedback for quickenable instructions, see TypeFeedback.h.
+struct TypeFeedbackSlot {
+    static constexpr u8 warmup_threshold = 16;
+
+    ObservedType observed_types { ObservedType::None };
+    u8 execution_count { 0 };
+};
+
 struct SourceMapEntry {
     u32 bytecode_offset {};
     u32 line {};
     u32 column {};
 };
 
+// Source map entries sorted by bytecode offset. Like the instruction stream, they are either owned or used in place
+// from a bytecode cache blob.
+class SourceMap {
+public:
+    SourceMap() = default;
+    explicit SourceMap(Vector<SourceMapEntry>);
+    SourceMap(Core::ImmutableBytes, size_t offset, size_t count);
+
+    [[nodiscard]] ReadonlySpan<SourceMapEntry> span() const LIFETIME_BOUND { return { m_data, m_size }; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+    [[nodiscard]] size_t external_memory_size() const;
+    [[nodiscard]] SourceMapEntry const& operator[](size_t index) const LIFETIME_BOUND { return span()[index]; }
+
+    [[nodiscard]] SourceMapEntry const* begin() const LIFETIME_BOUND { return m_data; }
+    [[nodiscard]] SourceMapEntry const* end() const LIFETIME_BOUND { return m_data + m_size; }
+
+private:
+    Variant<Vector<SourceMapEntry>, Core::ImmutableBytes> m_storage;
+    SourceMapEntry const* m_data { nullptr };
+    size_t m_size { 0 };
+};
+
 class JS_API Executable final
     : public Cell
     , public GC::WeakContainer {
@@ -288,6 +336,7 @@ public:
         size_t number_of_template_object_caches,
         size_t number_of_object_shape_caches,
         size_t number_of_object_property_iterator_caches,
+        size_t number_of_type_feedback_slots,
         size_t number_of_registers,
         Strict);
 
@@ -301,6 +350,7 @@ public:
     Vector<GC::Ref<TemplateObjectCache>> template_object_caches;
     Vector<ObjectShapeCache> object_shape_caches;
     Vector<ObjectPropertyIteratorCache> object_property_iterator_caches;
+    Vector<TypeFeedbackSlot> type_feedback_slots;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<PropertyKeyTable> property_key_table;
@@ -316,9 +366,16 @@ public:
     bool is_strict_mode { false };
 
     u32 registers_and_locals_count { 0 };
-    u32 registers_and_locals_and_constants_count { 0 };
-    size_t asm_constants_size { 0 };
-    Value const* asm_constants_data { nullptr };
+
+    // Cached constants.data(), read by both interpreters when an operand refers to the constant pool.
+    Value const* constants_data { nullptr };
+
+    // Hotness counters. Both interpreters bump call_count on frame entry and
+    // back_edge_count on every taken backward jump (i.e. loop iteration).
+    // Bytecode flushing uses call_count to tell whether a function has run
+    // since the last time it was aged.
+    u32 call_count { 0 };
+    u32 back_edge_count { 0 };
 
     struct ExceptionHandlers {
         size_t start_offset;
@@ -328,7 +385,7 @@ public:
 
     Vector<ExceptionHandlers> exception_handlers;
 
-    Vector<SourceMapEntry> source_map;
+    SourceMap source_map;
 
     Vector<LocalVariable> local_variable_names;
     u32 local_index_base { 0 };
@@ -90,6 +90,9 @@ public:
     Strict strict() const { return m_strict; }
     void set_strict(Strict strict) { m_strict = strict; }
 
+    // Only for quickening, which switches between opcodes that share a layout.
+    void set_type(Type type) { m_type = type; }
+
 protected:
     explicit Instruction(Type type)
         : m_type(type)
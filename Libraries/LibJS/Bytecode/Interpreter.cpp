@@ -21,6 +21,7 @@
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/PropertyAccess.h>
 #include <LibJS/Bytecode/PropertyNameIterator.h>
+#include <LibJS/Bytecode/TypeFeedback.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
@@ -115,7 +116,7 @@ ThrowCompletionOr<Value> VM::run(Script& script_record, GC::Ptr<Environment> lex
     // 1. Let globalEnv be scriptRecord.[[Realm]].[[GlobalEnv]].
     auto& global_environment = script_record.realm().global_environment();
 
-    // NOTE: Spec steps are rearranged in order to compute number of registers+constants+locals before construction of the execution context.
+    // NOTE: Spec steps are rearranged in order to compute number of registers+locals before construction of the execution context.
 
     // 12. Let result be Completion(GlobalDeclarationInstantiation(script, globalEnv)).
     auto instantiation_result = script_record.global_declaration_instantiation(vm, global_environment);
@@ -127,16 +128,13 @@ ThrowCompletionOr<Value> VM::run(Script& script_record, GC::Ptr<Environment> lex
         executable->dump();
 
     u32 registers_and_locals_count = 0;
-    ReadonlySpan<Value> constants;
-    if (executable) {
+    if (executable)
         registers_and_locals_count = executable->registers_and_locals_count;
-        constants = executable->constants;
-    }
 
     // 2. Let scriptContext be a new ECMAScript code execution context.
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
-    auto* script_context = stack.allocate(registers_and_locals_count, constants, 0);
+    auto* script_context = stack.allocate(registers_and_locals_count, 0);
     if (!script_context) [[unlikely]]
         return vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
     ScopeGuard deallocate_guard = [&stack, stack_mark] { stack.deallocate(stack_mark); };
@@ -263,7 +261,7 @@ ExecutionContext* VM::push_inline_frame(
     size_t registers_and_locals_count = callee_executable.registers_and_locals_count;
     size_t argument_count = max(insn_argument_count, static_cast<u32>(callee_function.formal_parameter_count()));
 
-    auto* callee_context = stack.allocate(registers_and_locals_count, callee_executable.constants, argument_count);
+    auto* callee_context = stack.allocate(registers_and_locals_count, argument_count);
     if (!callee_context) [[unlikely]]
         return nullptr;
 
@@ -311,9 +309,12 @@ ExecutionContext* VM::push_inline_frame(
     //     and global_declarative_environment, since the caller's realm may differ
     //     in cross-realm calls (e.g. iframe <-> parent).
     callee_context->executable = callee_executable;
+    ++callee_executable.call_count;
+    if (profiler_sample_requested()) [[unlikely]]
+        take_profiler_sample();
 
     // Set this value register.
-    auto* values = callee_context->registers_and_constants_and_locals_and_arguments();
+    auto* values = callee_context->registers_and_locals_and_arguments();
     values[Register::this_value().index()] = callee_context->this_value.value_or(js_special_empty_value());
 
     return callee_context;
@@ -370,8 +371,9 @@ NEVER_INLINE bool VM::try_inline_call_construct(Instruction const& insn, u32 cur
 
     u32 return_pc = current_pc + instruction.length();
 
+    // NB: get_prototype_from_constructor() can run arbitrary code (and GC, which may flush cold bytecode).
     auto* callee_context = push_inline_frame(
-        callee_function, *callee_function.bytecode_executable(),
+        callee_function, callee_function.ensure_bytecode_executable(),
         instruction.arguments(), return_pc, instruction.dst().raw(),
         this_argument, &callee_function, true);
 
@@ -408,7 +410,7 @@ NEVER_INLINE void VM::pop_inline_frame(Value return_value)
 
     m_running_execution_context = caller_frame;
     caller_frame->program_counter = caller_pc;
-    caller_frame->registers_and_constants_and_locals_and_arguments()[caller_dst_raw] = return_value;
+    caller_frame->registers_and_locals_and_arguments()[caller_dst_raw] = return_value;
 
     vm().finish_execution_generation();
 }
@@ -475,6 +477,22 @@ void VM::run_bytecode(size_t entry_point)
         goto start;                                                          \
     } while (0)
 
+// Take a jump. A target at or before the current instruction is a loop
+// back-edge, which bumps the executable's hotness counter.
+#define JUMP_TO(target_address)                                                     \
+    do {                                                                            \
+        u32 new_program_counter = (target_address);                                 \
+        if (new_program_counter <= program_counter) [[unlikely]] {                  \
+            ++m_running_execution_context->executable->back_edge_count;             \
+            if (profiler_sample_requested()) [[unlikely]] {                         \
+                m_running_execution_context->program_counter = new_program_counter; \
+                take_profiler_sample();                                             \
+            }                                                                       \
+        }                                                                           \
+        program_counter = new_program_counter;                                      \
+        goto start;                                                                 \
+    } while (0)
+
     bytecode = current_executable().bytecode.data();
     program_counter = entry_point;
 
@@ -520,44 +538,35 @@ void VM::run_bytecode(size_t entry_point)
 
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
-            program_counter = instruction.target().address();
-            goto start;
+            JUMP_TO(instruction.target().address());
         }
 
         handle_JumpIf: {
             auto& instruction = *reinterpret_cast<Op::JumpIf const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).to_boolean())
-                program_counter = instruction.true_target().address();
-            else
-                program_counter = instruction.false_target().address();
-            goto start;
+                JUMP_TO(instruction.true_target().address());
+            JUMP_TO(instruction.false_target().address());
         }
 
         handle_JumpTrue: {
             auto& instruction = *reinterpret_cast<Op::JumpTrue const*>(&bytecode[program_counter]);
-            if (get(instruction.condition()).to_boolean()) {
-                program_counter = instruction.target().address();
-                goto start;
-            }
+            if (get(instruction.condition()).to_boolean())
+                JUMP_TO(instruction.target().address());
             DISPATCH_NEXT(JumpTrue);
         }
 
         handle_JumpFalse: {
             auto& instruction = *reinterpret_cast<Op::JumpFalse const*>(&bytecode[program_counter]);
-            if (!get(instruction.condition()).to_boolean()) {
-                program_counter = instruction.target().address();
-                goto start;
-            }
+            if (!get(instruction.condition()).to_boolean())
+                JUMP_TO(instruction.target().address());
             DISPATCH_NEXT(JumpFalse);
         }
 
         handle_JumpNullish: {
             auto& instruction = *reinterpret_cast<Op::JumpNullish const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).is_nullish())
-                program_counter = instruction.true_target().address();
-            else
-                program_counter = instruction.false_target().address();
-            goto start;
+                JUMP_TO(instruction.true_target().address());
+            JUMP_TO(instruction.false_target().address());
         }
 
 #define HANDLE_COMPARISON_OP(op_TitleCase, op_snake_case, numeric_operator)                                             \
@@ -573,8 +582,7 @@ void VM::run_bytecode(size_t entry_point)
             } else {                                                                                                    \
                 result = lhs.as_double() numeric_operator rhs.as_double();                                              \
             }                                                                                                           \
-            program_counter = result ? instruction.true_target().address() : instruction.false_target().address();      \
-            goto start;                                                                                                 \
+            JUMP_TO(result ? instruction.true_target().address() : instruction.false_target().address());               \
         }                                                                                                               \
         auto result = op_snake_case(vm(), get(instruction.lhs()), get(instruction.rhs()));                              \
         if (result.is_error()) [[unlikely]] {                                                                           \
@@ -583,10 +591,8 @@ void VM::run_bytecode(size_t entry_point)
             RELOAD_AND_GOTO_START();                                                                                    \
         }                                                                                                               \
         if (result.value())                                                                                             \
-            program_counter = instruction.true_target().address();                                                      \
-        else                                                                                                            \
-            program_counter = instruction.false_target().address();                                                     \
-        goto start;                                                                                                     \
+            JUMP_TO(instruction.true_target().address());                                                               \
+        JUMP_TO(instruction.false_target().address());                                                                  \
     }
 
             JS_ENUMERATE_COMPARISON_OPS(HANDLE_COMPARISON_OP)
@@ -595,10 +601,8 @@ void VM::run_bytecode(size_t entry_point)
         handle_JumpUndefined: {
             auto& instruction = *reinterpret_cast<Op::JumpUndefined const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).is_undefined())
-                program_counter = instruction.true_target().address();
-            else
-                program_counter = instruction.false_target().address();
-            goto start;
+                JUMP_TO(instruction.true_target().address());
+            JUMP_TO(instruction.false_target().address());
         }
 
 #define HANDLE_INSTRUCTION(name)                                                                                            \
@@ -625,6 +629,7 @@ void VM::run_bytecode(size_t entry_point)
     }
 
             HANDLE_INSTRUCTION(Add);
+            HANDLE_INSTRUCTION(AddInt32);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(AddPrivateName);
             HANDLE_INSTRUCTION(ArrayAppend);
             HANDLE_INSTRUCTION(BitwiseAnd);
@@ -692,6 +697,7 @@ void VM::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(GetById);
             HANDLE_INSTRUCTION(GetByIdWithThis);
             HANDLE_INSTRUCTION(GetByValue);
+            HANDLE_INSTRUCTION(GetByValuePackedArray);
             HANDLE_INSTRUCTION(GetByValueWithThis);
             HANDLE_INSTRUCTION(GetCalleeAndThisFromEnvironment);
             HANDLE_INSTRUCTION(DynamicGetCalleeAndThisFromEnvironment);
@@ -862,9 +868,11 @@ ThrowCompletionOr<Value> VM::run_executable(ExecutionContext& context, Executabl
     TemporaryChange restore_running_execution_context { m_running_execution_context, &context };
 
     context.executable = executable;
+    ++executable.call_count;
+    if (profiler_sample_requested()) [[unlikely]]
+        take_profiler_sample();
 
-    VERIFY(executable.registers_and_locals_count + executable.constants.size() == executable.registers_and_locals_and_constants_count);
-    VERIFY(executable.registers_and_locals_and_constants_count <= context.registers_and_constants_and_locals_and_arguments_span().size());
+    VERIFY(executable.registers_and_locals_count <= context.registers_and_locals_and_arguments_span().size());
 
     // NOTE: We only copy the `this` value from ExecutionContext if it's not already set.
     //       If we are re-entering an async/generator context, the `this` value
@@ -878,7 +886,7 @@ ThrowCompletionOr<Value> VM::run_executable(ExecutionContext& context, Executabl
     dbgln_if(JS_BYTECODE_DEBUG, "VM did run bytecode unit {}", context.executable);
 
     if constexpr (JS_BYTECODE_DEBUG) {
-        auto* values = context.registers_and_constants_and_locals_and_arguments();
+        auto* values = context.registers_and_locals_and_arguments();
         for (size_t i = 0; i < executable.number_of_registers; ++i) {
             String value_string;
             if (values[i].is_special_empty_value())
@@ -1821,6 +1829,8 @@ ThrowCompletionOr<void> Add::execute_impl(VM& vm) const
     auto const lhs = vm.get(m_lhs);
     auto const rhs = vm.get(m_rhs);
 
+    record_type_feedback(vm.current_executable(), *this, m_type_feedback, observed_type_of(lhs) | observed_type_of(rhs));
+
     if (lhs.is_number() && rhs.is_number()) [[likely]] {
         if (lhs.is_int32() && rhs.is_int32()) {
             if (!Checked<i32>::addition_would_overflow(lhs.as_i32(), rhs.as_i32())) [[likely]] {
@@ -1839,6 +1849,22 @@ ThrowCompletionOr<void> Add::execute_impl(VM& vm) const
     return {};
 }
 
+ThrowCompletionOr<void> AddInt32::execute_impl(VM& vm) const
+{
+    auto const lhs = vm.get(m_lhs);
+    auto const rhs = vm.get(m_rhs);
+
+    if (lhs.is_int32() && rhs.is_int32()) [[likely]] {
+        if (!Checked<i32>::addition_would_overflow(lhs.as_i32(), rhs.as_i32())) [[likely]] {
+            vm.set(m_dst, Value(lhs.as_i32() + rhs.as_i32()));
+            return {};
+        }
+    }
+
+    deoptimize(vm.current_executable(), *this, Type::Add);
+    return reinterpret_cast<Add const&>(*this).execute_impl(vm);
+}
+
 ThrowCompletionOr<void> Mul::execute_impl(VM& vm) const
 {
     auto const lhs = vm.get(m_lhs);
@@ -2961,13 +2987,12 @@ NEVER_INLINE static ThrowCompletionOr<void> execute_call(
     auto& function = callee.as_function();
 
     size_t registers_and_locals_count = 0;
-    ReadonlySpan<Value> constants;
     size_t argument_count = arguments.size();
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    function.get_stack_frame_info(registers_and_locals_count, argument_count);
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
-    auto* callee_context = stack.allocate(registers_and_locals_count, constants, max(arguments.size(), argument_count));
+    auto* callee_context = stack.allocate(registers_and_locals_count, max(arguments.size(), argument_count));
     if (!callee_context) [[unlikely]]
         return vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
     ScopeGuard deallocate_guard = [&stack, stack_mark] { stack.deallocate(stack_mark); };
@@ -3125,12 +3150,11 @@ NEVER_INLINE static ThrowCompletionOr<void> call_with_argument_array(
 
     size_t argument_count = argument_array_length;
     size_t registers_and_locals_count = 0;
-    ReadonlySpan<Value> constants;
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    function.get_stack_frame_info(registers_and_locals_count, argument_count);
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
-    auto* callee_context = stack.allocate(registers_and_locals_count, constants, max(argument_array_length, argument_count));
+    auto* callee_context = stack.allocate(registers_and_locals_count, max(argument_array_length, argument_count));
     if (!callee_context) [[unlikely]]
         return vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
     ScopeGuard deallocate_guard = [&stack, stack_mark] { stack.deallocate(stack_mark); };
@@ -3210,12 +3234,11 @@ ThrowCompletionOr<void> SuperCallWithArgumentArray::execute_impl(VM& vm) const
 
     size_t argument_count = argument_array_length;
     size_t registers_and_locals_count = 0;
-    ReadonlySpan<Value> constants;
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    function.get_stack_frame_info(registers_and_locals_count, argument_count);
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
-    auto* callee_context = stack.allocate(registers_and_locals_count, constants, max(argument_array_length, argument_count));
+    auto* callee_context = stack.allocate(registers_and_locals_count, max(argument_array_length, argument_count));
     if (!callee_context) [[unlikely]]
         return vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
     ScopeGuard deallocate_guard = [&stack, stack_mark] { stack.deallocate(stack_mark); };
@@ -3435,10 +3458,26 @@ void Await::execute_impl(VM& vm) const
 
 ThrowCompletionOr<void> GetByValue::execute_impl(VM& vm) const
 {
-    vm.set(dst(), TRY(get_by_value(vm, m_base_identifier, vm.get(m_base), vm.get(m_property), vm.current_executable())));
+    auto base = vm.get(m_base);
+    auto property = vm.get(m_property);
+    record_type_feedback(vm.current_executable(), *this, m_type_feedback, observed_type_of_element_access(base, property));
+    vm.set(dst(), TRY(get_by_value(vm, m_base_identifier, base, property, vm.current_executable())));
     return {};
 }
 
+ThrowCompletionOr<void> GetByValuePackedArray::execute_impl(VM& vm) const
+{
+    auto base = vm.get(m_base);
+    auto property = vm.get(m_property);
+    if (is_packed_array_element_access(base, property)) [[likely]] {
+        vm.set(m_dst, base.as_object().indexed_packed_elements_span()[property.as_i32()]);
+        return {};
+    }
+
+    deoptimize(vm.current_executable(), *this, Type::GetByValue);
+    return reinterpret_cast<GetByValue const&>(*this).execute_impl(vm);
+}
+
 ThrowCompletionOr<void> GetByValueWithThis::execute_impl(VM& vm) const
 {
     auto property_key_value = vm.get(m_property);
@@ -45,6 +45,13 @@ public:
 
     [[nodiscard]] u32 raw() const { return m_raw; }
 
+    // NB: Once assembled, an operand is either a flat index into the running execution context's
+    //     [registers | locals | arguments] array, or an index into the executable's constant pool
+    //     tagged with constant_pool_bit. Constants are shared by every frame and never copied into one.
+    static constexpr u32 constant_pool_bit = 0x80000000u;
+    [[nodiscard]] bool refers_to_constant_pool() const { return m_raw & constant_pool_bit; }
+    [[nodiscard]] u32 constant_pool_index() const { return m_raw & ~constant_pool_bit; }
+
     [[nodiscard]] Register as_register() const;
 
     void offset_index_by(u32 offset)
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/TypeFeedback.h>
+
+namespace JS::Bytecode {
+
+static_assert(sizeof(Op::AddInt32) == sizeof(Op::Add));
+static_assert(sizeof(Op::GetByValuePackedArray) == sizeof(Op::GetByValue));
+
+ObservedType observed_type_of(Value value)
+{
+    if (value.is_int32())
+        return ObservedType::Int32;
+    if (value.is_number())
+        return ObservedType::Double;
+    if (value.is_string())
+        return ObservedType::String;
+    if (value.is_object())
+        return ObservedType::Object;
+    return ObservedType::Other;
+}
+
+ObservedType observed_type_of_element_access(Value base, Value property)
+{
+    if (is_packed_array_element_access(base, property))
+        return ObservedType::PackedArray;
+    return observed_type_of(base);
+}
+
+static Optional<Instruction::Type> quickened_type_for(Instruction::Type type, ObservedType observed_types)
+{
+    switch (type) {
+    case Instruction::Type::Add:
+        if (observed_types == ObservedType::Int32)
+            return Instruction::Type::AddInt32;
+        break;
+    case Instruction::Type::GetByValue:
+        if (observed_types == ObservedType::PackedArray)
+            return Instruction::Type::GetByValuePackedArray;
+        break;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+    return {};
+}
+
+static void rewrite_instruction_type(Executable& executable, Instruction const& instruction, Instruction::Type type)
+{
+    auto* data = executable.bytecode.writable_data();
+    VERIFY(data);
+    auto offset = reinterpret_cast<u8 const*>(&instruction) - executable.bytecode.data();
+    VERIFY(offset >= 0 && static_cast<size_t>(offset) < executable.bytecode.size());
+    reinterpret_cast<Instruction*>(data + offset)->set_type(type);
+}
+
+void record_type_feedback(Executable& executable, Instruction const& instruction, u32 type_feedback_slot, ObservedType observed_type)
+{
+    auto& slot = executable.type_feedback_slots[type_feedback_slot];
+    slot.observed_types |= observed_type;
+    if (slot.execution_count >= TypeFeedbackSlot::warmup_threshold)
+        return;
+    if (++slot.execution_count < TypeFeedbackSlot::warmup_threshold)
+        return;
+
+    if (!executable.bytecode.writable_data())
+        return;
+    if (auto quickened_type = quickened_type_for(instruction.type(), slot.observed_types); quickened_type.has_value())
+        rewrite_instruction_type(executable, instruction, *quickened_type);
+}
+
+void deoptimize(Executable& executable, Instruction const& instruction, Instruction::Type generic_type)
+{
+    rewrite_instruction_type(executable, instruction, generic_type);
+}
+
+}
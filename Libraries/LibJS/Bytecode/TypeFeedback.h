@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS::Bytecode {
+
+// Quickening rewrites a hot instruction in place into a specialized variant once its
+// type feedback slot has warmed up having seen a single kind of operand:
+//
+//   Add        -> AddInt32               (both operands were int32)
+//   GetByValue -> GetByValuePackedArray  (in-bounds int32 index into a packed array)
+//
+// A variant has the same layout as its generic instruction, so only the opcode byte
+// changes. It guards its assumption and deoptimizes on a miss by rewriting itself
+// back to the generic instruction. A slot is considered for quickening exactly once,
+// when it finishes warming up, so a polymorphic site settles on the generic
+// instruction instead of flip-flopping.
+
+[[nodiscard]] ObservedType observed_type_of(Value);
+[[nodiscard]] ObservedType observed_type_of_element_access(Value base, Value property);
+
+[[nodiscard]] ALWAYS_INLINE bool is_packed_array_element_access(Value base, Value property)
+{
+    if (!base.is_object() || !property.is_non_negative_int32())
+        return false;
+    auto const& object = base.as_object();
+    return !object.is_typed_array()
+        && !object.may_interfere_with_indexed_property_access()
+        && object.indexed_storage_kind() == IndexedStorageKind::Packed
+        && static_cast<u32>(property.as_i32()) < object.indexed_array_like_size();
+}
+
+// Called whenever a quickenable instruction runs in its generic form.
+void record_type_feedback(Executable&, Instruction const&, u32 type_feedback_slot, ObservedType);
+
+// Rewrites a quickened instruction back into its generic form.
+void deoptimize(Executable&, Instruction const&, Instruction::Type generic_type);
+
+}
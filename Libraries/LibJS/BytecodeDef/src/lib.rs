@@ -143,7 +143,8 @@ pub fn field_type_info(ty: &str) -> FieldType {
         | "EnvironmentCoordinateCacheIndex"
         | "TemplateObjectCacheIndex"
         | "ObjectShapeCacheIndex"
-        | "ObjectPropertyIteratorCacheIndex" => ("u32", 4, 4, "u32"),
+        | "ObjectPropertyIteratorCacheIndex"
+        | "TypeFeedbackSlotIndex" => ("u32", 4, 4, "u32"),
         _ => unreachable!("Unknown field type: {ty}"),
     }
     .into()
@@ -207,6 +207,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class Script;
 class Shape;
 class SharedFunctionInstanceData;
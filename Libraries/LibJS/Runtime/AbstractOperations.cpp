@@ -64,13 +64,12 @@ ThrowCompletionOr<Value> call_impl(VM& vm, Value function, Value this_value, Rea
     // 3. Return ? F.[[Call]](V, argumentsList).
     auto& function_object = function.as_function();
     size_t registers_and_locals_count = 0;
-    ReadonlySpan<Value> constants;
     size_t argument_count = arguments_list.size();
-    function_object.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    function_object.get_stack_frame_info(registers_and_locals_count, argument_count);
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
-    auto* callee_context = stack.allocate(registers_and_locals_count, constants, argument_count);
+    auto* callee_context = stack.allocate(registers_and_locals_count, argument_count);
     if (!callee_context) [[unlikely]]
         return vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
     ScopeGuard deallocate_guard = [&stack, stack_mark] { stack.deallocate(stack_mark); };
@@ -94,13 +93,12 @@ ThrowCompletionOr<Value> call_impl(VM& vm, FunctionObject& function, Value this_
 
     // 3. Return ? F.[[Call]](V, argumentsList).
     size_t registers_and_locals_count = 0;
-    ReadonlySpan<Value> constants;
     size_t argument_count = arguments_list.size();
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    function.get_stack_frame_info(registers_and_locals_count, argument_count);
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
-    auto* callee_context = stack.allocate(registers_and_locals_count, constants, argument_count);
+    auto* callee_context = stack.allocate(registers_and_locals_count, argument_count);
     if (!callee_context) [[unlikely]]
         return vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
     ScopeGuard deallocate_guard = [&stack, stack_mark] { stack.deallocate(stack_mark); };
@@ -126,13 +124,12 @@ ThrowCompletionOr<GC::Ref<Object>> construct_impl(VM& vm, FunctionObject& functi
 
     // 3. Return ? F.[[Construct]](argumentsList, newTarget).
     size_t registers_and_locals_count = 0;
-    ReadonlySpan<Value> constants;
     size_t argument_count = arguments_list.size();
-    function.get_stack_frame_info(registers_and_locals_count, constants, argument_count);
+    function.get_stack_frame_info(registers_and_locals_count, argument_count);
 
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
-    auto* callee_context = stack.allocate(registers_and_locals_count, constants, argument_count);
+    auto* callee_context = stack.allocate(registers_and_locals_count, argument_count);
     if (!callee_context) [[unlikely]]
         return vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
     ScopeGuard deallocate_guard = [&stack, stack_mark] { stack.deallocate(stack_mark); };
@@ -728,7 +725,7 @@ ThrowCompletionOr<Value> perform_eval(VM& vm, Value x, CallerMode strict_caller,
     // 21. If runningContext is not already suspended, suspend runningContext.
     // NOTE: Done by the push on step 29.
 
-    // NOTE: Spec steps are rearranged in order to compute number of registers+constants+locals before construction of the execution context.
+    // NOTE: Spec steps are rearranged in order to compute number of registers+locals before construction of the execution context.
 
     // 30. Let result be Completion(EvalDeclarationInstantiation(body, varEnv, lexEnv, privateEnv, strictEval)).
     TRY(eval_declaration_instantiation(vm, eval_declaration_data, variable_environment, lexical_environment, private_environment, strict_eval));
@@ -739,7 +736,7 @@ ThrowCompletionOr<Value> perform_eval(VM& vm, Value x, CallerMode strict_caller,
     // 22. Let evalContext be a new ECMAScript code execution context.
     auto& stack = vm.interpreter_stack();
     auto* stack_mark = stack.top();
-    auto* eval_context = stack.allocate(executable->registers_and_locals_count, executable->constants, 0);
+    auto* eval_context = stack.allocate(executable->registers_and_locals_count, 0);
     if (!eval_context) [[unlikely]]
         return vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
 
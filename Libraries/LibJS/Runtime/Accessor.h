@@ -18,6 +18,8 @@ class Accessor final : public Cell {
     GC_DECLARE_ALLOCATOR(Accessor);
 
 public:
+    static constexpr bool CAN_BE_SWEPT_CONCURRENTLY = true;
+
     static GC::Ref<Accessor> create(VM& vm, FunctionObject* getter, FunctionObject* setter)
     {
         return vm.heap().allocate<Accessor>(getter, setter);
@@ -169,14 +169,23 @@ ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_des
 }
 
 // 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
-ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes, SortCompareKind sort_compare_kind)
 {
     // 1. Let items be a new empty List.
     GC::RootVector<Value> items;
 
+    // OPTIMIZATION: A simple packed array has an own data property at every index below its size, so both hole modes
+    //               read every element in order and neither HasProperty nor Get can run user code.
+    size_t k = 0;
+    if (auto const* array = as_if<Array>(object); array && array->is_simple_packed_array()) {
+        auto elements = array->indexed_packed_elements_span();
+        k = min<size_t>(length, elements.size());
+        items.append(elements.data(), k);
+    }
+
     // 2. Let k be 0.
     // 3. Repeat, while k < len,
-    for (size_t k = 0; k < length; ++k) {
+    for (; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -210,11 +219,9 @@ ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object
 
     // 4. Sort items using an implementation-defined sequence of calls to SortCompare. If any such call returns an abrupt completion, stop before performing any further calls to SortCompare or steps in this algorithm and return that Completion Record.
 
-    // Perform sorting by merge sort. This isn't as efficient compared to quick sort, but
-    // quicksort can't be used in all cases because the spec requires Array.prototype.sort()
-    // to be stable. FIXME: when initially scanning through the array, maintain a flag
-    // for if an unstable sort would be indistinguishable from a stable sort (such as just
-    // just strings or numbers), and in that case use quick sort instead for better performance.
+    // Perform sorting by a stable adaptive merge sort, as the spec requires Array.prototype.sort() to be stable.
+    if (sort_compare_kind == SortCompareKind::DefaultArrayCompare && array_sort_with_specialized_default_compare(items))
+        return items;
     TRY(array_merge_sort(vm, sort_compare, items));
 
     // 5. Return items.
@@ -94,7 +94,14 @@ enum class Holes {
     ReadThroughHoles,
 };
 
-ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes);
+// Tells SortIndexedProperties that SortCompare is CompareArrayElements with an undefined comparefn,
+// so it may sort with an equivalent specialized comparison instead of calling SortCompare.
+enum class SortCompareKind {
+    Custom,
+    DefaultArrayCompare,
+};
+
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes, SortCompareKind = SortCompareKind::Custom);
 ThrowCompletionOr<double> compare_array_elements(VM&, Value x, Value y, FunctionObject* comparefn);
 
 }
@@ -7,6 +7,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
+#include <AK/Array.h>
 #include <AK/Function.h>
 #include <AK/HashTable.h>
 #include <AK/ScopeGuard.h>
@@ -181,6 +183,58 @@ static Array* fast_array_species_result(Object& object)
     return array;
 }
 
+// Performs HasProperty(O, Pk) followed by Get(O, Pk), returning an empty Optional if the property is not present.
+static ThrowCompletionOr<Optional<Value>> get_indexed_property_if_present(Object const& object, size_t index)
+{
+    // OPTIMIZATION: Packed storage holds an own data property with default attributes at every index below its size,
+    // so HasProperty is true and Get returns the stored value without consulting the prototype chain or running
+    // user code. This is re-checked on every call, as callbacks may reshape, shrink or proxy the array in between.
+    if (auto const* array = as_if<Array>(object); array && array->is_simple_packed_array() && index < array->indexed_array_like_size())
+        return array->indexed_packed_elements_span()[index];
+
+    auto property_key = PropertyKey { index };
+    if (!TRY(object.has_property(property_key)))
+        return Optional<Value> {};
+    return TRY(object.get(property_key));
+}
+
+// Packed storage with a numeric element kind only holds Numbers, so IsStrictlyEqual and SameValueZero reduce to
+// plain numeric comparisons, and non-Number search values can never match.
+static Optional<size_t> find_number_in_numeric_elements(ReadonlySpan<Value> elements, IndexedElementKind element_kind, size_t start, Value search_element, bool nan_matches_nan)
+{
+    VERIFY(element_kind != IndexedElementKind::Any);
+    if (!search_element.is_number())
+        return {};
+
+    auto needle = search_element.as_double();
+    if (isnan(needle)) {
+        if (!nan_matches_nan || element_kind == IndexedElementKind::Int32)
+            return {};
+        for (size_t k = start; k < elements.size(); ++k) {
+            if (elements[k].is_nan())
+                return k;
+        }
+        return {};
+    }
+
+    if (element_kind == IndexedElementKind::Int32) {
+        if (needle < NumericLimits<i32>::min() || needle > NumericLimits<i32>::max() || trunc(needle) != needle)
+            return {};
+        auto needle_i32 = static_cast<i32>(needle);
+        for (size_t k = start; k < elements.size(); ++k) {
+            if (elements[k].as_i32() == needle_i32)
+                return k;
+        }
+        return {};
+    }
+
+    for (size_t k = start; k < elements.size(); ++k) {
+        if (elements[k].as_double() == needle)
+            return k;
+    }
+    return {};
+}
+
 // 23.1.3.1 Array.prototype.at ( index ), https://tc39.es/ecma262/#sec-array.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::at)
 {
@@ -456,6 +510,14 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::fill)
     else
         to = min(relative_end, length);
 
+    // OPTIMIZATION: Every index of a simple packed array is an own writable data property, so Set() just overwrites
+    //               the stored value. The length is re-checked here as ToIntegerOrInfinity() above may have run user code.
+    if (auto* array = as_if<Array>(*this_object); array && array->is_simple_packed_array() && array->indexed_array_like_size() == length) {
+        for (u64 i = from; i < to; i++)
+            array->indexed_put(i, vm.argument(0));
+        return this_object;
+    }
+
     for (u64 i = from; i < to; i++)
         TRY(this_object->set(i, vm.argument(0), Object::ShouldThrowExceptions::Yes));
 
@@ -819,6 +881,15 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Simple packed arrays have an own data property for every index below their length, and a numeric
+    //               element kind lets us compare against the raw numbers without going through Get.
+    if (auto* array = as_if<Array>(*this_object); array && array->is_simple_packed_array() && array->indexed_array_like_size() == length
+        && array->indexed_element_kind() != IndexedElementKind::Any) {
+        auto elements = array->indexed_packed_elements_span();
+        return Value(find_number_in_numeric_elements(elements, array->indexed_element_kind(), from_index, value_to_find, true).has_value());
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -876,6 +947,11 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
     // so HasProperty and Get cannot produce side effects or observe prototype indexed properties.
     if (auto* array = as_if<Array>(*object); array && array->is_simple_packed_array() && array->indexed_array_like_size() == length) {
         auto elements = array->indexed_packed_elements_span();
+        if (array->indexed_element_kind() != IndexedElementKind::Any) {
+            if (auto index = find_number_in_numeric_elements(elements, array->indexed_element_kind(), k, search_element, false); index.has_value())
+                return Value(*index);
+            return Value(-1);
+        }
         for (; k < elements.size(); ++k) {
             if (is_strictly_equal(search_element, elements[k]))
                 return Value(k);
@@ -1044,21 +1120,21 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
     // 6. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
-
         // c. If kPresent is true, then
-        if (k_present) {
-            // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
-
+        //    i. Let kValue be ? Get(O, Pk).
+        auto k_value = TRY(get_indexed_property_if_present(object, k));
+        if (k_value.has_value()) {
             // ii. Let mappedValue be ? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »).
-            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object));
+            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, *k_value, Value(k), object));
 
             // iii. Perform ? CreateDataPropertyOrThrow(A, Pk, mappedValue).
-            TRY(array->create_data_property_or_throw(property_key, mapped_value));
+            // OPTIMIZATION: An extensible array with writable length and plain indexed storage accepts the new element
+            //               unconditionally. The callback may have been handed A by a species constructor, so re-check.
+            if (auto* result_array = fast_array_species_result(*array))
+                result_array->indexed_put(k, mapped_value);
+            else
+                TRY(array->create_data_property_or_throw(k, mapped_value));
         }
 
         // d. Set k to k + 1.
@@ -1162,16 +1238,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::reduce)
         // b. Repeat, while kPresent is false and k < len,
         for (; !k_present && k < length; ++k) {
             // i. Let Pk be ! ToString(𝔽(k)).
-            auto property_key = PropertyKey { k };
-
             // ii. Set kPresent to ? HasProperty(O, Pk).
-            k_present = TRY(object->has_property(property_key));
-
             // iii. If kPresent is true, then
-            if (k_present) {
-                // 1. Set accumulator to ? Get(O, Pk).
-                accumulator = TRY(object->get(property_key));
-            }
+            //      1. Set accumulator to ? Get(O, Pk).
+            auto k_value = TRY(get_indexed_property_if_present(object, k));
+            k_present = k_value.has_value();
+            if (k_present)
+                accumulator = *k_value;
 
             // iv. Set k to k + 1.
         }
@@ -1184,18 +1257,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::reduce)
     // 9. Repeat, while k < len,
     for (; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
-
         // c. If kPresent is true, then
-        if (k_present) {
-            // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
-
+        //    i. Let kValue be ? Get(O, Pk).
+        auto k_value = TRY(get_indexed_property_if_present(object, k));
+        if (k_value.has_value()) {
             // ii. Set accumulator to ? Call(callbackfn, undefined, « accumulator, kValue, 𝔽(k), O »).
-            accumulator = TRY(call(vm, callback_function.as_function(), js_undefined(), accumulator, k_value, Value(k), object));
+            accumulator = TRY(call(vm, callback_function.as_function(), js_undefined(), accumulator, *k_value, Value(k), object));
         }
 
         // d. Set k to k + 1.
@@ -1244,16 +1312,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::reduce_right)
         // b. Repeat, while kPresent is false and k ≥ 0,
         for (; !k_present && k >= 0; --k) {
             // i. Let Pk be ! ToString(𝔽(k)).
-            auto property_key = PropertyKey { k };
-
             // ii. Set kPresent to ? HasProperty(O, Pk).
-            k_present = TRY(object->has_property(property_key));
-
             // iii. If kPresent is true, then
-            if (k_present) {
-                // 1. Set accumulator to ? Get(O, Pk).
-                accumulator = TRY(object->get(property_key));
-            }
+            //      1. Set accumulator to ? Get(O, Pk).
+            auto k_value = TRY(get_indexed_property_if_present(object, k));
+            k_present = k_value.has_value();
+            if (k_present)
+                accumulator = *k_value;
 
             // iv. Set k to k - 1.
         }
@@ -1266,18 +1331,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::reduce_right)
     // 9. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
-
         // c. If kPresent is true, then
-        if (k_present) {
-            // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
-
+        //    i. Let kValue be ? Get(O, Pk).
+        auto k_value = TRY(get_indexed_property_if_present(object, k));
+        if (k_value.has_value()) {
             // ii. Set accumulator to ? Call(callbackfn, undefined, « accumulator, kValue, 𝔽(k), O »).
-            accumulator = TRY(call(vm, callback_function.as_function(), js_undefined(), accumulator, k_value, Value((size_t)k), object));
+            accumulator = TRY(call(vm, callback_function.as_function(), js_undefined(), accumulator, *k_value, Value((size_t)k), object));
         }
 
         // d. Set k to k - 1.
@@ -1476,60 +1536,214 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::some)
     return Value(false);
 }
 
-ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
-{
-    // FIXME: it would probably be better to switch to insertion sort for small arrays for
-    // better performance
-    if (arr_to_sort.size() <= 1)
-        return {};
+// The sort below is a TimSort: it finds naturally ordered runs, extends short runs to a minimum length with binary
+// insertion sort, and merges them through a single scratch buffer while keeping the run lengths balanced. Already
+// sorted or nearly sorted input needs close to n comparisons. Every step only moves elements past ones that compare
+// strictly less, so the sort is stable as Array.prototype.sort requires.
+static constexpr size_t sort_minimum_merge_length = 64;
 
-    GC::RootVector<Value> left;
-    GC::RootVector<Value> right;
+struct SortRun {
+    size_t base { 0 };
+    size_t length { 0 };
+};
 
-    left.ensure_capacity(arr_to_sort.size() / 2);
-    right.ensure_capacity(arr_to_sort.size() / 2 + (arr_to_sort.size() & 1));
+static size_t sort_minimum_run_length(size_t length)
+{
+    size_t remainder = 0;
+    while (length >= sort_minimum_merge_length) {
+        remainder |= length & 1;
+        length >>= 1;
+    }
+    return length + remainder;
+}
 
-    for (size_t i = 0; i < arr_to_sort.size(); ++i) {
-        if (i < arr_to_sort.size() / 2) {
-            left.append(arr_to_sort[i]);
-        } else {
-            right.append(arr_to_sort[i]);
+template<typename LessThan>
+static ThrowCompletionOr<void> binary_insertion_sort(Span<Value> items, size_t sorted_prefix_length, LessThan const& less_than)
+{
+    for (size_t i = max(sorted_prefix_length, static_cast<size_t>(1)); i < items.size(); ++i) {
+        // NOTE: The pivot stays in items (and thus rooted) until all comparisons are done.
+        auto pivot = items[i];
+        size_t low = 0;
+        size_t high = i;
+        while (low < high) {
+            auto middle = low + (high - low) / 2;
+            if (TRY(less_than(pivot, items[middle])))
+                high = middle;
+            else
+                low = middle + 1;
+        }
+        for (size_t j = i; j > low; --j)
+            items[j] = items[j - 1];
+        items[low] = pivot;
+    }
+    return {};
+}
+
+template<typename LessThan>
+static ThrowCompletionOr<size_t> count_run_and_make_ascending(Span<Value> items, LessThan const& less_than)
+{
+    if (items.size() < 2)
+        return items.size();
+
+    size_t run_end = 2;
+    if (TRY(less_than(items[1], items[0]))) {
+        // Only strictly descending runs are reversed, so equal elements keep their relative order.
+        while (run_end < items.size()) {
+            if (!TRY(less_than(items[run_end], items[run_end - 1])))
+                break;
+            ++run_end;
+        }
+        items.slice(0, run_end).reverse();
+    } else {
+        while (run_end < items.size()) {
+            if (TRY(less_than(items[run_end], items[run_end - 1])))
+                break;
+            ++run_end;
         }
     }
+    return run_end;
+}
 
-    TRY(array_merge_sort(vm, compare_func, left));
-    TRY(array_merge_sort(vm, compare_func, right));
+template<typename LessThan>
+static ThrowCompletionOr<void> merge_sort_runs(Span<Value> items, SortRun left_run, SortRun right_run, GC::RootVector<Value>& scratch, LessThan const& less_than)
+{
+    // Elements of the left run that are not greater than the first element of the right run are already in place.
+    auto first_of_right = items[right_run.base];
+    size_t low = 0;
+    size_t high = left_run.length;
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (TRY(less_than(first_of_right, items[left_run.base + middle])))
+            high = middle;
+        else
+            low = middle + 1;
+    }
+    if (low == left_run.length)
+        return {};
+
+    auto left_base = left_run.base + low;
+    auto left_length = left_run.length - low;
+    scratch.clear_with_capacity();
+    scratch.append(items.offset_pointer(left_base), left_length);
+
+    size_t left = 0;
+    size_t right = right_run.base;
+    size_t right_end = right_run.base + right_run.length;
+    size_t out = left_base;
+    while (left < left_length && right < right_end) {
+        if (TRY(less_than(items[right], scratch[left])))
+            items[out++] = items[right++];
+        else
+            items[out++] = scratch[left++];
+    }
+    while (left < left_length)
+        items[out++] = scratch[left++];
+    return {};
+}
 
-    arr_to_sort.clear();
+template<typename LessThan>
+static ThrowCompletionOr<void> tim_sort(Span<Value> items, LessThan const& less_than)
+{
+    if (items.size() < 2)
+        return {};
 
-    size_t left_index = 0, right_index = 0;
+    if (items.size() < sort_minimum_merge_length) {
+        auto run_length = TRY(count_run_and_make_ascending(items, less_than));
+        return binary_insertion_sort(items, run_length, less_than);
+    }
 
-    while (left_index < left.size() && right_index < right.size()) {
-        auto x = left[left_index];
-        auto y = right[right_index];
+    auto minimum_run_length = sort_minimum_run_length(items.size());
+    Vector<SortRun, 64> runs;
+    GC::RootVector<Value> scratch;
 
-        double comparison_result = TRY(compare_func(x, y));
+    auto merge_at = [&](size_t index) -> ThrowCompletionOr<void> {
+        TRY(merge_sort_runs(items, runs[index], runs[index + 1], scratch, less_than));
+        runs[index].length += runs[index + 1].length;
+        runs.remove(index + 1);
+        return {};
+    };
 
-        if (comparison_result <= 0) {
-            arr_to_sort.append(x);
-            left_index++;
-        } else {
-            arr_to_sort.append(y);
-            right_index++;
+    for (size_t base = 0; base < items.size();) {
+        auto remaining = items.slice(base);
+        auto run_length = TRY(count_run_and_make_ascending(remaining, less_than));
+        if (run_length < minimum_run_length) {
+            auto forced_length = min(minimum_run_length, remaining.size());
+            TRY(binary_insertion_sort(remaining.slice(0, forced_length), run_length, less_than));
+            run_length = forced_length;
+        }
+        runs.append({ base, run_length });
+        base += run_length;
+
+        // Keep the pending run lengths decreasing faster than the Fibonacci numbers, so merges stay balanced.
+        while (runs.size() > 1) {
+            auto n = runs.size() - 2;
+            if ((n > 0 && runs[n - 1].length <= runs[n].length + runs[n + 1].length)
+                || (n > 1 && runs[n - 2].length <= runs[n - 1].length + runs[n].length)) {
+                if (runs[n - 1].length < runs[n + 1].length)
+                    --n;
+            } else if (runs[n].length > runs[n + 1].length) {
+                break;
+            }
+            TRY(merge_at(n));
         }
     }
 
-    while (left_index < left.size()) {
-        arr_to_sort.append(left[left_index]);
-        left_index++;
+    while (runs.size() > 1) {
+        auto n = runs.size() - 2;
+        if (n > 0 && runs[n - 1].length < runs[n + 1].length)
+            --n;
+        TRY(merge_at(n));
+    }
+    return {};
+}
+
+ThrowCompletionOr<void> array_merge_sort(VM&, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
+{
+    return tim_sort(arr_to_sort.span(), [&](Value x, Value y) -> ThrowCompletionOr<bool> {
+        return TRY(compare_func(x, y)) < 0;
+    });
+}
+
+static StringView int32_to_decimal_string(i32 value, AK::Array<char, 11>& buffer)
+{
+    auto magnitude = value < 0 ? 0u - static_cast<u32>(value) : static_cast<u32>(value);
+    size_t position = buffer.size();
+    do {
+        buffer[--position] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0)
+        buffer[--position] = '-';
+    return { buffer.data() + position, buffer.size() - position };
+}
+
+bool array_sort_with_specialized_default_compare(GC::RootVector<Value>& items)
+{
+    auto infallible_tim_sort = [&](auto less_than) {
+        MUST(tim_sort(items.span(), [&](Value x, Value y) -> ThrowCompletionOr<bool> {
+            return less_than(x, y);
+        }));
+    };
+
+    // OPTIMIZATION: ToString is the identity on Strings, so CompareArrayElements reduces to comparing code units.
+    if (all_of(items, [](Value value) { return value.is_string(); })) {
+        infallible_tim_sort([](Value x, Value y) {
+            return (x.as_string().utf16_string_view() <=> y.as_string().utf16_string_view()) < 0;
+        });
+        return true;
     }
 
-    while (right_index < right.size()) {
-        arr_to_sort.append(right[right_index]);
-        right_index++;
+    // OPTIMIZATION: Int32s stringify to short ASCII strings, which we can produce on the stack and compare directly.
+    if (all_of(items, [](Value value) { return value.is_int32(); })) {
+        infallible_tim_sort([](Value x, Value y) {
+            AK::Array<char, 11> x_buffer;
+            AK::Array<char, 11> y_buffer;
+            return int32_to_decimal_string(x.as_i32(), x_buffer) < int32_to_decimal_string(y.as_i32(), y_buffer);
+        });
+        return true;
     }
 
-    return {};
+    return false;
 }
 
 // 23.1.3.30 Array.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-array.prototype.sort
@@ -1553,7 +1767,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     };
 
     // 5. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, skip-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles, comparefn.is_undefined() ? SortCompareKind::DefaultArrayCompare : SortCompareKind::Custom));
 
     // 6. Let itemCount be the number of elements in sortedList.
     auto item_count = sorted_list.size();
@@ -1561,6 +1775,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     // 7. Let j be 0.
     size_t j = 0;
 
+    // OPTIMIZATION: Set() on an index below the size of a simple packed array just overwrites an own writable data
+    //               property. The comparator may have reshaped the array, so this is checked after sorting.
+    if (auto* array = as_if<Array>(*object); array && array->is_simple_packed_array()) {
+        for (auto packed_count = min<size_t>(item_count, array->indexed_array_like_size()); j < packed_count; ++j)
+            array->indexed_put(j, sorted_list[j]);
+    }
+
     // 8. Repeat, while j < itemCount,
     for (; j < item_count; ++j) {
         // a. Perform ? Set(obj, ! ToString(𝔽(j)), sortedList[j], true).
@@ -1911,7 +2132,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::to_sorted)
     };
 
     // 6. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, read-through-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles, comparefn.is_undefined() ? SortCompareKind::DefaultArrayCompare : SortCompareKind::Custom));
 
     // 7. Let j be 0.
     // 8. Repeat, while j < len,
@@ -65,5 +65,6 @@ private:
 };
 
 ThrowCompletionOr<void> array_merge_sort(VM&, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort);
+bool array_sort_with_specialized_default_compare(GC::RootVector<Value>&);
 
 }
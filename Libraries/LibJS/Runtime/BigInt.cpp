@@ -8,6 +8,7 @@
 #include <LibGC/Heap.h>
 #include <LibJS/Runtime/BigInt.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <math.h>
 
 namespace JS {
 
@@ -18,24 +19,52 @@ GC::Ref<BigInt> BigInt::create(VM& vm, Crypto::SignedBigInteger big_integer)
     return vm.heap().allocate<BigInt>(move(big_integer));
 }
 
+GC::Ref<BigInt> BigInt::create(VM& vm, i64 value)
+{
+    return vm.heap().allocate<BigInt>(value);
+}
+
 BigInt::BigInt(Crypto::SignedBigInteger big_integer)
-    : m_big_integer(move(big_integer))
+    : m_small_value(big_integer.to_i64_if_representable())
+    , m_big_integer(move(big_integer))
+{
+}
+
+BigInt::BigInt(i64 value)
+{
+    // NOTE: i64's minimum needs 64 bits of magnitude, so it can't use the 63-bit fast paths.
+    if (value == NumericLimits<i64>::min())
+        m_big_integer = Crypto::SignedBigInteger { value };
+    else
+        m_small_value = value;
+}
+
+Crypto::SignedBigInteger const& BigInt::big_integer() const
 {
+    if (!m_big_integer.has_value())
+        m_big_integer = Crypto::SignedBigInteger { *m_small_value };
+    return *m_big_integer;
 }
 
 ErrorOr<String> BigInt::to_string() const
 {
-    return String::formatted("{}n", TRY(m_big_integer.to_base(10)));
+    if (m_small_value.has_value())
+        return String::formatted("{}n", *m_small_value);
+    return String::formatted("{}n", TRY(m_big_integer->to_base(10)));
 }
 
 Utf16String BigInt::to_utf16_string() const
 {
-    return Utf16String::formatted("{}n", MUST(m_big_integer.to_base(10)));
+    if (m_small_value.has_value())
+        return Utf16String::formatted("{}n", *m_small_value);
+    return Utf16String::formatted("{}n", MUST(m_big_integer->to_base(10)));
 }
 
 size_t BigInt::external_memory_size() const
 {
-    return m_big_integer.external_memory_size();
+    if (!m_big_integer.has_value())
+        return 0;
+    return m_big_integer->external_memory_size();
 }
 
 // 21.2.1.1.1 NumberToBigInt ( number ), https://tc39.es/ecma262/#sec-numbertobigint
@@ -48,6 +77,10 @@ ThrowCompletionOr<GC::Ref<BigInt>> number_to_bigint(VM& vm, Value number)
         return vm.throw_completion<RangeError>(ErrorType::BigIntFromNonIntegral);
 
     // 2. Return the BigInt value that represents ℝ(number).
+    if (number.is_int32())
+        return BigInt::create(vm, static_cast<i64>(number.as_i32()));
+    if (auto value = number.as_double(); fabs(value) < 0x1p63)
+        return BigInt::create(vm, static_cast<i64>(value));
     return BigInt::create(vm, Crypto::SignedBigInteger { number.as_double() });
 }
 
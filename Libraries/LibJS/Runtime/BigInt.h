@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Error.h>
+#include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
 #include <LibCrypto/BigInt/SignedBigInteger.h>
@@ -22,10 +23,14 @@ class JS_API BigInt final : public Cell {
 
 public:
     [[nodiscard]] static GC::Ref<BigInt> create(VM&, Crypto::SignedBigInteger);
+    [[nodiscard]] static GC::Ref<BigInt> create(VM&, i64);
 
     virtual ~BigInt() override = default;
 
-    Crypto::SignedBigInteger const& big_integer() const { return m_big_integer; }
+    // Values whose magnitude fits in 63 bits are kept inline. The SignedBigInteger is only
+    // materialized when an operation without a 64-bit fast path asks for it.
+    Optional<i64> small_value() const { return m_small_value; }
+    Crypto::SignedBigInteger const& big_integer() const;
 
     ErrorOr<String> to_string() const;
     Utf16String to_utf16_string() const;
@@ -34,8 +39,10 @@ private:
     virtual size_t external_memory_size() const override;
 
     explicit BigInt(Crypto::SignedBigInteger);
+    explicit BigInt(i64);
 
-    Crypto::SignedBigInteger m_big_integer;
+    Optional<i64> m_small_value;
+    mutable Optional<Crypto::SignedBigInteger> m_big_integer;
 };
 
 ThrowCompletionOr<GC::Ref<BigInt>> number_to_bigint(VM&, Value);
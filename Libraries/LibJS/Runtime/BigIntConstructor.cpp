@@ -74,6 +74,15 @@ JS_DEFINE_NATIVE_FUNCTION(BigIntConstructor::as_int_n)
     if (bits == 0)
         return BigInt::create(vm, 0);
 
+    // OPTIMIZATION: Inline 64-bit BigInts are already within the signed 64-bit range, and narrower widths can be
+    //               computed by sign-extending the low bits.
+    if (auto value = bigint->small_value(); value.has_value()) {
+        if (bits >= 64)
+            return bigint;
+        auto unused_bits = 64 - bits;
+        return BigInt::create(vm, static_cast<i64>(static_cast<u64>(*value) << unused_bits) >> unused_bits);
+    }
+
     // OPTIMIZATION: This condition guarantees bigint is within the signed bits-bit range, so steps 3-5 return bigint.
     if (bigint->big_integer().is_negative()
         && bigint->big_integer().unsigned_value().one_based_index_of_highest_set_bit() < bits) {
@@ -107,6 +116,14 @@ JS_DEFINE_NATIVE_FUNCTION(BigIntConstructor::as_uint_n)
     // 2. Set bigint to ? ToBigInt(bigint).
     auto bigint = TRY(vm.argument(1).to_bigint(vm));
 
+    // OPTIMIZATION: Inline 64-bit BigInts can be masked directly, as long as the result fits in 63 bits.
+    if (auto value = bigint->small_value(); value.has_value()) {
+        if (bits >= 64 && *value >= 0)
+            return bigint;
+        if (bits < 64)
+            return BigInt::create(vm, static_cast<i64>(static_cast<u64>(*value) & ((static_cast<u64>(1) << bits) - 1)));
+    }
+
     // 3. Return the BigInt value that represents ℝ(bigint) modulo 2^bits.
     auto const mod = TRY_OR_THROW_OOM(vm, bigint->big_integer().mod_power_of_two(bits));
 
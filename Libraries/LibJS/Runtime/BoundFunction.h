@@ -35,7 +35,7 @@ public:
 private:
     BoundFunction(Realm&, FunctionObject& target_function, Value bound_this, Vector<Value> bound_arguments, Object* prototype);
 
-    void get_stack_frame_info(size_t& registers_and_locals_count, ReadonlySpan<Value>& constants, size_t& argument_count) override;
+    void get_stack_frame_info(size_t& registers_and_locals_count, size_t& argument_count) override;
     virtual void visit_edges(Visitor&) override;
     virtual size_t external_memory_size() const override;
 
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibJS/Runtime/CompiledRegExpCache.h>
+#include <LibJS/Runtime/RegExpObject.h>
+
+namespace JS {
+
+CompiledRegExpCache& CompiledRegExpCache::the()
+{
+    static CompiledRegExpCache s_the;
+    return s_the;
+}
+
+CompiledRegExpCache::CompiledRegExpCache(size_t max_entry_count, size_t max_total_footprint)
+    : m_max_entry_count(max_entry_count)
+    , m_max_total_footprint(max_total_footprint)
+{
+}
+
+static String cache_key(Utf16View const& pattern, u8 flag_bits)
+{
+    StringBuilder key_builder;
+    key_builder.append('/');
+    key_builder.append(pattern);
+    key_builder.append('/');
+    key_builder.append_code_point(flag_bits);
+    return key_builder.to_string_without_validation();
+}
+
+bool CompiledRegExpCache::contains(Utf16View const& pattern, u8 flag_bits) const
+{
+    return m_entries.contains(cache_key(pattern, flag_bits));
+}
+
+ErrorOr<NonnullRefPtr<CompiledRegExp>, String> CompiledRegExpCache::get_or_compile(Utf16View const& pattern, u8 flag_bits)
+{
+    auto key = cache_key(pattern, flag_bits);
+
+    if (auto it = m_entries.find(key); it != m_entries.end()) {
+        auto& entry = *it->value;
+        NonnullRefPtr compiled = entry.compiled;
+        // Move the entry to the most recently used end of the list.
+        m_recently_used.append(entry);
+        update_footprint(entry);
+        evict_until_within_budget();
+        ++m_hits;
+        return compiled;
+    }
+    ++m_misses;
+
+    auto flags = static_cast<RegExpObject::Flags>(flag_bits);
+    bool unicode = has_flag(flags, RegExpObject::Flags::Unicode);
+    bool unicode_sets = has_flag(flags, RegExpObject::Flags::UnicodeSets);
+
+    // Convert UTF-16 pattern to UTF-8 (with escape normalization for non-ASCII).
+    String parsed_pattern;
+    if (!pattern.is_empty()) {
+        auto result = parse_regex_pattern(pattern, unicode, unicode_sets);
+        if (result.is_error())
+            return result.release_error().error;
+        parsed_pattern = result.release_value();
+    }
+
+    regex::ECMAScriptCompileFlags compile_flags {};
+    compile_flags.global = has_flag(flags, RegExpObject::Flags::Global);
+    compile_flags.ignore_case = has_flag(flags, RegExpObject::Flags::IgnoreCase);
+    compile_flags.multiline = has_flag(flags, RegExpObject::Flags::Multiline);
+    compile_flags.dot_all = has_flag(flags, RegExpObject::Flags::DotAll);
+    compile_flags.unicode = unicode;
+    compile_flags.unicode_sets = unicode_sets;
+    compile_flags.sticky = has_flag(flags, RegExpObject::Flags::Sticky);
+    compile_flags.has_indices = has_flag(flags, RegExpObject::Flags::HasIndices);
+
+    auto compiled = regex::ECMAScriptRegex::compile(parsed_pattern.bytes_as_string_view(), compile_flags);
+    if (compiled.is_error())
+        return compiled.release_error();
+
+    auto compiled_regexp = CompiledRegExp::create(compiled.release_value());
+
+    auto pattern_length = pattern.length_in_code_units();
+    if (pattern_length > max_cached_pattern_length)
+        return compiled_regexp;
+
+    auto entry = adopt_own(*new Entry {
+        .key = key,
+        .compiled = compiled_regexp,
+    });
+    m_recently_used.append(*entry);
+    update_footprint(*entry);
+    m_entries.set(move(key), move(entry));
+    evict_until_within_budget();
+
+    return compiled_regexp;
+}
+
+void CompiledRegExpCache::update_footprint(Entry& entry)
+{
+    auto footprint = entry.key.byte_count() + entry.compiled->memory_footprint();
+    m_total_footprint = m_total_footprint - entry.footprint + footprint;
+    entry.footprint = footprint;
+}
+
+void CompiledRegExpCache::evict_until_within_budget()
+{
+    while (m_entries.size() > m_max_entry_count || m_total_footprint > m_max_total_footprint) {
+        auto* least_recently_used = m_recently_used.first();
+        VERIFY(least_recently_used);
+        m_recently_used.remove(*least_recently_used);
+        m_total_footprint -= least_recently_used->footprint;
+        auto key = least_recently_used->key;
+        m_entries.remove(key);
+    }
+}
+
+void CompiledRegExpCache::clear()
+{
+    m_recently_used.clear();
+    m_entries.clear();
+    m_total_footprint = 0;
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/String.h>
+#include <AK/Utf16View.h>
+#include <LibJS/Export.h>
+#include <LibRegex/ECMAScriptRegex.h>
+
+namespace JS {
+
+// A compiled regex program, shared between every RegExp object with the same source and flags. Besides the
+// bytecode, this holds everything derived from the pattern at compile time (the NFA, pattern hints, prefilters).
+class CompiledRegExp : public RefCounted<CompiledRegExp> {
+public:
+    static NonnullRefPtr<CompiledRegExp> create(regex::ECMAScriptRegex regex)
+    {
+        return adopt_ref(*new CompiledRegExp(move(regex)));
+    }
+
+    regex::ECMAScriptRegex const& regex() const { return m_regex; }
+
+    size_t memory_footprint() const { return sizeof(*this) + m_regex.memory_footprint(); }
+
+private:
+    explicit CompiledRegExp(regex::ECMAScriptRegex regex)
+        : m_regex(move(regex))
+    {
+    }
+
+    regex::ECMAScriptRegex m_regex;
+};
+
+// Process-wide LRU cache of compiled regexes, keyed by pattern source and flags. Evicted entries stay alive for as
+// long as a RegExp object still refers to them.
+class JS_API CompiledRegExpCache {
+public:
+    static constexpr size_t default_max_entry_count = 1024;
+    static constexpr size_t default_max_total_footprint = 16 * MiB;
+
+    static CompiledRegExpCache& the();
+
+    explicit CompiledRegExpCache(size_t max_entry_count = default_max_entry_count, size_t max_total_footprint = default_max_total_footprint);
+
+    // Returns the compiled regex for the given UTF-16 pattern source and RegExpObject::Flags, compiling and caching it
+    // on a miss. Patterns that fail to compile are not cached.
+    ErrorOr<NonnullRefPtr<CompiledRegExp>, String> get_or_compile(Utf16View const& pattern, u8 flag_bits);
+
+    bool contains(Utf16View const& pattern, u8 flag_bits) const;
+    size_t hits() const { return m_hits; }
+    size_t misses() const { return m_misses; }
+    size_t size() const { return m_entries.size(); }
+    size_t total_footprint() const { return m_total_footprint; }
+
+    void clear();
+
+private:
+    static constexpr size_t max_cached_pattern_length = 64 * KiB;
+
+    // Entries are charged their memory footprint, which keeps growing after they are cached as matching builds DFA
+    // states, scratch buffers and native code. The charge is only brought up to date when the entry is looked up, not
+    // after every match or native compile, so the footprint budget is approximate: a regex that keeps matching through
+    // the same RegExp object can grow well past its charge until its pattern is looked up again.
+    struct Entry {
+        String key;
+        NonnullRefPtr<CompiledRegExp> compiled;
+        size_t footprint { 0 };
+        IntrusiveListNode<Entry> list_node;
+    };
+
+    void update_footprint(Entry&);
+    void evict_until_within_budget();
+
+    size_t m_max_entry_count { 0 };
+    size_t m_max_total_footprint { 0 };
+
+    HashMap<String, NonnullOwnPtr<Entry>> m_entries;
+    IntrusiveList<&Entry::list_node> m_recently_used;
+    size_t m_total_footprint { 0 };
+
+    size_t m_hits { 0 };
+    size_t m_misses { 0 };
+};
+
+}
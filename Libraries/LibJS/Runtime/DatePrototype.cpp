@@ -1004,7 +1004,8 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_date_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "date", "date").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Date, Intl::OptionDefaults::Date));
+    // OPTIMIZATION: Date/time formats constructed without options are cached.
+    auto date_format = TRY(realm.intrinsics().locale_date_time_format(Intrinsics::LocaleFormatKind::Date, locales, options));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
     auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
@@ -1028,7 +1029,8 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "any", "all").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Any, Intl::OptionDefaults::All));
+    // OPTIMIZATION: Date/time formats constructed without options are cached.
+    auto date_format = TRY(realm.intrinsics().locale_date_time_format(Intrinsics::LocaleFormatKind::DateTime, locales, options));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
     auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
@@ -1052,7 +1054,8 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_time_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let timeFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "time", "time").
-    auto time_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Time, Intl::OptionDefaults::Time));
+    // OPTIMIZATION: Date/time formats constructed without options are cached.
+    auto time_format = TRY(realm.intrinsics().locale_date_time_format(Intrinsics::LocaleFormatKind::Time, locales, options));
 
     // 4. Return ? FormatDateTime(timeFormat, x).
     auto formatted = TRY(Intl::format_date_time(vm, time_format, time));
@@ -142,7 +142,7 @@ void ECMAScriptFunctionObject::initialize(Realm& realm)
     }
 }
 
-void ECMAScriptFunctionObject::get_stack_frame_info(size_t& registers_and_locals_count, ReadonlySpan<Value>& constants, size_t& argument_count)
+Bytecode::Executable& ECMAScriptFunctionObject::ensure_bytecode_executable()
 {
     auto executable = shared_data().m_executable;
     if (!executable) {
@@ -155,8 +155,13 @@ void ECMAScriptFunctionObject::get_stack_frame_info(size_t& registers_and_locals
             executable->dump();
         m_shared_data->clear_compile_inputs();
     }
-    registers_and_locals_count = executable->registers_and_locals_count;
-    constants = executable->constants;
+    return *executable;
+}
+
+void ECMAScriptFunctionObject::get_stack_frame_info(size_t& registers_and_locals_count, size_t& argument_count)
+{
+    auto& executable = ensure_bytecode_executable();
+    registers_and_locals_count = executable.registers_and_locals_count;
     argument_count = max(argument_count, static_cast<size_t>(formal_parameter_count()));
 }
 
@@ -165,8 +170,6 @@ FLATTEN ThrowCompletionOr<Value> ECMAScriptFunctionObject::internal_call(Executi
 {
     auto& vm = this->vm();
 
-    ASSERT(bytecode_executable());
-
     // 1. Let callerContext be the running execution context.
     // NOTE: No-op, kept by the VM in its execution context stack.
 
@@ -210,8 +213,6 @@ FLATTEN ThrowCompletionOr<GC::Ref<Object>> ECMAScriptFunctionObject::internal_co
 {
     auto& vm = this->vm();
 
-    ASSERT(bytecode_executable());
-
     // 1. Let callerContext be the running execution context.
     // NOTE: No-op, kept by the VM in its execution context stack.
 
@@ -515,7 +516,9 @@ template void async_function_start(VM&, PromiseCapability const&, GC::Function<C
 // 15.8.4 Runtime Semantics: EvaluateAsyncFunctionBody, https://tc39.es/ecma262/#sec-runtime-semantics-evaluatefunctionbody
 ThrowCompletionOr<Value> ECMAScriptFunctionObject::ordinary_call_evaluate_body(VM& vm, ExecutionContext& context)
 {
-    auto result = TRY(vm.run_executable(context, *bytecode_executable(), {}));
+    // NB: Cold bytecode may have been flushed by a garbage collection since get_stack_frame_info(), e.g. while running
+    //     a Proxy trap or a "prototype" getter. Re-materializing it yields the same frame layout.
+    auto result = TRY(vm.run_executable(context, ensure_bytecode_executable(), {}));
 
     // NOTE: Running the bytecode should eventually return a completion.
     // Until it does, we assume "return" and include the undefined fallback from the call site.
@@ -45,7 +45,7 @@ public:
     virtual void initialize(Realm&) override;
     virtual ~ECMAScriptFunctionObject() override = default;
 
-    virtual void get_stack_frame_info(size_t& registers_and_locals_count, ReadonlySpan<Value>& constants, size_t& argument_count) override;
+    virtual void get_stack_frame_info(size_t& registers_and_locals_count, size_t& argument_count) override;
     virtual ThrowCompletionOr<Value> internal_call(ExecutionContext&, Value this_argument) override;
     virtual ThrowCompletionOr<GC::Ref<Object>> internal_construct(ExecutionContext&, FunctionObject& new_target) override;
 
@@ -71,6 +71,7 @@ public:
     void set_is_class_constructor() { const_cast<SharedFunctionInstanceData&>(shared_data()).set_is_class_constructor(); }
 
     auto& bytecode_executable() const { return shared_data().m_executable; }
+    Bytecode::Executable& ensure_bytecode_executable();
     [[nodiscard]] bool can_inline_call() const { return shared_data().can_inline_call(); }
     [[nodiscard]] Bytecode::Executable& inline_call_executable() const
     {
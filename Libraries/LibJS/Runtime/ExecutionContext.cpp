@@ -7,6 +7,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <LibGC/Heap.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
@@ -15,96 +16,73 @@
 
 namespace JS {
 
+// Heap-allocated execution contexts (module contexts, suspended generators and async functions, ...) come and go
+// constantly, so freed frames are kept around in per-size-class free lists and handed out again for any frame that
+// fits. If the frame's own size class has nothing free, a free slab from a larger class is used instead. Frames larger
+// than the biggest size class go straight back to the system allocator.
 class ExecutionContextAllocator {
 public:
-    NonnullOwnPtr<ExecutionContext> allocate(u32 registers_and_locals_count, ReadonlySpan<Value> constants, u32 arguments_count)
+    NonnullOwnPtr<ExecutionContext> allocate(u32 registers_and_locals_count, u32 arguments_count)
     {
-        auto tail_size = registers_and_locals_count + constants.size() + arguments_count;
+        auto tail_size = registers_and_locals_count + arguments_count;
 
         void* slot = nullptr;
-        if (tail_size <= 4 && !m_execution_contexts_with_4_tail.is_empty()) {
-            slot = m_execution_contexts_with_4_tail.take_last();
-        } else if (tail_size <= 16 && !m_execution_contexts_with_16_tail.is_empty()) {
-            slot = m_execution_contexts_with_16_tail.take_last();
-        } else if (tail_size <= 64 && !m_execution_contexts_with_64_tail.is_empty()) {
-            slot = m_execution_contexts_with_64_tail.take_last();
-        } else if (tail_size <= 128 && !m_execution_contexts_with_128_tail.is_empty()) {
-            slot = m_execution_contexts_with_128_tail.take_last();
-        } else if (tail_size <= 256 && !m_execution_contexts_with_256_tail.is_empty()) {
-            slot = m_execution_contexts_with_256_tail.take_last();
-        } else if (tail_size <= 512 && !m_execution_contexts_with_512_tail.is_empty()) {
-            slot = m_execution_contexts_with_512_tail.take_last();
-        }
-
-        if (slot) {
-            return adopt_own(*new (slot) ExecutionContext(registers_and_locals_count, constants, arguments_count));
+        if (auto size_class = size_class_for(tail_size); size_class.has_value()) {
+            for (size_t i = *size_class; i < m_free_slabs.size() && !slot; ++i) {
+                if (!m_free_slabs[i].is_empty())
+                    slot = m_free_slabs[i].take_last();
+            }
+            if (!slot)
+                slot = ::operator new(sizeof(ExecutionContext) + slab_tail_sizes[*size_class] * sizeof(Value));
+        } else {
+            slot = ::operator new(sizeof(ExecutionContext) + tail_size * sizeof(Value));
         }
 
-        auto tail_allocation_size = [tail_size] -> u32 {
-            if (tail_size <= 4)
-                return 4;
-            if (tail_size <= 16)
-                return 16;
-            if (tail_size <= 64)
-                return 64;
-            if (tail_size <= 128)
-                return 128;
-            if (tail_size <= 256)
-                return 256;
-            if (tail_size <= 512)
-                return 512;
-            return tail_size;
-        };
-
-        auto* memory = ::operator new(sizeof(ExecutionContext) + tail_allocation_size() * sizeof(Value));
-        return adopt_own(*::new (memory) ExecutionContext(registers_and_locals_count, constants, arguments_count));
+        return adopt_own(*new (slot) ExecutionContext(registers_and_locals_count, arguments_count));
     }
+
     void deallocate(void* ptr, u32 tail_size)
     {
-        if (tail_size <= 4) {
-            m_execution_contexts_with_4_tail.append(ptr);
-        } else if (tail_size <= 16) {
-            m_execution_contexts_with_16_tail.append(ptr);
-        } else if (tail_size <= 64) {
-            m_execution_contexts_with_64_tail.append(ptr);
-        } else if (tail_size <= 128) {
-            m_execution_contexts_with_128_tail.append(ptr);
-        } else if (tail_size <= 256) {
-            m_execution_contexts_with_256_tail.append(ptr);
-        } else if (tail_size <= 512) {
-            m_execution_contexts_with_512_tail.append(ptr);
-        } else {
+        auto size_class = size_class_for(tail_size);
+        if (!size_class.has_value()) {
             ::operator delete(ptr);
+            return;
         }
+        m_free_slabs[*size_class].append(ptr);
     }
 
 private:
-    Vector<void*> m_execution_contexts_with_4_tail;
-    Vector<void*> m_execution_contexts_with_16_tail;
-    Vector<void*> m_execution_contexts_with_64_tail;
-    Vector<void*> m_execution_contexts_with_128_tail;
-    Vector<void*> m_execution_contexts_with_256_tail;
-    Vector<void*> m_execution_contexts_with_512_tail;
+    static constexpr Array<u32, 6> slab_tail_sizes { 4, 16, 64, 128, 256, 512 };
+
+    static Optional<size_t> size_class_for(u32 tail_size)
+    {
+        for (size_t i = 0; i < slab_tail_sizes.size(); ++i) {
+            if (tail_size <= slab_tail_sizes[i])
+                return i;
+        }
+        return {};
+    }
+
+    Array<Vector<void*>, slab_tail_sizes.size()> m_free_slabs;
 };
 
 static NeverDestroyed<ExecutionContextAllocator> s_execution_context_allocator;
 
-NonnullOwnPtr<ExecutionContext> ExecutionContext::create(u32 registers_and_locals_count, ReadonlySpan<Value> constants, u32 arguments_count)
+NonnullOwnPtr<ExecutionContext> ExecutionContext::create(u32 registers_and_locals_count, u32 arguments_count)
 {
-    return s_execution_context_allocator->allocate(registers_and_locals_count, constants, arguments_count);
+    return s_execution_context_allocator->allocate(registers_and_locals_count, arguments_count);
 }
 
 void ExecutionContext::operator delete(void* ptr)
 {
     auto const* execution_context = static_cast<ExecutionContext const*>(ptr);
-    s_execution_context_allocator->deallocate(ptr, execution_context->registers_and_constants_and_locals_and_arguments_count);
+    s_execution_context_allocator->deallocate(ptr, execution_context->registers_and_locals_and_arguments_count);
 }
 
 NonnullOwnPtr<ExecutionContext> ExecutionContext::copy() const
 {
-    // NB: We pass the entire non-argument count as registers_and_locals_count with 0 constants.
-    //     This means all slots get initialized to empty, but we immediately overwrite them below.
-    auto copy = create(registers_and_constants_and_locals_and_arguments_count - argument_count, ReadonlySpan<Value> {}, argument_count);
+    // NB: All non-argument slots get initialized to empty, but we immediately overwrite them below.
+    auto copy = create(registers_and_locals_and_arguments_count - argument_count, argument_count);
     copy->function = function;
     copy->realm = realm;
     copy->script_or_module = script_or_module;
@@ -119,9 +97,9 @@ NonnullOwnPtr<ExecutionContext> ExecutionContext::copy() const
     copy->this_value = this_value;
     copy->executable = executable;
     copy->passed_argument_count = passed_argument_count;
-    copy->registers_and_constants_and_locals_and_arguments_count = registers_and_constants_and_locals_and_arguments_count;
-    for (size_t i = 0; i < registers_and_constants_and_locals_and_arguments_count; ++i)
-        copy->registers_and_constants_and_locals_and_arguments()[i] = registers_and_constants_and_locals_and_arguments()[i];
+    copy->registers_and_locals_and_arguments_count = registers_and_locals_and_arguments_count;
+    for (size_t i = 0; i < registers_and_locals_and_arguments_count; ++i)
+        copy->registers_and_locals_and_arguments()[i] = registers_and_locals_and_arguments()[i];
     copy->argument_count = argument_count;
     return copy;
 }
@@ -135,7 +113,7 @@ void ExecutionContext::visit_edges(Cell::Visitor& visitor)
     visitor.visit(private_environment);
     visitor.visit(this_value);
     visitor.visit(executable);
-    visitor.visit(registers_and_constants_and_locals_and_arguments_span());
+    visitor.visit(registers_and_locals_and_arguments_span());
     visitor.visit(script_or_module);
 }
 
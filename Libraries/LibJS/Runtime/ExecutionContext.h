@@ -25,7 +25,7 @@ using ScriptOrModule = Variant<Empty, GC::Ref<Script>, GC::Ref<Module>>;
 
 // 9.4 Execution Contexts, https://tc39.es/ecma262/#sec-execution-contexts
 struct JS_API ExecutionContext {
-    static NonnullOwnPtr<ExecutionContext> create(u32 registers_and_locals_count, ReadonlySpan<Value> constants, u32 arguments_count);
+    static NonnullOwnPtr<ExecutionContext> create(u32 registers_and_locals_count, u32 arguments_count);
     [[nodiscard]] NonnullOwnPtr<ExecutionContext> copy() const;
 
     ~ExecutionContext() = default;
@@ -36,17 +36,16 @@ private:
     friend class ExecutionContextAllocator;
 
 public:
-    // NB: The layout is: [registers | locals | constants | arguments]
-    ALWAYS_INLINE ExecutionContext(u32 registers_and_locals_count, ReadonlySpan<Value> constants, u32 arguments_count_)
+    // NB: The layout is: [registers | locals | arguments]
+    //     Constants are read straight from the executable's constant pool, see Bytecode::Operand.
+    ALWAYS_INLINE ExecutionContext(u32 registers_and_locals_count, u32 arguments_count_)
     {
-        VERIFY(!Checked<u32>::addition_would_overflow(registers_and_locals_count, constants.size(), arguments_count_));
-        registers_and_constants_and_locals_and_arguments_count = registers_and_locals_count + constants.size() + arguments_count_;
+        VERIFY(!Checked<u32>::addition_would_overflow(registers_and_locals_count, arguments_count_));
+        registers_and_locals_and_arguments_count = registers_and_locals_count + arguments_count_;
         argument_count = arguments_count_;
-        auto* values = registers_and_constants_and_locals_and_arguments();
+        auto* values = registers_and_locals_and_arguments();
         for (size_t i = 0; i < registers_and_locals_count; ++i)
             values[i] = js_special_empty_value();
-        for (size_t i = 0; i < constants.size(); ++i)
-            values[registers_and_locals_count + i] = constants[i];
     }
 
     void operator delete(void* ptr);
@@ -78,12 +77,12 @@ public:
 
     GC::Ptr<Bytecode::Executable> executable;
 
-    Span<Value> registers_and_constants_and_locals_and_arguments_span()
+    Span<Value> registers_and_locals_and_arguments_span()
     {
-        return { registers_and_constants_and_locals_and_arguments(), registers_and_constants_and_locals_and_arguments_count };
+        return { registers_and_locals_and_arguments(), registers_and_locals_and_arguments_count };
     }
 
-    Value const* registers_and_constants_and_locals_and_arguments() const
+    Value const* registers_and_locals_and_arguments() const
     {
         return reinterpret_cast<Value*>(reinterpret_cast<uintptr_t>(this) + sizeof(ExecutionContext));
     }
@@ -107,12 +106,12 @@ public:
 
     Value* arguments_data()
     {
-        return registers_and_constants_and_locals_and_arguments() + (registers_and_constants_and_locals_and_arguments_count - argument_count);
+        return registers_and_locals_and_arguments() + (registers_and_locals_and_arguments_count - argument_count);
     }
 
     Value const* arguments_data() const
     {
-        return registers_and_constants_and_locals_and_arguments() + (registers_and_constants_and_locals_and_arguments_count - argument_count);
+        return registers_and_locals_and_arguments() + (registers_and_locals_and_arguments_count - argument_count);
     }
 
     // Non-standard: Inline frame linkage for the bytecode interpreter.
@@ -125,12 +124,12 @@ public:
 private:
     friend class VM;
 
-    Value* registers_and_constants_and_locals_and_arguments()
+    Value* registers_and_locals_and_arguments()
     {
         return reinterpret_cast<Value*>(reinterpret_cast<uintptr_t>(this) + sizeof(ExecutionContext));
     }
 
-    u32 registers_and_constants_and_locals_and_arguments_count { 0 };
+    u32 registers_and_locals_and_arguments_count { 0 };
 
 public:
     u32 argument_count { 0 };
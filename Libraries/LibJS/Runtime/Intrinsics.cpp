@@ -31,6 +31,7 @@
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/DataViewConstructor.h>
 #include <LibJS/Runtime/DataViewPrototype.h>
+#include <LibJS/Runtime/Date.h>
 #include <LibJS/Runtime/DateConstructor.h>
 #include <LibJS/Runtime/DatePrototype.h>
 #include <LibJS/Runtime/DisposableStackConstructor.h>
@@ -47,6 +48,7 @@
 #include <LibJS/Runtime/Intl/Collator.h>
 #include <LibJS/Runtime/Intl/CollatorConstructor.h>
 #include <LibJS/Runtime/Intl/CollatorPrototype.h>
+#include <LibJS/Runtime/Intl/DateTimeFormat.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatConstructor.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatPrototype.h>
 #include <LibJS/Runtime/Intl/DisplayNamesConstructor.h>
@@ -133,6 +135,7 @@
 #include <LibJS/Runtime/WeakSetPrototype.h>
 #include <LibJS/Runtime/WrapForValidIteratorPrototype.h>
 #include <LibJS/RustIntegration.h>
+#include <LibUnicode/Locale.h>
 
 // FIXME: Remove this asm hack when we upgrade to GCC 15.
 #define INCLUDE_FILE_WITH_ASSEMBLY(name, file_path) \
@@ -346,10 +349,9 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     // 27.6.1.1 AsyncGenerator.prototype.constructor, https://tc39.es/ecma262/#sec-asyncgenerator-prototype-constructor
     m_async_generator_prototype->define_direct_property(vm.names.constructor, m_async_generator_function_prototype, Attribute::Configurable);
 
+    // NB: The original Date.now, JSON.parse and JSON.stringify are remembered when Date and JSON are first created, so
+    //     that realms which never touch them do not pay for building them here.
     m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm.names.values).as_function();
-    m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm.names.now).as_function();
-    m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
-    m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
     m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
 
     array_prototype()->convert_to_prototype_if_needed();
@@ -412,6 +414,9 @@ JS_ENUMERATE_TYPED_ARRAYS
             initialize_constructor(vm, vm.names.Symbol, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype);    \
         else                                                                                                                                             \
             initialize_constructor(vm, vm.names.ClassName, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype); \
+                                                                                                                                                         \
+        if constexpr (IsSame<Namespace::ConstructorName, DateConstructor>)                                                                               \
+            m_date_constructor_now_function = &m_##snake_namespace##snake_name##_constructor->get_without_side_effects(vm.names.now).as_function();      \
     }                                                                                                                                                    \
                                                                                                                                                          \
     GC::Ref<Namespace::ConstructorName> Intrinsics::snake_namespace##snake_name##_constructor()                                                          \
@@ -445,16 +450,44 @@ JS_ENUMERATE_TEMPORAL_OBJECTS
 
 #undef __JS_ENUMERATE_INNER
 
-#define __JS_ENUMERATE(ClassName, snake_name)                              \
-    GC::Ref<ClassName> Intrinsics::snake_name##_object()                   \
-    {                                                                      \
-        if (!m_##snake_name##_object)                                      \
-            m_##snake_name##_object = m_realm->create<ClassName>(m_realm); \
-        return *m_##snake_name##_object;                                   \
+#define __JS_ENUMERATE(ClassName, snake_name)                                                                                     \
+    GC::Ref<ClassName> Intrinsics::snake_name##_object()                                                                          \
+    {                                                                                                                             \
+        if (!m_##snake_name##_object) {                                                                                           \
+            m_##snake_name##_object = m_realm->create<ClassName>(m_realm);                                                        \
+                                                                                                                                  \
+            if constexpr (IsSame<ClassName, JSONObject>) {                                                                        \
+                auto& vm = this->vm();                                                                                            \
+                m_json_parse_function = &m_##snake_name##_object->get_without_side_effects(vm.names.parse).as_function();         \
+                m_json_stringify_function = &m_##snake_name##_object->get_without_side_effects(vm.names.stringify).as_function(); \
+            }                                                                                                                     \
+        }                                                                                                                         \
+        return *m_##snake_name##_object;                                                                                          \
     }
 JS_ENUMERATE_BUILTIN_NAMESPACE_OBJECTS
 #undef __JS_ENUMERATE
 
+GC::Ref<FunctionObject> Intrinsics::date_constructor_now_function()
+{
+    if (!m_date_constructor_now_function)
+        (void)date_constructor();
+    return *m_date_constructor_now_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_parse_function()
+{
+    if (!m_json_parse_function)
+        (void)json_object();
+    return *m_json_parse_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_stringify_function()
+{
+    if (!m_json_stringify_function)
+        (void)json_object();
+    return *m_json_stringify_function;
+}
+
 void Intrinsics::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -525,6 +558,8 @@ void Intrinsics::visit_edges(Visitor& visitor)
 #undef __JS_ENUMERATE
 
     visitor.visit(m_default_collator);
+    for (auto& cached_format : m_cached_locale_formats)
+        visitor.visit(cached_format.format);
 
 #define __JS_ENUMERATE(snake_name, functionName, length) \
     visitor.visit(m_##snake_name##_abstract_operation_function);
@@ -545,34 +580,138 @@ GC::Ref<Intl::Collator> Intrinsics::default_collator()
     return *m_default_collator;
 }
 
-#define __JS_ENUMERATE(snake_name, functionName, length)                                                                                                                                                        \
-    GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_abstract_operation_function()                                                                                                              \
-    {                                                                                                                                                                                                           \
-        if (!m_##snake_name##_abstract_operation_function) {                                                                                                                                                    \
-            auto shared_data_list = parse_builtin_file(ABSTRACT_OPERATIONS, m_realm->vm());                                                                                                                     \
-            auto it = shared_data_list.find_if([](auto const& shared_data) {                                                                                                                                    \
-                return shared_data->m_name == #functionName##sv;                                                                                                                                                \
-            });                                                                                                                                                                                                 \
-            VERIFY(!it.is_end());                                                                                                                                                                               \
-            m_##snake_name##_abstract_operation_function = NativeJavaScriptBackedFunction::create(m_realm, **it, PropertyKey { #functionName##_utf16_fly_string, PropertyKey::StringMayBeNumber::No }, length); \
-        }                                                                                                                                                                                                       \
-        return *m_##snake_name##_abstract_operation_function;                                                                                                                                                   \
+// Table-like pages easily call toLocaleString() on tens of thousands of values, each time with the same arguments. A
+// handful of entries covers them.
+static constexpr size_t max_cached_locale_formats = 16;
+
+Optional<Intrinsics::LocaleFormatCacheKey> Intrinsics::locale_format_cache_key(LocaleFormatKind kind, Value locales, Value options)
+{
+    // Processing an options object, or a locales argument that isn't a String, is observable through getters.
+    if (!options.is_undefined())
+        return {};
+    if (!locales.is_undefined() && !locales.is_string())
+        return {};
+
+    LocaleFormatCacheKey key { .kind = kind, .locales = {}, .default_locale = MUST(String::from_utf8(Unicode::default_locale())), .time_zone = {} };
+    if (locales.is_string())
+        key.locales = locales.as_string().utf8_string();
+    if (kind != LocaleFormatKind::Number)
+        key.time_zone = system_time_zone_identifier();
+    return key;
+}
+
+GC::Ptr<Intl::IntlObject> Intrinsics::cached_locale_format(LocaleFormatCacheKey const& key)
+{
+    auto index = m_cached_locale_formats.find_first_index_if([&](auto const& cached_format) { return cached_format.key == key; });
+    if (!index.has_value())
+        return {};
+
+    auto cached_format = m_cached_locale_formats.take(*index);
+    auto format = cached_format.format;
+    m_cached_locale_formats.append(move(cached_format));
+    return format;
+}
+
+void Intrinsics::cache_locale_format(LocaleFormatCacheKey key, GC::Ref<Intl::IntlObject> format)
+{
+    if (m_cached_locale_formats.size() == max_cached_locale_formats)
+        m_cached_locale_formats.remove(0);
+    m_cached_locale_formats.append({ move(key), format });
+}
+
+ThrowCompletionOr<GC::Ref<Intl::NumberFormat>> Intrinsics::locale_number_format(Value locales, Value options)
+{
+    auto key = locale_format_cache_key(LocaleFormatKind::Number, locales, options);
+    if (key.has_value()) {
+        if (auto format = cached_locale_format(*key))
+            return as<Intl::NumberFormat>(*format);
+    }
+
+    auto format = as<Intl::NumberFormat>(*TRY(construct(vm(), intl_number_format_constructor(), locales, options)));
+    if (key.has_value())
+        cache_locale_format(key.release_value(), format);
+    return format;
+}
+
+ThrowCompletionOr<GC::Ref<Intl::DateTimeFormat>> Intrinsics::locale_date_time_format(LocaleFormatKind kind, Value locales, Value options)
+{
+    auto key = locale_format_cache_key(kind, locales, options);
+    if (key.has_value()) {
+        if (auto format = cached_locale_format(*key))
+            return as<Intl::DateTimeFormat>(*format);
+    }
+
+    auto required = Intl::OptionRequired::Any;
+    auto defaults = Intl::OptionDefaults::All;
+    switch (kind) {
+    case LocaleFormatKind::DateTime:
+        break;
+    case LocaleFormatKind::Date:
+        required = Intl::OptionRequired::Date;
+        defaults = Intl::OptionDefaults::Date;
+        break;
+    case LocaleFormatKind::Time:
+        required = Intl::OptionRequired::Time;
+        defaults = Intl::OptionDefaults::Time;
+        break;
+    case LocaleFormatKind::Number:
+        VERIFY_NOT_REACHED();
+    }
+
+    auto format = TRY(Intl::create_date_time_format(vm(), intl_date_time_format_constructor(), locales, options, required, defaults));
+    if (key.has_value())
+        cache_locale_format(key.release_value(), format);
+    return format;
+}
+
+static SharedFunctionInstanceData& find_builtin_function(Vector<GC::Root<SharedFunctionInstanceData>> const& shared_data_list, StringView name)
+{
+    auto it = shared_data_list.find_if([&](auto const& shared_data) {
+        return shared_data->m_name == name;
+    });
+    VERIFY(!it.is_end());
+    return **it;
+}
+
+// NB: Each builtin file is parsed once per realm, and all of the functions it provides are created together.
+void Intrinsics::initialize_native_javascript_backed_abstract_operations()
+{
+    auto shared_data_list = parse_builtin_file(ABSTRACT_OPERATIONS, m_realm->vm());
+
+#define __JS_ENUMERATE(snake_name, functionName, length)   \
+    VERIFY(!m_##snake_name##_abstract_operation_function); \
+    m_##snake_name##_abstract_operation_function = NativeJavaScriptBackedFunction::create(m_realm, find_builtin_function(shared_data_list, #functionName##sv), PropertyKey { #functionName##_utf16_fly_string, PropertyKey::StringMayBeNumber::No }, length);
+    JS_ENUMERATE_NATIVE_JAVASCRIPT_BACKED_ABSTRACT_OPERATIONS
+#undef __JS_ENUMERATE
+}
+
+void Intrinsics::initialize_native_javascript_backed_array_constructor_functions()
+{
+    auto shared_data_list = parse_builtin_file(ARRAY_CONSTRUCTOR, m_realm->vm());
+
+#define __JS_ENUMERATE(snake_name, functionName, length)  \
+    VERIFY(!m_##snake_name##_array_constructor_function); \
+    m_##snake_name##_array_constructor_function = NativeJavaScriptBackedFunction::create(m_realm, find_builtin_function(shared_data_list, #functionName##sv), PropertyKey { #functionName##_utf16_fly_string, PropertyKey::StringMayBeNumber::No }, length);
+    JS_ENUMERATE_NATIVE_JAVASCRIPT_BACKED_ARRAY_CONSTRUCTOR_FUNCTIONS
+#undef __JS_ENUMERATE
+}
+
+#define __JS_ENUMERATE(snake_name, functionName, length)                                           \
+    GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_abstract_operation_function() \
+    {                                                                                              \
+        if (!m_##snake_name##_abstract_operation_function)                                         \
+            initialize_native_javascript_backed_abstract_operations();                             \
+        return *m_##snake_name##_abstract_operation_function;                                      \
     }
 JS_ENUMERATE_NATIVE_JAVASCRIPT_BACKED_ABSTRACT_OPERATIONS
 #undef __JS_ENUMERATE
 
-#define __JS_ENUMERATE(snake_name, functionName, length)                                                                                                                                                       \
-    GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_array_constructor_function()                                                                                                              \
-    {                                                                                                                                                                                                          \
-        if (!m_##snake_name##_array_constructor_function) {                                                                                                                                                    \
-            auto shared_data_list = parse_builtin_file(ARRAY_CONSTRUCTOR, m_realm->vm());                                                                                                                      \
-            auto it = shared_data_list.find_if([](auto const& shared_data) {                                                                                                                                   \
-                return shared_data->m_name == #functionName##sv;                                                                                                                                               \
-            });                                                                                                                                                                                                \
-            VERIFY(!it.is_end());                                                                                                                                                                              \
-            m_##snake_name##_array_constructor_function = NativeJavaScriptBackedFunction::create(m_realm, **it, PropertyKey { #functionName##_utf16_fly_string, PropertyKey::StringMayBeNumber::No }, length); \
-        }                                                                                                                                                                                                      \
-        return *m_##snake_name##_array_constructor_function;                                                                                                                                                   \
+#define __JS_ENUMERATE(snake_name, functionName, length)                                          \
+    GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_array_constructor_function() \
+    {                                                                                             \
+        if (!m_##snake_name##_array_constructor_function)                                         \
+            initialize_native_javascript_backed_array_constructor_functions();                    \
+        return *m_##snake_name##_array_constructor_function;                                      \
     }
 JS_ENUMERATE_NATIVE_JAVASCRIPT_BACKED_ARRAY_CONSTRUCTOR_FUNCTIONS
 #undef __JS_ENUMERATE
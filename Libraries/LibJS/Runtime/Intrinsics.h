@@ -7,10 +7,14 @@
 
 #pragma once
 
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Export.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/Completion.h>
 
 namespace JS {
 
@@ -104,9 +108,9 @@ public:
 
     // Namespace/constructor object functions
     GC::Ref<FunctionObject> array_prototype_values_function() const { return *m_array_prototype_values_function; }
-    GC::Ref<FunctionObject> date_constructor_now_function() const { return *m_date_constructor_now_function; }
-    GC::Ref<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
-    GC::Ref<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
+    GC::Ref<FunctionObject> date_constructor_now_function();
+    GC::Ref<FunctionObject> json_parse_function();
+    GC::Ref<FunctionObject> json_stringify_function();
     GC::Ref<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
     GC::Ref<FunctionObject> throw_type_error_function() const { return *m_throw_type_error_function; }
 
@@ -143,6 +147,18 @@ public:
 
     [[nodiscard]] GC::Ref<Intl::Collator> default_collator();
 
+    // The formatters that toLocaleString() and friends construct. Those constructed without options are cached, and
+    // reused for as long as the locales argument, the default locale and (for date/time formats) the system time zone
+    // stay the same, as nothing else affects their resolved options.
+    enum class LocaleFormatKind : u8 {
+        Number,
+        DateTime,
+        Date,
+        Time,
+    };
+    [[nodiscard]] ThrowCompletionOr<GC::Ref<Intl::NumberFormat>> locale_number_format(Value locales, Value options);
+    [[nodiscard]] ThrowCompletionOr<GC::Ref<Intl::DateTimeFormat>> locale_date_time_format(LocaleFormatKind, Value locales, Value options);
+
 #define __JS_ENUMERATE(snake_name, functionName, length) \
     GC::Ref<NativeJavaScriptBackedFunction> snake_name##_abstract_operation_function();
     JS_ENUMERATE_NATIVE_JAVASCRIPT_BACKED_ABSTRACT_OPERATIONS
@@ -162,6 +178,8 @@ private:
     virtual void visit_edges(Visitor&) override;
 
     void initialize_intrinsics(Realm&);
+    void initialize_native_javascript_backed_abstract_operations();
+    void initialize_native_javascript_backed_array_constructor_functions();
 
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
     void initialize_##snake_name();
@@ -290,6 +308,26 @@ private:
 #undef __JS_ENUMERATE
 
     GC::Ptr<Intl::Collator> m_default_collator;
+
+    struct LocaleFormatCacheKey {
+        LocaleFormatKind kind;
+        Optional<String> locales;
+        String default_locale;
+        String time_zone;
+
+        bool operator==(LocaleFormatCacheKey const&) const = default;
+    };
+    struct CachedLocaleFormat {
+        LocaleFormatCacheKey key;
+        GC::Ref<Intl::IntlObject> format;
+    };
+
+    static Optional<LocaleFormatCacheKey> locale_format_cache_key(LocaleFormatKind, Value locales, Value options);
+    GC::Ptr<Intl::IntlObject> cached_locale_format(LocaleFormatCacheKey const&);
+    void cache_locale_format(LocaleFormatCacheKey, GC::Ref<Intl::IntlObject>);
+
+    // Ordered from least to most recently used.
+    Vector<CachedLocaleFormat> m_cached_locale_formats;
 };
 
 void add_restricted_function_properties(FunctionObject&, Realm&);
@@ -11,6 +11,7 @@
 #include <AK/TypeCasts.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
+#include <LibGC/ConservativeHashMap.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/BigIntObject.h>
@@ -22,6 +23,7 @@
 #include <LibJS/Runtime/NumberObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/RawJSONObject.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/StringObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -258,6 +260,19 @@ static void write_indent(StringBuilder& builder, StringView gap, size_t depth)
         builder.append(gap);
 }
 
+// Plain data objects (like everything JSON.parse produces) have ordinary internal methods and all of their own
+// properties in shape-described named storage, so their keys can be taken from the shape and their values read
+// straight out of storage.
+static bool can_serialize_from_property_storage(Object const& object)
+{
+    auto const& shape = object.shape();
+    if (shape.is_dictionary() || shape.prototype() != shape.realm().intrinsics().object_prototype())
+        return false;
+    if (object.is_proxy_object() || object.has_parameter_map() || object.has_intrinsic_accessors() || object.has_magical_length_property())
+        return false;
+    return object.eligible_for_own_property_enumeration_fast_path() && object.indexed_array_like_size() == 0;
+}
+
 // 25.5.2.4 SerializeJSONObject ( state, value ), https://tc39.es/ecma262/#sec-serializejsonobject
 ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
 {
@@ -272,7 +287,8 @@ ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState
     size_t position_after_open_brace = builder.length();
     bool first = true;
 
-    auto process_property = [&](PropertyKey const& key) -> ThrowCompletionOr<void> {
+    // A known value has already been read from the object, and is a primitive that serializes without running user code.
+    auto process_property = [&](PropertyKey const& key, Optional<Value> known_value) -> ThrowCompletionOr<void> {
         if (key.is_symbol())
             return {};
 
@@ -298,7 +314,11 @@ ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState
             builder.append(' ');
 
         // Serialize value
-        bool wrote_value = TRY(serialize_json_property(vm, state, key, &object));
+        bool wrote_value = false;
+        if (known_value.has_value())
+            wrote_value = serialize_json_primitive(builder, *known_value);
+        else
+            wrote_value = TRY(serialize_json_property(vm, state, key, &object));
 
         if (wrote_value) {
             first = false;
@@ -312,11 +332,35 @@ ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState
     if (state.property_list.has_value()) {
         auto property_list = state.property_list.value();
         for (auto& property : property_list)
-            TRY(process_property(property));
+            TRY(process_property(property, {}));
+    } else if (!state.replacer_function && can_serialize_from_property_storage(object)) {
+        struct StoredProperty {
+            PropertyKey key;
+            u32 offset;
+        };
+        Vector<StoredProperty, 16> property_list;
+        auto const& shape = object.shape();
+        shape.for_each_property_in_insertion_order([&](PropertyKey const& key, PropertyMetadata const& metadata) {
+            if (key.is_string() && metadata.attributes.is_enumerable())
+                property_list.append({ key, metadata.offset });
+        });
+
+        for (auto& property : property_list) {
+            // Serializing a nested value may run a toJSON method that reshapes this object. The key list stays as it
+            // was, like the spec's, but values then have to be looked up the regular way.
+            if (&object.shape() == &shape) {
+                auto value = object.get_direct(property.offset);
+                if (!value.is_accessor() && !value.is_object() && !value.is_bigint()) {
+                    TRY(process_property(property.key, value));
+                    continue;
+                }
+            }
+            TRY(process_property(property.key, {}));
+        }
     } else {
         auto property_list = TRY(object.enumerable_own_property_names(PropertyKind::Key));
         for (auto& property : property_list)
-            TRY(process_property(property.as_string().utf16_string()));
+            TRY(process_property(property.as_string().utf16_string(), {}));
     }
 
     // Close the object
@@ -331,6 +375,34 @@ ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState
     return {};
 }
 
+// Steps 5-9 and 12 of SerializeJSONProperty, for a value that is not an Object or a BigInt and so needs none of the
+// preceding steps.
+bool JSONObject::serialize_json_primitive(StringBuilder& builder, Value value)
+{
+    VERIFY(!value.is_object() && !value.is_bigint());
+
+    if (value.is_null()) {
+        builder.append("null"sv);
+        return true;
+    }
+    if (value.is_boolean()) {
+        builder.append(value.as_bool() ? "true"sv : "false"sv);
+        return true;
+    }
+    if (value.is_string()) {
+        quote_json_string(builder, value.as_string().utf16_string_view());
+        return true;
+    }
+    if (value.is_number()) {
+        if (value.is_finite_number())
+            number_to_string(builder, value.as_double());
+        else
+            builder.append("null"sv);
+        return true;
+    }
+    return false;
+}
+
 // 25.5.2.5 SerializeJSONArray ( state, value ), https://tc39.es/ecma262/#sec-serializejsonarray
 ThrowCompletionOr<void> JSONObject::serialize_json_array(VM& vm, StringifyState& state, Object& object)
 {
@@ -577,7 +649,16 @@ static ALWAYS_INLINE ThrowCompletionOr<void> ensure_simdjson_fully_parsed(VM& vm
     return {};
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_value(VM&, simdjson::ondemand::value);
+// Documents tend to repeat the same object layout many times over (think arrays of records), so we remember the shape
+// each parsed object ended up with, keyed by its first property. The next object starting with that key is allocated
+// directly in the final shape and has its values written straight into property storage, instead of walking the
+// transition chain one property at a time. The map is conservatively scanned, as an object whose shape is cached here
+// may be dropped again if a later duplicate key overwrites it.
+struct JSONParseState {
+    GC::ConservativeHashMap<PropertyKey, GC::Ref<Shape>> object_shapes;
+};
+
+static ThrowCompletionOr<Value> parse_simdjson_value(VM&, JSONParseState&, simdjson::ondemand::value);
 
 template<typename T>
 static ThrowCompletionOr<Value> parse_simdjson_number(VM& vm, T& value, StringView raw_sv)
@@ -640,7 +721,7 @@ static ThrowCompletionOr<Value> parse_simdjson_string(VM& vm, T& value)
 }
 
 template<typename T>
-static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, T& value)
+static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, JSONParseState& state, T& value)
 {
     auto& realm = *vm.current_realm();
 
@@ -655,7 +736,7 @@ static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, T& value)
         simdjson::ondemand::value element_value;
         if (element.get(element_value))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto parsed = TRY(parse_simdjson_value(vm, element_value));
+        auto parsed = TRY(parse_simdjson_value(vm, state, element_value));
         array->define_direct_property(index++, parsed, default_attributes);
     }
 
@@ -663,8 +744,20 @@ static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, T& value)
     return array;
 }
 
+// The object turned out not to match the shape we predicted for it, so move the properties written so far into an
+// object that builds its shape the regular way.
+COLD static GC::Ref<Object> rebuild_object_with_mispredicted_shape(Realm& realm, Object const& object, u32 property_count)
+{
+    auto rebuilt_object = Object::create(realm, realm.intrinsics().object_prototype());
+    object.shape().for_each_property_in_insertion_order([&](PropertyKey const& key, PropertyMetadata const& metadata) {
+        if (metadata.offset < property_count)
+            rebuilt_object->define_direct_property(key, object.get_direct(metadata.offset), default_attributes);
+    });
+    return rebuilt_object;
+}
+
 template<typename T>
-static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, T& value)
+static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, JSONParseState& state, T& value)
 {
     auto& realm = *vm.current_realm();
 
@@ -672,7 +765,10 @@ static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, T& value)
     if (value.get_object().get(simdjson_object))
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
 
-    auto object = Object::create(realm, realm.intrinsics().object_prototype());
+    GC::Ptr<Object> object;
+    GC::Ptr<Shape> predicted_shape;
+    Optional<PropertyKey> first_key;
+    u32 property_count = 0;
 
     for (auto field : simdjson_object) {
         // Use escaped_key() to get the raw JSON key (with escapes), then unescape ourselves
@@ -682,18 +778,49 @@ static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, T& value)
         auto unescaped_key = unescape_json_string({ raw_key.data(), raw_key.size() });
         if (!unescaped_key.has_value())
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+        PropertyKey key { unescaped_key.release_value() };
+
+        if (!object) {
+            first_key = key;
+            if (auto shape = state.object_shapes.get(key); shape.has_value()) {
+                predicted_shape = *shape;
+                object = Object::create_with_premade_shape(*predicted_shape);
+            } else {
+                object = Object::create(realm, realm.intrinsics().object_prototype());
+            }
+        }
+
         simdjson::ondemand::value field_value;
         if (field.value().get(field_value))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto parsed = TRY(parse_simdjson_value(vm, field_value));
-        object->define_direct_property(unescaped_key.release_value(), parsed, default_attributes);
+        auto parsed = TRY(parse_simdjson_value(vm, state, field_value));
+
+        if (predicted_shape) {
+            // Every property in a cached shape was added by a previous object in this document, so they are all
+            // default-attributed data properties at consecutive offsets. Numeric and duplicate keys never match.
+            if (auto metadata = predicted_shape->lookup(key); metadata.has_value() && metadata->offset == property_count) {
+                object->put_direct(property_count++, parsed);
+                continue;
+            }
+            object = rebuild_object_with_mispredicted_shape(realm, *object, property_count);
+            predicted_shape = nullptr;
+        }
+
+        object->define_direct_property(key, parsed, default_attributes);
     }
 
+    if (!object)
+        object = Object::create(realm, realm.intrinsics().object_prototype());
+    else if (predicted_shape && property_count != predicted_shape->property_count())
+        object = rebuild_object_with_mispredicted_shape(realm, *object, property_count);
+    else if (!predicted_shape && first_key->is_string() && !object->shape().is_dictionary())
+        state.object_shapes.set(first_key.release_value(), object->shape());
+
     TRY(ensure_simdjson_fully_parsed(vm, value));
     return object;
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, simdjson::ondemand::value value)
+static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONParseState& state, simdjson::ondemand::value value)
 {
     simdjson::ondemand::json_type type;
     if (value.type().get(type))
@@ -716,9 +843,9 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, simdjson::ondemand:
     case simdjson::ondemand::json_type::string:
         return parse_simdjson_string(vm, value);
     case simdjson::ondemand::json_type::array:
-        return parse_simdjson_array(vm, value);
+        return parse_simdjson_array(vm, state, value);
     case simdjson::ondemand::json_type::object:
-        return parse_simdjson_object(vm, value);
+        return parse_simdjson_object(vm, state, value);
     case simdjson::ondemand::json_type::unknown:
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
     }
@@ -728,6 +855,8 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, simdjson::ondemand:
 
 static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, simdjson::ondemand::document& document)
 {
+    JSONParseState state;
+
     simdjson::ondemand::json_type type;
     if (document.type().get(type))
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
@@ -760,9 +889,9 @@ static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, simdjson::ondema
     case simdjson::ondemand::json_type::string:
         return parse_simdjson_string(vm, document);
     case simdjson::ondemand::json_type::array:
-        return parse_simdjson_array(vm, document);
+        return parse_simdjson_array(vm, state, document);
     case simdjson::ondemand::json_type::object:
-        return parse_simdjson_object(vm, document);
+        return parse_simdjson_object(vm, state, document);
     case simdjson::ondemand::json_type::unknown:
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
     }
@@ -41,6 +41,7 @@ private:
     static ThrowCompletionOr<bool> serialize_json_property(VM&, StringifyState&, PropertyKey const& key, Object* holder);
     static ThrowCompletionOr<void> serialize_json_object(VM&, StringifyState&, Object&);
     static ThrowCompletionOr<void> serialize_json_array(VM&, StringifyState&, Object&);
+    static bool serialize_json_primitive(StringBuilder&, Value);
     static void quote_json_string(StringBuilder&, Utf16View const&);
 
     // Parse helpers
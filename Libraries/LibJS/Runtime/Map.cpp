@@ -25,80 +25,157 @@ Map::Map(Object& prototype)
 void Map::map_clear()
 {
     auto old_external_memory_size = external_memory_size();
-    m_keys.clear();
     m_entries.clear();
+    m_buckets.clear();
+    m_live_entry_count = 0;
+    ++m_compaction_epoch;
     account_external_memory_change(old_external_memory_size);
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
+    auto index = find_entry(key);
     if (!index.has_value())
         return false;
 
-    auto old_external_memory_size = external_memory_size();
-    m_keys.remove(*index);
-    m_entries.remove(key);
-    account_external_memory_change(old_external_memory_size);
+    // NOTE: The entry is left in place as a tombstone, so that iterators and positions of other entries are
+    //       unaffected. It is dropped the next time the table is rehashed.
+    auto& entry = m_entries[*index];
+    entry.key = js_special_empty_value();
+    entry.value = js_undefined();
+    --m_live_entry_count;
+
+    // Shrink once fewer than a quarter of the usable slots are live, so that a Map doesn't hold on to its peak size.
+    // Halving leaves the table at most a quarter full, so it takes many more operations to grow or shrink again.
+    if (m_buckets.size() > minimum_bucket_count && m_live_entry_count * 8 < m_buckets.size()) {
+        auto old_external_memory_size = external_memory_size();
+        rehash(m_buckets.size() / 2);
+        account_external_memory_change(old_external_memory_size);
+    }
     return true;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto index = find_entry(key); index.has_value())
+        return m_entries[*index].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_entry(key).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto old_external_memory_size = external_memory_size();
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
-        account_external_memory_change(old_external_memory_size);
+    if (auto index = find_entry(key); index.has_value()) {
+        m_entries[*index].value = value;
+        return;
     }
+
+    auto old_external_memory_size = external_memory_size();
+    if ((m_entries.size() + 1) * 2 > m_buckets.size()) {
+        // The table is half full. If tombstones make up at least half of the entries, compacting at the current size
+        // frees a quarter of the buckets. Otherwise we double, which leaves at least as much room. Either way, the next
+        // rehash is a number of insertions proportional to the table size away, so delete+insert churn stays linear.
+        auto tombstone_count = m_entries.size() - m_live_entry_count;
+        if (m_buckets.is_empty())
+            rehash(minimum_bucket_count);
+        else if (tombstone_count * 2 >= m_entries.size())
+            rehash(m_buckets.size());
+        else
+            rehash(m_buckets.size() * 2);
+    }
+    insert_into_buckets(m_entries.size(), ValueTraits::hash(key));
+    m_entries.append({ key, value, m_next_insertion_id++ });
+    ++m_live_entry_count;
+    account_external_memory_change(old_external_memory_size);
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_live_entry_count;
 }
 
-static size_t map_key_tree_external_memory_size(RedBlackTree<size_t, Value> const& keys)
+void Map::copy_entries_from(Map const& other)
 {
-    constexpr auto approximate_node_size = sizeof(AK::BaseRedBlackTree<size_t>::Node) + sizeof(Value);
-    if (keys.size() > NumericLimits<size_t>::max() / approximate_node_size)
-        return NumericLimits<size_t>::max();
-    return keys.size() * approximate_node_size;
+    VERIFY(m_entries.is_empty());
+    if (other.m_live_entry_count == 0)
+        return;
+
+    auto old_external_memory_size = external_memory_size();
+    size_t bucket_count = minimum_bucket_count;
+    while (bucket_count < other.m_live_entry_count * 2)
+        bucket_count *= 2;
+    rehash(bucket_count);
+    m_entries.ensure_capacity(other.m_live_entry_count);
+    for (auto const& entry : other.m_entries) {
+        if (entry.is_removed())
+            continue;
+        insert_into_buckets(m_entries.size(), ValueTraits::hash(entry.key));
+        m_entries.unchecked_append({ entry.key, entry.value, m_next_insertion_id++ });
+    }
+    m_live_entry_count = other.m_live_entry_count;
+    account_external_memory_change(old_external_memory_size);
+}
+
+Optional<size_t> Map::find_entry(Value const& key) const
+{
+    if (m_buckets.is_empty())
+        return {};
+
+    auto mask = m_buckets.size() - 1;
+    for (auto bucket_index = ValueTraits::hash(key) & mask;; bucket_index = (bucket_index + 1) & mask) {
+        auto entry_index = m_buckets[bucket_index];
+        if (entry_index == empty_bucket)
+            return {};
+        // NOTE: Tombstones keep their bucket until the next rehash, but can never match since their key is empty.
+        auto const& entry = m_entries[entry_index];
+        if (!entry.is_removed() && ValueTraits::equals(entry.key, key))
+            return entry_index;
+    }
+}
+
+void Map::insert_into_buckets(size_t entry_index, unsigned hash)
+{
+    auto mask = m_buckets.size() - 1;
+    auto bucket_index = hash & mask;
+    while (m_buckets[bucket_index] != empty_bucket)
+        bucket_index = (bucket_index + 1) & mask;
+    m_buckets[bucket_index] = static_cast<u32>(entry_index);
+}
+
+void Map::rehash(size_t bucket_count)
+{
+    VERIFY(is_power_of_two(bucket_count));
+    VERIFY(bucket_count >= minimum_bucket_count && bucket_count <= empty_bucket);
+    bool shrinking = bucket_count < m_buckets.size();
+
+    // Drop tombstones first. Iterators notice the new epoch and find their place again by insertion id.
+    if (m_live_entry_count != m_entries.size()) {
+        m_entries.remove_all_matching([](Entry const& entry) { return entry.is_removed(); });
+        ++m_compaction_epoch;
+    }
+    VERIFY(m_entries.size() * 2 <= bucket_count);
+    if (shrinking)
+        m_entries.shrink_to_fit();
+
+    m_buckets.clear();
+    m_buckets.resize_with_default_value(bucket_count, empty_bucket);
+    for (size_t i = 0; i < m_entries.size(); ++i)
+        insert_into_buckets(i, ValueTraits::hash(m_entries[i].key));
 }
 
 size_t Map::external_memory_size() const
 {
     auto size = Object::external_memory_size();
-    size = saturating_add_external_memory_size(size, map_key_tree_external_memory_size(m_keys));
-    size = saturating_add_external_memory_size(size, hash_map_external_memory_size(m_entries));
+    size = saturating_add_external_memory_size(size, vector_external_memory_size(m_entries));
+    size = saturating_add_external_memory_size(size, vector_external_memory_size(m_buckets));
     return size;
 }
 
@@ -114,12 +191,10 @@ void Map::account_external_memory_change(size_t old_external_memory_size)
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& entry : m_entries) {
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
 }
 
 }
@@ -6,8 +6,8 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/NumericLimits.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -36,36 +36,50 @@ public:
 
     virtual size_t external_memory_size() const override;
 
+    struct Entry {
+        Value key;
+        Value value;
+        size_t insertion_id { 0 };
+
+        // NOTE: Removed entries stay behind as tombstones until the next compaction.
+        bool is_removed() const { return key.is_special_empty_value(); }
+    };
+
     struct EndIterator {
     };
 
+    // Iterators remember the insertion id of the entry they are on, so they stay valid across removals and
+    // compactions of the entry list, and keep seeing entries added after a clear().
     template<bool IsConst>
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_next_element();
+            return m_position >= m_map->m_entries.size();
         }
 
+        // NOTE: This deliberately doesn't look at the entries again: the current entry may have been removed (and the
+        //       list compacted) since it was returned, and we must not skip over its successor.
         IteratorImpl& operator++()
         {
-            ++m_index;
+            ++m_insertion_id;
+            ++m_position;
             return *this;
         }
 
         decltype(auto) operator*()
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return m_map->m_entries[m_position];
         }
 
         decltype(auto) operator*() const
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return m_map->m_entries[m_position];
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        bool operator==(IteratorImpl const& other) const { return m_insertion_id == other.m_insertion_id && &m_map == &other.m_map; }
         bool operator==(EndIterator const&) const { return is_end(); }
 
         void visit_edges(Cell::Visitor& visitor)
@@ -78,35 +92,44 @@ public:
         IteratorImpl(Map const& map)
         requires(IsConst)
             : m_map(map)
+            , m_compaction_epoch(map.m_compaction_epoch)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
+            , m_compaction_epoch(map.m_compaction_epoch)
         {
-            ensure_index();
-        }
-
-        void ensure_index() const
-        {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
         }
 
         void ensure_next_element() const
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            auto const& entries = m_map->m_entries;
+            if (m_compaction_epoch != m_map->m_compaction_epoch) {
+                // The entry list was compacted, so find our place again by insertion id.
+                size_t low = 0;
+                size_t high = entries.size();
+                while (low < high) {
+                    auto middle = low + (high - low) / 2;
+                    if (entries[middle].insertion_id < m_insertion_id)
+                        low = middle + 1;
+                    else
+                        high = middle;
+                }
+                m_position = low;
+                m_compaction_epoch = m_map->m_compaction_epoch;
+            }
+            while (m_position < entries.size() && entries[m_position].is_removed())
+                ++m_position;
+            if (m_position < entries.size())
+                m_insertion_id = entries[m_position].insertion_id;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
-        mutable size_t m_index { 0 };
+        mutable size_t m_position { 0 };
+        mutable size_t m_insertion_id { 0 };
+        mutable u64 m_compaction_epoch { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -116,15 +139,30 @@ public:
     Iterator begin() { return { *this }; }
     EndIterator end() const { return {}; }
 
+    void copy_entries_from(Map const&);
+
 private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
     void account_external_memory_change(size_t old_external_memory_size);
 
+    Optional<size_t> find_entry(Value const& key) const;
+    void insert_into_buckets(size_t entry_index, unsigned hash);
+    void rehash(size_t bucket_count);
+
+    static constexpr u32 empty_bucket = NumericLimits<u32>::max();
+    static constexpr size_t minimum_bucket_count = 8;
+
     size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    size_t m_live_entry_count { 0 };
+    u64 m_compaction_epoch { 0 };
+
+    // Entries in insertion order, including tombstones for removed ones.
+    Vector<Entry> m_entries;
+
+    // Open-addressed index into m_entries with a power-of-two size, kept at most half full.
+    Vector<u32> m_buckets;
 };
 
 template<>
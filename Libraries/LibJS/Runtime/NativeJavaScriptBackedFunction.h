@@ -22,7 +22,7 @@ public:
 
     virtual void visit_edges(Visitor&) override;
 
-    virtual void get_stack_frame_info(size_t& registers_and_locals_count, ReadonlySpan<Value>& constants, size_t& argument_count) override;
+    virtual void get_stack_frame_info(size_t& registers_and_locals_count, size_t& argument_count) override;
 
     virtual ThrowCompletionOr<Value> call() override;
 
@@ -1639,18 +1639,43 @@ Optional<Completion> Object::enumerate_object_properties(Function<Optional<Compl
 void Object::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    visitor.visit(m_shape);
-    if (auto count = shape().property_count())
-        visitor.visit(Span<Value> { m_named_properties, count });
+    visitor.visit_named(Visitor::EdgeType::Internal, "shape"sv, m_shape);
+    if (auto count = shape().property_count()) {
+        Span<Value> named_properties { m_named_properties, count };
+        if (visitor.wants_edge_names()) [[unlikely]] {
+            // Heap snapshots show properties by name. Any slot the shape has no key for is still visited, so these are
+            // the same edges that marking sees.
+            Vector<bool> visited_slots;
+            visited_slots.resize(count);
+            shape().for_each_property_in_insertion_order([&](PropertyKey const& key, PropertyMetadata const& metadata) {
+                if (metadata.offset >= count || visited_slots[metadata.offset])
+                    return;
+                visited_slots[metadata.offset] = true;
+                auto name = key.to_string().to_utf8();
+                visitor.visit_named(Visitor::EdgeType::Property, name.bytes_as_string_view(), named_properties[metadata.offset]);
+            });
+            for (u32 i = 0; i < count; ++i) {
+                if (!visited_slots[i])
+                    visitor.visit(named_properties[i]);
+            }
+        } else {
+            visitor.visit(named_properties);
+        }
+    }
 
     switch (m_indexed_storage_kind) {
     case IndexedStorageKind::None:
         break;
     case IndexedStorageKind::Packed:
+        // Numeric elements never reference cells, so there is nothing to visit.
+        if (m_indexed_element_kind != IndexedElementKind::Any)
+            break;
         for (u32 i = 0; i < m_indexed_array_like_size; ++i)
             visitor.visit(m_indexed_elements[i]);
         break;
     case IndexedStorageKind::Holey:
+        if (m_indexed_element_kind != IndexedElementKind::Any)
+            break;
         for (u32 i = 0, available_elements = min(m_indexed_array_like_size, indexed_elements_capacity()); i < available_elements; ++i) {
             if (!m_indexed_elements[i].is_special_empty_value())
                 visitor.visit(m_indexed_elements[i]);
@@ -1783,9 +1808,17 @@ void Object::free_indexed_elements()
     }
     m_indexed_elements = nullptr;
     m_indexed_storage_kind = IndexedStorageKind::None;
+    m_indexed_element_kind = IndexedElementKind::Int32;
     m_indexed_array_like_size = 0;
 }
 
+void Object::widen_indexed_element_kind(Value value)
+{
+    if (m_indexed_element_kind == IndexedElementKind::Any || value.is_int32() || value.is_special_empty_value())
+        return;
+    m_indexed_element_kind = value.is_number() ? IndexedElementKind::Double : IndexedElementKind::Any;
+}
+
 void Object::ensure_indexed_elements(u32 needed_capacity)
 {
     if (m_indexed_elements && indexed_elements_capacity() >= needed_capacity)
@@ -1832,6 +1865,7 @@ void Object::transition_to_dictionary()
 
     m_indexed_elements = reinterpret_cast<Value*>(dict);
     m_indexed_storage_kind = IndexedStorageKind::Dictionary;
+    m_indexed_element_kind = IndexedElementKind::Any;
 }
 
 Optional<ValueAndAttributes> Object::indexed_get(u32 index) const
@@ -1892,6 +1926,7 @@ void Object::indexed_put(u32 index, Value value, PropertyAttributes attributes)
         m_indexed_storage_kind = storing_hole || index > 0 ? IndexedStorageKind::Holey : IndexedStorageKind::Packed;
         u32 needed = index + 1;
         ensure_indexed_elements(needed);
+        widen_indexed_element_kind(value);
         m_indexed_elements[index] = value;
         m_indexed_array_like_size = max(m_indexed_array_like_size, index + 1);
         return;
@@ -1917,6 +1952,7 @@ void Object::indexed_put(u32 index, Value value, PropertyAttributes attributes)
     if (m_indexed_storage_kind == IndexedStorageKind::Packed && storing_hole)
         m_indexed_storage_kind = IndexedStorageKind::Holey;
 
+    widen_indexed_element_kind(value);
     m_indexed_elements[index] = value;
 
     // Promote Holey -> Packed when filling the last hole.
@@ -2133,8 +2169,10 @@ void Object::set_indexed_property_elements(Vector<Value>&& values)
     m_indexed_storage_kind = IndexedStorageKind::Packed;
     m_indexed_array_like_size = size;
     m_indexed_elements = allocate_indexed_elements(size);
-    for (u32 i = 0; i < size; ++i)
+    for (u32 i = 0; i < size; ++i) {
+        widen_indexed_element_kind(values[i]);
         m_indexed_elements[i] = values[i];
+    }
 }
 
 ReadonlySpan<Value> Object::indexed_packed_elements_span() const
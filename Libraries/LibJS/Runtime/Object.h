@@ -77,6 +77,15 @@ enum class IndexedStorageKind : u8 {
     Dictionary = 3,
 };
 
+// Describes which values the non-hole elements of Packed/Holey storage may hold.
+// The kind only ever widens (Int32 -> Double -> Any) until the storage is freed,
+// so numeric arrays never need their elements visited by the GC.
+enum class IndexedElementKind : u8 {
+    Int32 = 0,
+    Double = 1,
+    Any = 2,
+};
+
 class JS_API Object : public Cell {
     GC_CELL(Object, Cell);
     GC_DECLARE_ALLOCATOR(Object);
@@ -312,6 +321,7 @@ public:
     Vector<u32> indexed_indices() const;
     void set_indexed_property_elements(Vector<Value>&& values);
     IndexedStorageKind indexed_storage_kind() const { return m_indexed_storage_kind; }
+    IndexedElementKind indexed_element_kind() const { return m_indexed_element_kind; }
 
     template<typename Callback>
     void indexed_for_each_value(Callback callback)
@@ -386,7 +396,8 @@ private:
 
     u8 m_flags { Flag::IsExtensible };
     IndexedStorageKind m_indexed_storage_kind { IndexedStorageKind::None };
-    // 2 bytes padding
+    IndexedElementKind m_indexed_element_kind { IndexedElementKind::Int32 };
+    // 1 byte padding
     u32 m_indexed_array_like_size { 0 };
     void set_shape(Shape& shape) { m_shape = &shape; }
 
@@ -399,6 +410,7 @@ private:
     void grow_indexed_elements(u32 needed_capacity);
     void transition_to_dictionary();
     void free_indexed_elements();
+    void widen_indexed_element_kind(Value);
     void ensure_named_storage_capacity(u32 needed);
     bool named_storage_is_inline() const { return m_named_properties == const_cast<Object*>(this)->m_inline_named_storage; }
     size_t named_storage_external_memory_size() const;
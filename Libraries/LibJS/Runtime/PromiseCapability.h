@@ -19,6 +19,8 @@ class JS_API PromiseCapability final : public Cell {
     GC_DECLARE_ALLOCATOR(PromiseCapability);
 
 public:
+    static constexpr bool CAN_BE_SWEPT_CONCURRENTLY = true;
+
     static GC::Ref<PromiseCapability> create(VM& vm, GC::Ref<Object> promise, GC::Ref<FunctionObject> resolve, GC::Ref<FunctionObject> reject);
 
     virtual ~PromiseCapability() = default;
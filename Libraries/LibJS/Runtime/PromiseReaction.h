@@ -19,6 +19,8 @@ class PromiseReaction final : public Cell {
     GC_DECLARE_ALLOCATOR(PromiseReaction);
 
 public:
+    static constexpr bool CAN_BE_SWEPT_CONCURRENTLY = true;
+
     enum class Type {
         Fulfill,
         Reject,
@@ -398,35 +398,17 @@ ThrowCompletionOr<GC::Ref<RegExpObject>> RegExpObject::regexp_initialize(VM& vm,
     if (validated_flags_or_error.is_error())
         return vm.throw_completion<SyntaxError>(validated_flags_or_error.release_error());
     auto flag_bits = validated_flags_or_error.release_value();
-    bool unicode = has_flag(flag_bits, Flags::Unicode);
-    bool unicode_sets = has_flag(flag_bits, Flags::UnicodeSets);
-
-    auto parsed_pattern = String {};
-
-    // Convert UTF-16 pattern to UTF-8 (with escape normalization for non-ASCII).
-    if (!pattern.is_empty()) {
-        auto result = parse_regex_pattern(pattern, unicode, unicode_sets);
-        if (result.is_error())
-            return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, result.release_error().error);
-        parsed_pattern = result.release_value();
-    }
 
     // 11. If u is true and v is true, throw a SyntaxError exception.
     // NB: Already handled by validate_flags above.
 
-    // Validate by trial-compiling the pattern.
-    regex::ECMAScriptCompileFlags compile_flags {};
-    compile_flags.global = has_flag(flag_bits, Flags::Global);
-    compile_flags.ignore_case = has_flag(flag_bits, Flags::IgnoreCase);
-    compile_flags.multiline = has_flag(flag_bits, Flags::Multiline);
-    compile_flags.dot_all = has_flag(flag_bits, Flags::DotAll);
-    compile_flags.unicode = unicode;
-    compile_flags.unicode_sets = unicode_sets;
-    compile_flags.sticky = has_flag(flag_bits, Flags::Sticky);
-
-    auto compiled = regex::ECMAScriptRegex::compile(parsed_pattern.bytes_as_string_view(), compile_flags);
+    // 12-15. Parse and validate the pattern.
+    // NB: Compiled regexes are shared by every RegExp with the same source and flags, so repeatedly constructing the
+    //     same dynamic pattern only compiles it once.
+    auto compiled = CompiledRegExpCache::the().get_or_compile(pattern.utf16_view(), static_cast<u8>(flag_bits));
     if (compiled.is_error())
         return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, compiled.release_error());
+    m_cached_regex = compiled.release_value();
 
     // 16. Set obj.[[OriginalSource]] to P.
     m_pattern = move(pattern);
@@ -11,6 +11,7 @@
 #include <AK/Optional.h>
 #include <AK/Result.h>
 #include <LibJS/Export.h>
+#include <LibJS/Runtime/CompiledRegExpCache.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibRegex/ECMAScriptRegex.h>
 
@@ -59,8 +60,8 @@ public:
     void set_legacy_features_enabled(bool legacy_features_enabled) { m_legacy_features_enabled = legacy_features_enabled; }
     void set_realm(Realm& realm) { m_realm = &realm; }
 
-    regex::ECMAScriptRegex const* cached_regex() const { return m_cached_regex; }
-    void set_cached_regex(regex::ECMAScriptRegex const* ptr) const { m_cached_regex = ptr; }
+    regex::ECMAScriptRegex const* cached_regex() const { return m_cached_regex ? &m_cached_regex->regex() : nullptr; }
+    void set_cached_regex(NonnullRefPtr<CompiledRegExp> compiled) const { m_cached_regex = move(compiled); }
 
 private:
     RegExpObject(Object& prototype);
@@ -73,7 +74,7 @@ private:
     Utf16String m_flags;
     Flags m_flag_bits { 0 };
     bool m_legacy_features_enabled { false }; // [[LegacyFeaturesEnabled]]
-    mutable regex::ECMAScriptRegex const* m_cached_regex { nullptr };
+    mutable RefPtr<CompiledRegExp> m_cached_regex;
     // Note: This is initialized in RegExpAlloc, but will be non-null afterwards
     GC::Ptr<Realm> m_realm; // [[Realm]]
 };
@@ -8,11 +8,11 @@
 
 #include <AK/CharacterTypes.h>
 #include <AK/Function.h>
-#include <AK/HashMap.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/CompiledRegExpCache.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/ErrorTypes.h>
 #include <LibJS/Runtime/GlobalObject.h>
@@ -75,58 +75,18 @@ static ThrowCompletionOr<void> increment_last_index(VM& vm, Object& regexp_objec
     return {};
 }
 
-// FIXME: Add an eviction policy to bound the size of this cache.
-static HashMap<String, NonnullOwnPtr<regex::ECMAScriptRegex>> s_regex_cache;
-
 static regex::ECMAScriptRegex const* get_or_compile_regex(RegExpObject& regexp_object)
 {
     // Fast path: check the inline cache on the RegExpObject.
     if (auto* cached = regexp_object.cached_regex())
         return cached;
 
-    auto const& pattern = regexp_object.pattern();
-    auto flag_bits = regexp_object.flag_bits();
-
-    // Build a cache key from pattern + flag bits.
-    StringBuilder key_builder;
-    key_builder.append('/');
-    key_builder.append(pattern.utf16_view());
-    key_builder.append('/');
-    key_builder.append_code_point(static_cast<u8>(flag_bits));
-    auto cache_key = key_builder.to_string_without_validation();
-
-    if (auto it = s_regex_cache.find(cache_key); it != s_regex_cache.end()) {
-        auto* ptr = it->value.ptr();
-        regexp_object.set_cached_regex(ptr);
-        return ptr;
-    }
-
-    bool unicode = has_flag(flag_bits, RegExpObject::Flags::Unicode);
-    bool unicode_sets = has_flag(flag_bits, RegExpObject::Flags::UnicodeSets);
-
-    // Parse the pattern from UTF-16 source to UTF-8 with escape normalization.
-    auto parsed_pattern = parse_regex_pattern(pattern.utf16_view(), unicode, unicode_sets);
-    if (parsed_pattern.is_error())
-        return nullptr;
-
-    regex::ECMAScriptCompileFlags flags {};
-    flags.global = has_flag(flag_bits, RegExpObject::Flags::Global);
-    flags.ignore_case = has_flag(flag_bits, RegExpObject::Flags::IgnoreCase);
-    flags.multiline = has_flag(flag_bits, RegExpObject::Flags::Multiline);
-    flags.dot_all = has_flag(flag_bits, RegExpObject::Flags::DotAll);
-    flags.unicode = unicode;
-    flags.unicode_sets = unicode_sets;
-    flags.sticky = has_flag(flag_bits, RegExpObject::Flags::Sticky);
-    flags.has_indices = has_flag(flag_bits, RegExpObject::Flags::HasIndices);
-
-    auto compiled = regex::ECMAScriptRegex::compile(parsed_pattern.release_value(), flags);
+    auto compiled = CompiledRegExpCache::the().get_or_compile(regexp_object.pattern().utf16_view(), static_cast<u8>(regexp_object.flag_bits()));
     if (compiled.is_error())
         return nullptr;
 
-    auto owned = make<regex::ECMAScriptRegex>(compiled.release_value());
-    auto* ptr = owned.ptr();
-    s_regex_cache.set(cache_key, move(owned));
-    regexp_object.set_cached_regex(ptr);
+    auto* ptr = &compiled.value()->regex();
+    regexp_object.set_cached_regex(compiled.release_value());
     return ptr;
 }
 
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <LibCore/System.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/SourceRange.h>
+#include <LibThreading/Thread.h>
+
+namespace JS {
+
+SamplingProfiler::SamplingProfiler(VM& vm)
+    : m_vm(vm)
+{
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+void SamplingProfiler::start(u32 sampling_interval_in_milliseconds)
+{
+    if (is_running())
+        return;
+
+    m_call_frames.clear();
+    m_call_frame_index_for_cell.clear();
+    m_nodes.clear();
+    m_child_node_ids.clear();
+    m_samples.clear();
+    m_time_deltas_in_microseconds.clear();
+
+    // Node 1 is the root of the call tree, as in profiles recorded by V8.
+    m_call_frames.append({ .function_name = "(root)"_string, .url = {}, .line_number = -1, .column_number = -1 });
+    m_nodes.append({ .call_frame_index = 0, .parent_id = 0, .hit_count = 0, .children = {}, .line_ticks = {} });
+
+    m_start_time = MonotonicTime::now();
+    m_last_sample_time = m_start_time;
+    m_end_time = m_start_time;
+
+    m_should_stop.store(false);
+    m_thread = Threading::Thread::construct("JS Sampler"sv, [this, sampling_interval_in_milliseconds]() -> intptr_t {
+        while (!m_should_stop.load()) {
+            (void)Core::System::sleep_ms(sampling_interval_in_milliseconds);
+            m_vm.request_profiler_sample();
+        }
+        return 0;
+    });
+    m_thread->start();
+}
+
+void SamplingProfiler::stop()
+{
+    if (!is_running())
+        return;
+
+    m_should_stop.store(true);
+    (void)m_thread->join();
+    m_thread = nullptr;
+    m_end_time = MonotonicTime::now();
+
+    // The call frames keep their own copy of everything we export, so there is no need to keep the cells alive.
+    m_call_frame_index_for_cell.clear();
+}
+
+void SamplingProfiler::take_sample()
+{
+    if (!is_running())
+        return;
+
+    auto now = MonotonicTime::now();
+
+    Vector<ExecutionContext const*, 32> stack;
+    m_vm.for_each_execution_context_top_to_bottom([&](ExecutionContext const& execution_context) {
+        stack.append(&execution_context);
+        return true;
+    });
+
+    u32 node_id = 1;
+    for (size_t i = stack.size(); i > 0; --i)
+        node_id = child_node_id(node_id, call_frame_index_for(*stack[i - 1]));
+
+    auto& node = m_nodes[node_id - 1];
+    ++node.hit_count;
+    if (!stack.is_empty() && stack.first()->executable) {
+        auto const& top = *stack.first();
+        auto const& source_range = top.executable->get_source_range(top.program_counter);
+        ++node.line_ticks.ensure(source_range.start.line, [] { return 0u; });
+    }
+
+    m_samples.append(node_id);
+    m_time_deltas_in_microseconds.append((now - m_last_sample_time).to_microseconds());
+    m_last_sample_time = now;
+}
+
+u32 SamplingProfiler::call_frame_index_for(ExecutionContext const& execution_context)
+{
+    GC::Ptr<GC::Cell> key;
+    if (execution_context.executable)
+        key = execution_context.executable.ptr();
+    else
+        key = execution_context.function.ptr();
+
+    if (auto it = m_call_frame_index_for_cell.find(key); it != m_call_frame_index_for_cell.end())
+        return it->value;
+
+    CallFrame call_frame;
+    if (execution_context.function)
+        call_frame.function_name = execution_context.function->name_for_call_stack().to_utf8();
+    else if (execution_context.executable)
+        call_frame.function_name = execution_context.executable->name.view().to_utf8_but_should_be_ported_to_utf16();
+
+    if (execution_context.executable) {
+        // NB: The first instruction is the closest thing to the function's own position that the source map has.
+        auto const& source_range = execution_context.executable->get_source_range(0);
+        call_frame.url = source_range.code->filename();
+        call_frame.line_number = static_cast<i32>(source_range.start.line) - 1;
+        call_frame.column_number = static_cast<i32>(source_range.start.column) - 1;
+    }
+
+    auto index = static_cast<u32>(m_call_frames.size());
+    m_call_frames.append(move(call_frame));
+    if (key)
+        m_call_frame_index_for_cell.set(key, index);
+    return index;
+}
+
+u32 SamplingProfiler::child_node_id(u32 parent_id, u32 call_frame_index)
+{
+    auto key = (static_cast<u64>(parent_id) << 32) | call_frame_index;
+    return m_child_node_ids.ensure(key, [&] {
+        m_nodes.append({ .call_frame_index = call_frame_index, .parent_id = parent_id, .hit_count = 0, .children = {}, .line_ticks = {} });
+        auto node_id = static_cast<u32>(m_nodes.size());
+        m_nodes[parent_id - 1].children.append(node_id);
+        return node_id;
+    });
+}
+
+void SamplingProfiler::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots) const
+{
+    for (auto const& it : m_call_frame_index_for_cell)
+        roots.set(it.key.ptr(), GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+}
+
+// https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-Profile
+JsonObject SamplingProfiler::to_cpuprofile() const
+{
+    HashMap<String, u32> script_ids;
+    auto script_id_for = [&](String const& url) {
+        if (url.is_empty())
+            return 0u;
+        return script_ids.ensure(url, [&] { return static_cast<u32>(script_ids.size() + 1); });
+    };
+
+    JsonArray nodes;
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        auto const& node = m_nodes[i];
+        auto const& call_frame = m_call_frames[node.call_frame_index];
+
+        JsonObject call_frame_object;
+        call_frame_object.set("functionName"sv, call_frame.function_name);
+        call_frame_object.set("scriptId"sv, String::number(script_id_for(call_frame.url)));
+        call_frame_object.set("url"sv, call_frame.url);
+        call_frame_object.set("lineNumber"sv, call_frame.line_number);
+        call_frame_object.set("columnNumber"sv, call_frame.column_number);
+
+        JsonObject node_object;
+        node_object.set("id"sv, static_cast<u32>(i + 1));
+        node_object.set("callFrame"sv, move(call_frame_object));
+        node_object.set("hitCount"sv, node.hit_count);
+
+        if (!node.children.is_empty()) {
+            JsonArray children;
+            for (auto child : node.children)
+                children.must_append(child);
+            node_object.set("children"sv, move(children));
+        }
+
+        if (!node.line_ticks.is_empty()) {
+            JsonArray position_ticks;
+            for (auto const& it : node.line_ticks) {
+                JsonObject position_tick;
+                position_tick.set("line"sv, it.key);
+                position_tick.set("ticks"sv, it.value);
+                position_ticks.must_append(move(position_tick));
+            }
+            node_object.set("positionTicks"sv, move(position_ticks));
+        }
+
+        nodes.must_append(move(node_object));
+    }
+
+    JsonArray samples;
+    for (auto sample : m_samples)
+        samples.must_append(sample);
+
+    JsonArray time_deltas;
+    for (auto time_delta : m_time_deltas_in_microseconds)
+        time_deltas.must_append(time_delta);
+
+    auto end_time = is_running() ? MonotonicTime::now() : m_end_time;
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, m_start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, end_time.nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile;
+}
+
+}
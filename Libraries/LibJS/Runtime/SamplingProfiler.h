@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/Noncopyable.h>
+#include <AK/RefPtr.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibGC/HeapRoot.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibThreading/Forward.h>
+
+namespace JS {
+
+// A low-overhead sampling CPU profiler. A timer thread periodically asks the VM for a sample; the interpreters poll
+// for that request at calls and loop back-edges and then record the execution context stack. Samples are aggregated
+// into a call tree that can be exported in the .cpuprofile format understood by Chrome DevTools and most profile
+// viewers.
+class JS_API SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static constexpr u32 default_sampling_interval_in_milliseconds = 1;
+
+    explicit SamplingProfiler(VM&);
+    ~SamplingProfiler();
+
+    void start(u32 sampling_interval_in_milliseconds = default_sampling_interval_in_milliseconds);
+    void stop();
+    [[nodiscard]] bool is_running() const { return !m_thread.is_null(); }
+
+    // Called by the VM on its own thread at a safe point.
+    void take_sample();
+
+    void gather_roots(HashMap<GC::Cell*, GC::HeapRoot>&) const;
+
+    [[nodiscard]] size_t sample_count() const { return m_samples.size(); }
+    [[nodiscard]] JsonObject to_cpuprofile() const;
+
+private:
+    struct CallFrame {
+        String function_name;
+        String url;
+        i32 line_number { -1 };
+        i32 column_number { -1 };
+    };
+
+    struct Node {
+        u32 call_frame_index { 0 };
+        u32 parent_id { 0 };
+        u32 hit_count { 0 };
+        Vector<u32> children;
+        HashMap<u32, u32> line_ticks;
+    };
+
+    u32 call_frame_index_for(ExecutionContext const&);
+    u32 child_node_id(u32 parent_id, u32 call_frame_index);
+
+    VM& m_vm;
+    RefPtr<Threading::Thread> m_thread;
+    Atomic<bool> m_should_stop { false };
+
+    Vector<CallFrame> m_call_frames;
+    // NB: Keyed by the frame's executable, or by its function for native frames. The keys are kept alive while
+    //     profiling so that a recycled cell can never be attributed to the wrong call frame.
+    HashMap<GC::Ptr<GC::Cell>, u32> m_call_frame_index_for_cell;
+
+    // Node ids are 1-based indices into m_nodes; node 1 is the root.
+    Vector<Node> m_nodes;
+    HashMap<u64, u32> m_child_node_ids;
+
+    Vector<u32> m_samples;
+    Vector<i64> m_time_deltas_in_microseconds;
+    MonotonicTime m_start_time { MonotonicTime::now() };
+    MonotonicTime m_last_sample_time { MonotonicTime::now() };
+    MonotonicTime m_end_time { MonotonicTime::now() };
+};
+
+}
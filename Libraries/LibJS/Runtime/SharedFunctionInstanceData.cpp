@@ -4,8 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashTable.h>
+#include <AK/QuickSort.h>
+#include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Runtime/ExternalMemory.h>
 #include <LibJS/Runtime/SharedFunctionInstanceData.h>
+#include <LibJS/Runtime/VM.h>
 #include <LibJS/RustIntegration.h>
 #include <LibJS/SourceCode.h>
 
@@ -173,6 +177,10 @@ void SharedFunctionInstanceData::finalize()
     m_cached_bytecode_executable = nullptr;
     RustIntegration::free_precompiled_bytecode_executable(m_precompiled_bytecode_executable);
     m_precompiled_bytecode_executable = nullptr;
+    RustIntegration::free_cached_bytecode_executable(m_retained_cached_bytecode_executable);
+    m_retained_cached_bytecode_executable = nullptr;
+    if (m_bytecode_flush_candidate_list_node.is_in_list())
+        m_bytecode_flush_candidate_list_node.remove();
 }
 
 void SharedFunctionInstanceData::clear_compile_inputs()
@@ -193,6 +201,42 @@ void SharedFunctionInstanceData::clear_non_bytecode_cache_compile_inputs()
     m_precompiled_bytecode_executable = nullptr;
 }
 
+void SharedFunctionInstanceData::retain_cached_bytecode_executable_for_flushing(VM& vm)
+{
+    VERIFY(m_cached_bytecode_executable);
+    if (m_retained_cached_bytecode_executable)
+        return;
+    m_retained_cached_bytecode_executable = RustIntegration::clone_cached_bytecode_executable(m_cached_bytecode_executable);
+    if (!m_bytecode_flush_candidate_list_node.is_in_list())
+        vm.bytecode_flush_candidates().append(*this);
+}
+
+void SharedFunctionInstanceData::age_bytecode_and_flush_if_cold(HashTable<Bytecode::Executable const*> const& active_executables)
+{
+    auto executable = m_executable;
+    if (!executable || !m_retained_cached_bytecode_executable)
+        return;
+
+    // NB: Executables only ever count up, so any change since the last check means we were called.
+    if (executable->call_count != m_call_count_at_last_bytecode_age_check
+        || active_executables.contains(executable.ptr())) {
+        m_call_count_at_last_bytecode_age_check = executable->call_count;
+        m_bytecode_age = 0;
+        return;
+    }
+
+    if (++m_bytecode_age < bytecode_flush_age_threshold)
+        return;
+
+    // Hand the retained record back as a lazy compile input. The executable itself is collected once nothing
+    // else (e.g. a suspended generator) references it.
+    VERIFY(!m_cached_bytecode_executable);
+    m_cached_bytecode_executable = exchange(m_retained_cached_bytecode_executable, nullptr);
+    m_bytecode_age = 0;
+    m_call_count_at_last_bytecode_age_check = 0;
+    set_executable(nullptr);
+}
+
 void SharedFunctionInstanceData::update_can_inline_call()
 {
     m_can_inline_call = m_executable && m_kind == FunctionKind::Normal && !m_is_class_constructor;
@@ -246,6 +290,18 @@ bool SharedFunctionInstanceDataList::contains_precompiled_bytecode() const
     return false;
 }
 
+Vector<u32> SharedFunctionInstanceDataList::bytecode_cache_offsets_of_called_functions() const
+{
+    // NB: Functions are compiled or materialized on their first call, so having an executable means we were called.
+    Vector<u32> offsets;
+    for (auto const& shared_data : m_list) {
+        if (shared_data.m_executable)
+            offsets.append(static_cast<u32>(shared_data.bytecode_cache_source_text_offset()));
+    }
+    quick_sort(offsets);
+    return offsets;
+}
+
 void SharedFunctionInstanceDataList::clear()
 {
     while (!m_list.is_empty()) {
@@ -58,6 +58,7 @@ class JS_API SharedFunctionInstanceData final : public GC::Cell {
 public:
     IntrusiveListNode<SharedFunctionInstanceData> m_script_or_module_list_node;
     SharedFunctionInstanceDataList* m_owner_shared_function_data_list { nullptr };
+    IntrusiveListNode<SharedFunctionInstanceData> m_bytecode_flush_candidate_list_node;
 
     static constexpr u64 asm_call_metadata_can_inline_call = 1ull << 32;
     static constexpr u64 asm_call_metadata_needs_environment_or_this_value_resolution = 1ull << 33;
@@ -104,6 +105,8 @@ public:
     Utf16FlyString m_name;
 
     Utf16String source_text() const;
+    [[nodiscard]] size_t bytecode_cache_source_text_offset() const { return m_has_bytecode_cache_source_text_range ? m_bytecode_cache_source_text_offset : m_source_text_offset; }
+    [[nodiscard]] size_t bytecode_cache_source_text_length() const { return m_has_bytecode_cache_source_text_range ? m_bytecode_cache_source_text_length : m_source_text_length; }
     void set_source_text(Utf16View);
     void set_source_text_range(SourceCode const&, size_t source_text_offset, size_t source_text_length);
 
@@ -194,11 +197,23 @@ public:
     // NB: When non-null, points to a Rust Box<PrecompiledFunction> used for
     //     lazy materialization from freshly compiled bytecode.
     void* m_precompiled_bytecode_executable { nullptr };
+    // NB: When non-null, points to a copy of the Rust Box<DecodedExecutableRecord>
+    //     that m_executable was materialized from. It outlives the executable so
+    //     that cold bytecode can be flushed and re-materialized on the next call.
+    void* m_retained_cached_bytecode_executable { nullptr };
     bool m_use_rust_compilation { false };
 
     void clear_compile_inputs();
     void clear_non_bytecode_cache_compile_inputs();
 
+    // Bytecode flushing: functions whose executable can be re-materialized from
+    // the bytecode cache drop it after going bytecode_flush_age_threshold garbage
+    // collections without a call. Candidates are tracked per VM, which ages them
+    // after each collection of its heap.
+    static constexpr u8 bytecode_flush_age_threshold = 8;
+    void retain_cached_bytecode_executable_for_flushing(VM&);
+    void age_bytecode_and_flush_if_cold(HashTable<Bytecode::Executable const*> const& active_executables);
+
 private:
     void initialize_after_construction();
 
@@ -207,6 +222,8 @@ private:
     void update_can_inline_call();
 
     bool m_can_inline_call { false };
+    u8 m_bytecode_age { 0 };
+    u32 m_call_count_at_last_bytecode_age_check { 0 };
 };
 
 class JS_API SharedFunctionInstanceDataList {
@@ -221,6 +238,8 @@ public:
     [[nodiscard]] size_t size_slow() const { return m_list.size_slow(); }
     [[nodiscard]] bool contains_rust_function_ast() const;
     [[nodiscard]] bool contains_precompiled_bytecode() const;
+    // Bytecode cache identities of the functions that have been called, for the blob's hot function profile.
+    [[nodiscard]] Vector<u32> bytecode_cache_offsets_of_called_functions() const;
 
     template<typename Callback>
     void for_each(Callback callback)
@@ -238,4 +257,6 @@ private:
     List m_list;
 };
 
+using BytecodeFlushCandidateList = IntrusiveList<&SharedFunctionInstanceData::m_bytecode_flush_candidate_list_node>;
+
 }
@@ -6,6 +6,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/BitCast.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -1845,6 +1847,87 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::some)
     return false;
 }
 
+// Sorts elements in the numeric order of CompareTypedArrayElements with an undefined comparefn (-0 before +0, NaN
+// last) using an LSD radix sort over order-preserving unsigned keys. Destination may alias source.
+template<typename T>
+static void radix_sort_typed_array_elements(ReadonlySpan<T> source, Span<T> destination)
+{
+    using Key = Conditional<sizeof(T) == 1, u8, Conditional<sizeof(T) == 2, u16, Conditional<sizeof(T) == 4, u32, u64>>>;
+    constexpr Key sign_bit = static_cast<Key>(1) << (sizeof(Key) * 8 - 1);
+
+    auto to_key = [](T value) -> Key {
+        if constexpr (IsFloatingPoint<T>) {
+            // NOTE: All NaNs sort last; they are written back as a single canonical NaN.
+            if (value != value)
+                return NumericLimits<Key>::max();
+            auto bits = bit_cast<Key>(value);
+            return (bits & sign_bit) ? static_cast<Key>(~bits) : static_cast<Key>(bits | sign_bit);
+        } else if constexpr (IsSigned<T>) {
+            return static_cast<Key>(bit_cast<Key>(value) ^ sign_bit);
+        } else {
+            return value;
+        }
+    };
+
+    auto from_key = [](Key key) -> T {
+        if constexpr (IsFloatingPoint<T>)
+            return bit_cast<T>((key & sign_bit) ? static_cast<Key>(key ^ sign_bit) : static_cast<Key>(~key));
+        else if constexpr (IsSigned<T>)
+            return bit_cast<T>(static_cast<Key>(key ^ sign_bit));
+        else
+            return key;
+    };
+
+    auto count = min(source.size(), destination.size());
+    if (count == 0)
+        return;
+
+    Vector<Key> keys;
+    keys.ensure_capacity(count);
+    for (size_t i = 0; i < count; ++i)
+        keys.unchecked_append(to_key(source[i]));
+
+    Vector<Key> scratch;
+    scratch.resize(count);
+    for (size_t shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+        AK::Array<size_t, 256> offsets {};
+        for (auto key : keys)
+            ++offsets[(key >> shift) & 0xff];
+
+        // Skip passes where every key has the same byte.
+        if (offsets[(keys[0] >> shift) & 0xff] == count)
+            continue;
+
+        size_t offset = 0;
+        for (auto& bucket_offset : offsets) {
+            auto bucket_size = bucket_offset;
+            bucket_offset = offset;
+            offset += bucket_size;
+        }
+        for (auto key : keys)
+            scratch[offsets[(key >> shift) & 0xff]++] = key;
+        swap(keys, scratch);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+        destination[i] = from_key(keys[i]);
+}
+
+// Writes source's elements into destination, a TypedArray of the same type and length, in the order that
+// SortIndexedProperties with the default CompareTypedArrayElements would produce.
+static void sort_typed_array_with_default_compare(TypedArrayBase const& source, TypedArrayBase& destination)
+{
+    VERIFY(source.kind() == destination.kind());
+    switch (source.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type)                                                 \
+    case TypedArrayBase::Kind::ClassName:                                                                                           \
+        radix_sort_typed_array_elements(static_cast<ClassName const&>(source).data(), static_cast<ClassName&>(destination).data()); \
+        break;
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+}
+
 // 23.2.3.29 %TypedArray%.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.sort
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
 {
@@ -1863,6 +1946,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Without a comparefn no user code can run while sorting, so we can sort the underlying buffer
+    //               directly instead of going through a list of Values.
+    if (compare_function.is_undefined()) {
+        sort_typed_array_with_default_compare(*typed_array, *typed_array);
+        return typed_array;
+    }
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -2107,6 +2197,12 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    // OPTIMIZATION: Without a comparefn no user code can run while sorting, so we can sort straight into A's buffer.
+    if (compare_function.is_undefined()) {
+        sort_typed_array_with_default_compare(*typed_array, *array);
+        return array;
+    }
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.34.
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
@@ -8,6 +8,7 @@
 
 #include <AK/Array.h>
 #include <AK/Debug.h>
+#include <AK/HashTable.h>
 #include <AK/LexicalPath.h>
 #include <AK/ScopeGuard.h>
 #include <AK/String.h>
@@ -30,6 +31,8 @@
 #include <LibJS/Runtime/NativeJavaScriptBackedFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/SharedFunctionInstanceData.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
 #include <LibJS/Runtime/VM.h>
@@ -84,6 +87,10 @@ VM::VM(ErrorMessages error_messages)
         Bytecode::StaticPropertyLookupCache::sweep_all();
     });
 
+    m_heap.register_sweep_callback([this] {
+        flush_cold_bytecode();
+    });
+
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
 
     cached_strings = {
@@ -335,6 +342,29 @@ void VM::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots)
 
     for (auto& job : m_promise_jobs)
         roots.set(job, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+
+    if (m_sampling_profiler)
+        m_sampling_profiler->gather_roots(roots);
+}
+
+void VM::flush_cold_bytecode()
+{
+    // NB: Executables of frames that are currently on a stack must stay attached to their function,
+    //     since e.g. generator creation looks them up through the function.
+    HashTable<Bytecode::Executable const*> active_executables;
+    auto gather_active_executables = [&active_executables](Vector<ExecutionContext*> const& stack, Vector<ExecutionContext*> const& previous_running_contexts, ExecutionContext* running_execution_context) {
+        for_each_execution_context_top_to_bottom(stack, previous_running_contexts, running_execution_context, [&](ExecutionContext& execution_context) {
+            if (execution_context.executable)
+                active_executables.set(execution_context.executable.ptr());
+            return true;
+        });
+    };
+    gather_active_executables(m_execution_context_stack, m_execution_context_stack_previous_running_contexts, m_running_execution_context);
+    for (auto const& saved_stack : m_saved_execution_context_stacks)
+        gather_active_executables(saved_stack.stack, saved_stack.previous_running_contexts, saved_stack.running_execution_context);
+
+    for (auto& shared_data : m_bytecode_flush_candidates)
+        shared_data.age_bytecode_and_flush_if_cold(active_executables);
 }
 
 // 9.1.2.1 GetIdentifierReference ( env, name, strict ), https://tc39.es/ecma262/#sec-getidentifierreference
@@ -848,6 +878,20 @@ void VM::load_imported_module(ImportedModuleReferrer referrer, ModuleRequest con
     finish_loading_imported_module(referrer, module_request, payload, module);
 }
 
+SamplingProfiler& VM::ensure_sampling_profiler()
+{
+    if (!m_sampling_profiler)
+        m_sampling_profiler = make<SamplingProfiler>(*this);
+    return *m_sampling_profiler;
+}
+
+void VM::take_profiler_sample()
+{
+    m_profiler_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+    if (m_sampling_profiler)
+        m_sampling_profiler->take_sample();
+}
+
 Vector<StackTraceElement> VM::stack_trace() const
 {
     Vector<StackTraceElement> stack_trace;
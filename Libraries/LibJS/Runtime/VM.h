@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/FlyString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
@@ -34,6 +35,7 @@
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/InterpreterStack.h>
 #include <LibJS/Runtime/Promise.h>
+#include <LibJS/Runtime/SharedFunctionInstanceData.h>
 #include <LibJS/Runtime/Value.h>
 
 namespace JS {
@@ -80,7 +82,7 @@ public:
     ThrowCompletionOr<Value> run_executable(ExecutionContext&, Bytecode::Executable&, u32 entry_point = 0);
     ThrowCompletionOr<Value> run_executable(ExecutionContext& context, Bytecode::Executable& executable, u32 entry_point, Value initial_accumulator_value)
     {
-        context.registers_and_constants_and_locals_and_arguments_span()[0] = initial_accumulator_value;
+        context.registers_and_locals_and_arguments_span()[0] = initial_accumulator_value;
         return run_executable(context, executable, entry_point);
     }
 
@@ -96,20 +98,22 @@ public:
     ALWAYS_INLINE Value& accumulator() { return reg(Bytecode::Register::accumulator()); }
     Value& reg(Bytecode::Register const& r)
     {
-        return m_running_execution_context->registers_and_constants_and_locals_and_arguments()[r.index()];
+        return m_running_execution_context->registers_and_locals_and_arguments()[r.index()];
     }
     Value reg(Bytecode::Register const& r) const
     {
-        return m_running_execution_context->registers_and_constants_and_locals_and_arguments()[r.index()];
+        return m_running_execution_context->registers_and_locals_and_arguments()[r.index()];
     }
 
     ALWAYS_INLINE Value get(Bytecode::Operand op) const
     {
-        return m_running_execution_context->registers_and_constants_and_locals_and_arguments()[op.raw()];
+        if (op.refers_to_constant_pool())
+            return m_running_execution_context->executable->constants_data[op.constant_pool_index()];
+        return m_running_execution_context->registers_and_locals_and_arguments()[op.raw()];
     }
     ALWAYS_INLINE void set(Bytecode::Operand op, Value value)
     {
-        m_running_execution_context->registers_and_constants_and_locals_and_arguments_span().data()[op.raw()] = value;
+        m_running_execution_context->registers_and_locals_and_arguments_span().data()[op.raw()] = value;
     }
 
     Value do_yield(Value value, Optional<Bytecode::Label> continuation, bool value_is_iterator_result = false);
@@ -158,6 +162,8 @@ public:
     void dump_backtrace() const;
 
     void gather_roots(HashMap<GC::Cell*, GC::HeapRoot>&);
+    void flush_cold_bytecode();
+    BytecodeFlushCandidateList& bytecode_flush_candidates() { return m_bytecode_flush_candidates; }
 
 #define __JS_ENUMERATE(SymbolName, snake_name)             \
     GC::Ref<Symbol> well_known_symbol_##snake_name() const \
@@ -454,6 +460,14 @@ public:
 
     [[nodiscard]] Vector<StackTraceElement> stack_trace() const;
 
+    [[nodiscard]] SamplingProfiler* sampling_profiler() { return m_sampling_profiler.ptr(); }
+    SamplingProfiler& ensure_sampling_profiler();
+
+    // Called from the profiler's timer thread. The interpreters poll for the request at calls and loop back-edges.
+    void request_profiler_sample() { m_profiler_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed); }
+    [[nodiscard]] ALWAYS_INLINE bool profiler_sample_requested() const { return m_profiler_sample_requested.load(AK::MemoryOrder::memory_order_relaxed); }
+    NEVER_INLINE void take_profiler_sample();
+
 private:
     using ErrorMessages = AK::Array<Utf16String, to_underlying(ErrorMessage::__Count)>;
 
@@ -542,6 +556,9 @@ private:
 
     Vector<SavedExecutionContextStack> m_saved_execution_context_stacks;
 
+    // Functions materialized from the bytecode cache whose executable may be flushed once it goes cold.
+    BytecodeFlushCandidateList m_bytecode_flush_candidates;
+
     StackInfo m_stack_info;
 
     InterpreterStack m_interpreter_stack;
@@ -578,6 +595,9 @@ private:
 
     OwnPtr<Agent> m_agent;
 
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+    Atomic<bool> m_profiler_sample_requested { false };
+
     bool m_dynamic_imports_allowed { false };
 };
 
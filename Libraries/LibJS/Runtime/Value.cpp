@@ -10,6 +10,7 @@
 #include <AK/Assertions.h>
 #include <AK/ByteString.h>
 #include <AK/CharacterTypes.h>
+#include <AK/Checked.h>
 #include <AK/StringBuilder.h>
 #include <AK/StringConversions.h>
 #include <AK/Utf16String.h>
@@ -554,6 +555,8 @@ bool Value::to_boolean_slow_case() const
     case STRING_TAG:
         return !as_string().is_empty();
     case BIGINT_TAG:
+        if (auto value = as_bigint().small_value(); value.has_value())
+            return *value != 0;
         return as_bigint().big_integer() != BIGINT_ZERO;
     case OBJECT_TAG:
         // B.3.6.1 Changes to ToBoolean, https://tc39.es/ecma262/#sec-IsHTMLDDA-internal-slot-to-boolean
@@ -949,6 +952,8 @@ ThrowCompletionOr<i64> Value::to_bigint_int64(VM& vm) const
 
     // 2. Let int64bit be ℝ(n) modulo 2^64.
     // 3. If int64bit ≥ 2^63, return ℤ(int64bit - 2^64); otherwise return ℤ(int64bit).
+    if (auto value = bigint->small_value(); value.has_value())
+        return *value;
     return static_cast<i64>(bigint->big_integer().to_u64());
 }
 
@@ -960,6 +965,8 @@ ThrowCompletionOr<u64> Value::to_bigint_uint64(VM& vm) const
 
     // 2. Let int64bit be ℝ(n) modulo 2^64.
     // 3. Return ℤ(int64bit).
+    if (auto value = bigint->small_value(); value.has_value())
+        return static_cast<u64>(*value);
     return bigint->big_integer().to_u64();
 }
 
@@ -1614,6 +1621,10 @@ ThrowCompletionOr<Value> unary_minus(VM& vm, Value lhs)
     // b. Return BigInt::unaryMinus(oldValue).
 
     // 6.1.6.2.1 BigInt::unaryMinus ( x ), https://tc39.es/ecma262/#sec-numeric-types-bigint-unaryMinus
+    // OPTIMIZATION: Inline 64-bit BigInts exclude i64's minimum, so negating them can't overflow.
+    if (auto value = old_value.as_bigint().small_value(); value.has_value())
+        return BigInt::create(vm, -*value);
+
     // 1. If x is 0ℤ, return 0ℤ.
     if (old_value.as_bigint().big_integer() == BIGINT_ZERO)
         return BigInt::create(vm, BIGINT_ZERO);
@@ -1624,6 +1635,25 @@ ThrowCompletionOr<Value> unary_minus(VM& vm, Value lhs)
     return BigInt::create(vm, big_integer_negated);
 }
 
+// BigInt::leftShift for inline 64-bit BigInts. Returns an empty Optional if the result doesn't fit in an i64.
+static Optional<i64> small_bigint_left_shift(i64 x, i64 y)
+{
+    if (y < 0) {
+        // An arithmetic right shift rounds towards negative infinity, as BigInt::leftShift requires.
+        if (y <= -64)
+            return x < 0 ? -1 : 0;
+        return x >> -y;
+    }
+    if (x == 0)
+        return 0;
+    if (y >= 63)
+        return {};
+    auto multiplier = static_cast<i64>(1) << y;
+    if (Checked<i64>::multiplication_would_overflow(x, multiplier))
+        return {};
+    return x * multiplier;
+}
+
 // 13.9.1 The Left Shift Operator ( << ), https://tc39.es/ecma262/#sec-left-shift-operator
 // ShiftExpression : ShiftExpression << AdditiveExpression
 ThrowCompletionOr<Value> left_shift(VM& vm, Value lhs, Value rhs)
@@ -1663,6 +1693,12 @@ ThrowCompletionOr<Value> left_shift(VM& vm, Value lhs, Value rhs)
         return Value(lhs_i32 << shift_count);
     }
     if (both_bigint(lhs_numeric, rhs_numeric)) {
+        // OPTIMIZATION: Shift inline 64-bit BigInts directly, unless the result overflows.
+        if (auto x = lhs_numeric.as_bigint().small_value(), y = rhs_numeric.as_bigint().small_value(); x.has_value() && y.has_value()) {
+            if (auto result = small_bigint_left_shift(*x, *y); result.has_value())
+                return BigInt::create(vm, *result);
+        }
+
         // AD-HOC: Prevent allocating huge amounts of memory.
         auto rhs_bigint = rhs_numeric.as_bigint().big_integer().unsigned_value();
         if (rhs_bigint.byte_length() > sizeof(u32))
@@ -1734,6 +1770,8 @@ ThrowCompletionOr<Value> right_shift(VM& vm, Value lhs, Value rhs)
     if (both_bigint(lhs_numeric, rhs_numeric)) {
         // 6.1.6.2.10 BigInt::signedRightShift ( x, y ), https://tc39.es/ecma262/#sec-numeric-types-bigint-signedRightShift
         // 1. Return BigInt::leftShift(x, -y).
+        if (auto y = rhs_numeric.as_bigint().small_value(); y.has_value())
+            return left_shift(vm, lhs_numeric, BigInt::create(vm, -*y));
         auto rhs_negated = rhs_numeric.as_bigint().big_integer();
         rhs_negated.negate();
         return left_shift(vm, lhs, BigInt::create(vm, rhs_negated));
@@ -1841,6 +1879,11 @@ ThrowCompletionOr<Value> add(VM& vm, Value lhs, Value rhs)
     }
     if (both_bigint(lhs_numeric, rhs_numeric)) {
         // 6.1.6.2.7 BigInt::add ( x, y ), https://tc39.es/ecma262/#sec-numeric-types-bigint-add
+        // OPTIMIZATION: Add inline 64-bit BigInts directly, unless the result overflows.
+        if (auto x = lhs_numeric.as_bigint().small_value(), y = rhs_numeric.as_bigint().small_value(); x.has_value() && y.has_value()) {
+            if (!Checked<i64>::addition_would_overflow(*x, *y))
+                return BigInt::create(vm, *x + *y);
+        }
         auto x = lhs_numeric.as_bigint().big_integer();
         auto y = rhs_numeric.as_bigint().big_integer();
         return BigInt::create(vm, x.plus(y));
@@ -1875,6 +1918,11 @@ ThrowCompletionOr<Value> sub(VM& vm, Value lhs, Value rhs)
     }
     if (both_bigint(lhs_numeric, rhs_numeric)) {
         // 6.1.6.2.8 BigInt::subtract ( x, y ), https://tc39.es/ecma262/#sec-numeric-types-bigint-subtract
+        // OPTIMIZATION: Subtract inline 64-bit BigInts directly, unless the result overflows.
+        if (auto x = lhs_numeric.as_bigint().small_value(), y = rhs_numeric.as_bigint().small_value(); x.has_value() && y.has_value()) {
+            if (!Checked<i64>::subtraction_would_overflow(*x, *y))
+                return BigInt::create(vm, *x - *y);
+        }
         auto x = lhs_numeric.as_bigint().big_integer();
         auto y = rhs_numeric.as_bigint().big_integer();
         // 1. Return the BigInt value that represents the difference x minus y.
@@ -1909,6 +1957,11 @@ ThrowCompletionOr<Value> mul(VM& vm, Value lhs, Value rhs)
     }
     if (both_bigint(lhs_numeric, rhs_numeric)) {
         // 6.1.6.2.4 BigInt::multiply ( x, y ), https://tc39.es/ecma262/#sec-numeric-types-bigint-multiply
+        // OPTIMIZATION: Multiply inline 64-bit BigInts directly, unless the result overflows.
+        if (auto x = lhs_numeric.as_bigint().small_value(), y = rhs_numeric.as_bigint().small_value(); x.has_value() && y.has_value()) {
+            if (!Checked<i64>::multiplication_would_overflow(*x, *y))
+                return BigInt::create(vm, *x * *y);
+        }
         auto x = lhs_numeric.as_bigint().big_integer();
         auto y = rhs_numeric.as_bigint().big_integer();
         // 1. Return the BigInt value that represents the product of x and y.
@@ -2283,6 +2336,10 @@ bool same_value_non_number(Value lhs, Value rhs)
 
         // 6.1.6.2.13 BigInt::equal ( x, y ), https://tc39.es/ecma262/#sec-numeric-types-bigint-equal
         // 1. If ℝ(x) = ℝ(y), return true; otherwise return false.
+        auto x = lhs.as_bigint().small_value();
+        auto y = rhs.as_bigint().small_value();
+        if (x.has_value() || y.has_value())
+            return x == y;
         return lhs.as_bigint().big_integer() == rhs.as_bigint().big_integer();
     }
 
@@ -2540,6 +2597,8 @@ ThrowCompletionOr<TriState> is_less_than(VM& vm, Value lhs, Value rhs, bool left
     if (x_numeric.is_bigint() && y_numeric.is_bigint()) {
         // 1. Assert: nx is a BigInt.
         // 2. Return BigInt::lessThan(nx, ny).
+        if (auto x = x_numeric.as_bigint().small_value(), y = y_numeric.as_bigint().small_value(); x.has_value() && y.has_value())
+            return *x < *y ? TriState::True : TriState::False;
         if (x_numeric.as_bigint().big_integer() < y_numeric.as_bigint().big_integer())
             return TriState::True;
         else
@@ -21,8 +21,12 @@ struct ValueTraits : public Traits<Value> {
         if (value.is_string())
             return value.as_string().utf8_string().hash();
 
-        if (value.is_bigint())
+        if (value.is_bigint()) {
+            // NOTE: Equal BigInts are either both inline or both not, so the two hashes never need to agree.
+            if (auto small_value = value.as_bigint().small_value(); small_value.has_value())
+                return u64_hash(static_cast<u64>(*small_value));
             return value.as_bigint().big_integer().hash();
+        }
 
         // In the IEEE 754 standard a NaN value is encoded as any value from 0x7ff0000000000001 to 0x7fffffffffffffff,
         // with the least significant bits (referred to as the 'payload') carrying some kind of diagnostic information
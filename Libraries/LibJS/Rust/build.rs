@@ -217,6 +217,10 @@ fn emit_scalar_field_check(
             w,
             "            validate_object_property_iterator_cache_index(read_u32(bytes, at + {offset}), ctx)?;"
         )?,
+        "TypeFeedbackSlotIndex" => writeln!(
+            w,
+            "            validate_type_feedback_slot_index(read_u32(bytes, at + {offset}), ctx)?;"
+        )?,
         "u32" => {
             // The .def gives us no first-class types for SFD, class-blueprint,
             // or object-shape cache references stored as u32. Recognize the
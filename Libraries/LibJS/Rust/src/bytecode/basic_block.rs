@@ -8,7 +8,11 @@ use super::instruction::Instruction;
 use super::operand::Label;
 
 /// A source map entry mapping a bytecode offset to a source position.
+///
+/// Laid out like C++ `Bytecode::SourceMapEntry`, so source maps stored in a
+/// bytecode cache blob can be handed to the C++ executable in place.
 #[derive(Debug, Clone, Copy)]
+#[repr(C)]
 pub struct SourceMapEntry {
     pub bytecode_offset: u32,
     pub line: u32,
@@ -2003,11 +2003,15 @@ fn emit_binary_op(
     let lhs_op = lhs.operand();
     let rhs_op = rhs.operand();
     match op {
-        BinaryOp::Addition => generator.emit(Instruction::Add {
-            dst: dst_op,
-            lhs: lhs_op,
-            rhs: rhs_op,
-        }),
+        BinaryOp::Addition => {
+            let type_feedback = generator.next_type_feedback_slot();
+            generator.emit(Instruction::Add {
+                dst: dst_op,
+                lhs: lhs_op,
+                rhs: rhs_op,
+                type_feedback,
+            })
+        }
         BinaryOp::Subtraction => generator.emit(Instruction::Sub {
             dst: dst_op,
             lhs: lhs_op,
@@ -4238,11 +4242,13 @@ fn emit_get_by_value(
         }
         return;
     }
+    let type_feedback = generator.next_type_feedback_slot();
     generator.emit(Instruction::GetByValue {
         dst: dst.operand(),
         base: base.operand(),
         property: property.operand(),
         base_identifier,
+        type_feedback,
     });
 }
 
@@ -4852,11 +4858,15 @@ fn emit_compound_assignment(
     let lhs_op = lhs.operand();
     let rhs_op = rhs.operand();
     match op {
-        AssignmentOp::AdditionAssignment => generator.emit(Instruction::Add {
-            dst: dst_op,
-            lhs: lhs_op,
-            rhs: rhs_op,
-        }),
+        AssignmentOp::AdditionAssignment => {
+            let type_feedback = generator.next_type_feedback_slot();
+            generator.emit(Instruction::Add {
+                dst: dst_op,
+                lhs: lhs_op,
+                rhs: rhs_op,
+                type_feedback,
+            })
+        }
         AssignmentOp::SubtractionAssignment => generator.emit(Instruction::Sub {
             dst: dst_op,
             lhs: lhs_op,
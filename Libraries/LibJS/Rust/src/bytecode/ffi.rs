@@ -64,6 +64,11 @@ pub struct FFISourceMapEntry {
     pub source_start_column: u32,
 }
 
+const _: () = assert!(
+    size_of::<FFISourceMapEntry>() == size_of::<SourceMapEntry>()
+        && align_of::<FFISourceMapEntry>() == align_of::<SourceMapEntry>()
+);
+
 /// A borrowed UTF-16 string slice for passing across FFI.
 /// Points into Rust-owned memory; valid only for the duration of the FFI call.
 #[repr(C)]
@@ -219,6 +224,7 @@ pub struct FFIExecutableData {
     pub exception_handler_count: usize,
     pub source_map: *const FFISourceMapEntry,
     pub source_map_count: usize,
+    pub source_map_owner: *mut c_void,
     pub basic_block_offsets: *const usize,
     pub basic_block_count: usize,
     pub local_variable_names: *const FFIUtf16Slice,
@@ -229,6 +235,7 @@ pub struct FFIExecutableData {
     pub template_object_cache_count: u32,
     pub object_shape_cache_count: u32,
     pub object_property_iterator_cache_count: u32,
+    pub type_feedback_slot_count: u32,
     pub number_of_registers: u32,
     pub number_of_arguments: u32,
     pub is_strict: bool,
@@ -740,6 +747,7 @@ pub unsafe fn create_executable_with_dependencies(
             bytecode_owner: std::ptr::null_mut(),
             exception_handlers: &assembled.exception_handlers,
             source_map: &assembled.source_map,
+            source_map_owner: std::ptr::null_mut(),
             basic_block_start_offsets: &assembled.basic_block_start_offsets,
             number_of_registers: assembled.number_of_registers,
             number_of_arguments: assembled.number_of_arguments,
@@ -753,6 +761,7 @@ pub struct ExecutableParts<'a> {
     pub bytecode_owner: *mut c_void,
     pub exception_handlers: &'a [ExceptionHandler],
     pub source_map: &'a [SourceMapEntry],
+    pub source_map_owner: *mut c_void,
     pub basic_block_start_offsets: &'a [usize],
     pub number_of_registers: u32,
     pub number_of_arguments: u32,
@@ -765,6 +774,7 @@ pub struct ExecutableMetadata {
     pub template_object_cache_count: u32,
     pub object_shape_cache_count: u32,
     pub object_property_iterator_cache_count: u32,
+    pub type_feedback_slot_count: u32,
     pub is_strict: bool,
     pub length_identifier: Option<u32>,
 }
@@ -809,16 +819,29 @@ pub unsafe fn create_executable_from_slices(
             })
             .collect();
 
-        // Build FFI source map
-        let ffi_source_map: Vec<FFISourceMapEntry> = parts
-            .source_map
-            .iter()
-            .map(|e| FFISourceMapEntry {
-                bytecode_offset: e.bytecode_offset,
-                source_start_line: e.line,
-                source_start_column: e.column,
-            })
-            .collect();
+        // Build FFI source map. A source map with an owner lives in a cache
+        // blob that the C++ executable retains, so it is passed through as is.
+        let ffi_source_map: Vec<FFISourceMapEntry> = if parts.source_map_owner.is_null() {
+            parts
+                .source_map
+                .iter()
+                .map(|e| FFISourceMapEntry {
+                    bytecode_offset: e.bytecode_offset,
+                    source_start_line: e.line,
+                    source_start_column: e.column,
+                })
+                .collect()
+        } else {
+            Vec::new()
+        };
+        let (source_map, source_map_count) = if parts.source_map_owner.is_null() {
+            (ffi_source_map.as_ptr(), ffi_source_map.len())
+        } else {
+            (
+                parts.source_map.as_ptr().cast::<FFISourceMapEntry>(),
+                parts.source_map.len(),
+            )
+        };
 
         let ffi_data = FFIExecutableData {
             bytecode: parts.bytecode.as_ptr(),
@@ -835,8 +858,9 @@ pub unsafe fn create_executable_from_slices(
             constants_count: slices.constants_count,
             exception_handlers: ffi_handlers.as_ptr(),
             exception_handler_count: ffi_handlers.len(),
-            source_map: ffi_source_map.as_ptr(),
-            source_map_count: ffi_source_map.len(),
+            source_map,
+            source_map_count,
+            source_map_owner: parts.source_map_owner,
             basic_block_offsets: parts.basic_block_start_offsets.as_ptr(),
             basic_block_count: parts.basic_block_start_offsets.len(),
             local_variable_names: slices.local_variable_names.as_ptr(),
@@ -847,6 +871,7 @@ pub unsafe fn create_executable_from_slices(
             template_object_cache_count: metadata.template_object_cache_count,
             object_shape_cache_count: metadata.object_shape_cache_count,
             object_property_iterator_cache_count: metadata.object_property_iterator_cache_count,
+            type_feedback_slot_count: metadata.type_feedback_slot_count,
             number_of_registers: parts.number_of_registers,
             number_of_arguments: parts.number_of_arguments,
             is_strict: metadata.is_strict,
@@ -917,6 +942,7 @@ pub unsafe fn create_executable_with_dependencies_from_parts(
             template_object_cache_count: generator.next_template_object_cache,
             object_shape_cache_count: generator.next_object_shape_cache,
             object_property_iterator_cache_count: generator.next_object_property_iterator_cache,
+            type_feedback_slot_count: generator.next_type_feedback_slot,
             is_strict: generator.strict,
             length_identifier: generator.length_identifier.map(|index| index.0),
         };
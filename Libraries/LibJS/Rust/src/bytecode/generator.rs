@@ -263,6 +263,7 @@ pub struct Generator {
     pub next_template_object_cache: u32,
     pub next_object_shape_cache: u32,
     pub next_object_property_iterator_cache: u32,
+    pub next_type_feedback_slot: u32,
 
     // --- Codegen state ---
     pub strict: bool,
@@ -429,6 +430,7 @@ impl Generator {
             next_template_object_cache: 0,
             next_object_shape_cache: 0,
             next_object_property_iterator_cache: 0,
+            next_type_feedback_slot: 0,
             strict: false,
             this_value_needs_environment_resolution: true,
             enclosing_function_kind: FunctionKind::Normal,
@@ -974,6 +976,7 @@ impl Generator {
     next_cache_method!(next_template_object_cache, next_template_object_cache);
     next_cache_method!(next_object_shape_cache, next_object_shape_cache);
     next_cache_method!(next_object_property_iterator_cache, next_object_property_iterator_cache);
+    next_cache_method!(next_type_feedback_slot, next_type_feedback_slot);
 
     // --- Lexical environment helpers ---
 
@@ -1597,8 +1600,7 @@ impl Generator {
 
         // If any block is unterminated, ensure the undefined constant exists
         // for the assembly-time End(undefined) fallthrough. This must happen
-        // before computing number_of_constants so operand rewriting accounts
-        // for it.
+        // before the constant pool is handed off to the executable.
         let has_unterminated = self.basic_blocks.iter().any(|b| !b.terminated);
         let undefined_constant_operand = if has_unterminated {
             Some(self.add_constant_undefined().operand())
@@ -1608,7 +1610,6 @@ impl Generator {
 
         let number_of_registers = self.next_register;
         let number_of_locals = u32_from_usize(self.local_variables.len());
-        let number_of_constants = u32_from_usize(self.constants.len());
 
         // Phase 1: Operand rewriting
         let mut max_argument_index: Option<u32> = None;
@@ -1618,13 +1619,11 @@ impl Generator {
                     match op.operand_type() {
                         OperandType::Register => {} // stays as-is
                         OperandType::Local => op.offset_index_by(number_of_registers),
-                        OperandType::Constant => {
-                            op.offset_index_by(number_of_registers + number_of_locals);
-                        }
+                        OperandType::Constant => op.mark_as_constant_pool_index(),
                         OperandType::Argument => {
                             let index = op.index();
                             max_argument_index = Some(max_argument_index.map_or(index, |m| m.max(index)));
-                            op.offset_index_by(number_of_registers + number_of_locals + number_of_constants);
+                            op.offset_index_by(number_of_registers + number_of_locals);
                         }
                     }
                 });
@@ -1940,7 +1939,7 @@ impl Generator {
             // Unterminated blocks get an implicit End(undefined).
             if !block.terminated {
                 let mut undef_rewritten = undefined_constant_operand.expect("undefined constant must exist");
-                undef_rewritten.offset_index_by(number_of_registers + number_of_locals);
+                undef_rewritten.mark_as_constant_pool_index();
                 let end_instruction = Instruction::End { value: undef_rewritten };
                 let instruction_offset = bytecode.len();
                 push_source_map_entry(
@@ -40,6 +40,9 @@ impl Operand {
     const TYPE_SHIFT: u32 = 29;
     const INDEX_MASK: u32 = 0x1FFF_FFFF;
     pub const INVALID: u32 = 0xFFFF_FFFF;
+    /// Set on assembled constant operands. Mirrors `Operand::constant_pool_bit`
+    /// in the VM.
+    pub const CONSTANT_POOL_BIT: u32 = 0x8000_0000;
 
     pub fn register(reg: Register) -> Self {
         Self((0 << Self::TYPE_SHIFT) | reg.0)
@@ -98,12 +101,21 @@ impl Operand {
 
     /// Offset the index by the given amount, stripping the type tag and
     /// leaving a flat index into the combined
-    /// [registers | locals | constants | arguments] array.
+    /// [registers | locals | arguments] array.
     /// Used during operand rewriting in the assembler.
     pub fn offset_index_by(&mut self, offset: u32) {
         self.0 &= Self::INDEX_MASK;
         self.0 = self.0.checked_add(offset).expect("operand index overflow");
     }
+
+    /// Replace the type tag of a constant operand with `CONSTANT_POOL_BIT`,
+    /// so the VM reads it straight from the executable's constant pool
+    /// instead of from the execution context.
+    /// Used during operand rewriting in the assembler.
+    pub fn mark_as_constant_pool_index(&mut self) {
+        assert!(self.is_constant(), "only constant operands live in the constant pool");
+        self.0 = (self.0 & Self::INDEX_MASK) | Self::CONSTANT_POOL_BIT;
+    }
 }
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
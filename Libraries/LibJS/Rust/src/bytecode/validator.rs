@@ -18,6 +18,7 @@
 //! freshly-deserialized bytecode.
 
 use super::instruction::{NUM_OPCODES, instruction_length_from_bytes, validate_instruction};
+use super::operand::Operand;
 
 /// Sentinel u32 used by `Operand::INVALID` and by `Optional<*TableIndex>` for
 /// "no value". Mirrors the C++ `0xFFFFFFFF` constant used throughout
@@ -45,6 +46,7 @@ pub struct FFIValidatorBounds {
     pub template_object_cache_count: u32,
     pub object_shape_cache_count: u32,
     pub object_property_iterator_cache_count: u32,
+    pub type_feedback_slot_count: u32,
     pub class_blueprint_count: u32,
     pub shared_function_data_count: u32,
     /// Variant counts for the C++ enum types referenced by Bytecode.def
@@ -91,6 +93,7 @@ pub enum ValidationErrorKind {
     ExceptionHandlerRangeInvalid = 25,
     SourceMapOffsetInvalid = 26,
     EnvironmentCoordinateCacheIndexOutOfRange = 27,
+    TypeFeedbackSlotIndexOutOfRange = 28,
 }
 
 /// Detail returned to the C++ caller on validation failure.
@@ -156,19 +159,25 @@ pub fn read_u64(bytes: &[u8], at: usize) -> u64 {
 #[inline]
 pub fn validate_operand(raw: u32, ctx: &ValidationContext) -> Result<(), ValidationErrorKind> {
     // After the assembler runs, operands in the encoded instruction stream
-    // are flat indices into the runtime [registers | locals | constants |
-    // arguments] array; the original 3-bit type tag has been zeroed out by
-    // Operand::offset_index_by. The runtime indexes the combined array
-    // directly with raw, so the validator just needs to keep raw inside that
+    // are either flat indices into the runtime [registers | locals |
+    // arguments] array (the original 3-bit type tag has been zeroed out by
+    // Operand::offset_index_by), or constant pool indices tagged with
+    // Operand::CONSTANT_POOL_BIT. The runtime indexes the matching array
+    // directly, so the validator just needs to keep each kind inside its
     // array's bounds.
     if raw == INVALID_INDEX_U32 {
         return Err(ValidationErrorKind::OperandInvalid);
     }
+    if raw & Operand::CONSTANT_POOL_BIT != 0 {
+        if raw & !Operand::CONSTANT_POOL_BIT >= ctx.bounds.number_of_constants {
+            return Err(ValidationErrorKind::OperandOutOfRange);
+        }
+        return Ok(());
+    }
     let max = ctx
         .bounds
         .number_of_registers
         .saturating_add(ctx.bounds.number_of_locals)
-        .saturating_add(ctx.bounds.number_of_constants)
         .saturating_add(ctx.bounds.number_of_arguments);
     if raw >= max {
         return Err(ValidationErrorKind::OperandOutOfRange);
@@ -307,6 +316,14 @@ pub fn validate_object_property_iterator_cache_index(
     Ok(())
 }
 
+#[inline]
+pub fn validate_type_feedback_slot_index(raw: u32, ctx: &ValidationContext) -> Result<(), ValidationErrorKind> {
+    if raw >= ctx.bounds.type_feedback_slot_count {
+        return Err(ValidationErrorKind::TypeFeedbackSlotIndexOutOfRange);
+    }
+    Ok(())
+}
+
 #[inline]
 pub fn validate_shared_function_data_index(raw: u32, ctx: &ValidationContext) -> Result<(), ValidationErrorKind> {
     if raw >= ctx.bounds.shared_function_data_count {
@@ -521,6 +538,7 @@ mod tests {
             template_object_cache_count: 4,
             object_shape_cache_count: 4,
             object_property_iterator_cache_count: 4,
+            type_feedback_slot_count: 4,
             class_blueprint_count: 4,
             shared_function_data_count: 4,
             completion_type_variant_count: 6,
@@ -608,12 +626,24 @@ mod tests {
     #[test]
     fn rejects_operand_out_of_range() {
         let mut bytes = minimal_end_buffer();
-        // Bounds total = 8+4+4+4 = 20, so flat index 20 is out of range.
-        put_u32(&mut bytes, 4, 20);
+        // Frame bounds total = 8+4+4 = 16, so flat index 16 is out of range.
+        put_u32(&mut bytes, 4, 16);
         let err = validate(&bytes, &permissive_bounds()).unwrap_err();
         assert_eq!(err.kind, ValidationErrorKind::OperandOutOfRange);
     }
 
+    #[test]
+    fn rejects_constant_pool_operand_out_of_range() {
+        let mut bytes = minimal_end_buffer();
+        // There are 4 constants, so constant pool index 4 is out of range.
+        put_u32(&mut bytes, 4, Operand::CONSTANT_POOL_BIT | 4);
+        let err = validate(&bytes, &permissive_bounds()).unwrap_err();
+        assert_eq!(err.kind, ValidationErrorKind::OperandOutOfRange);
+
+        put_u32(&mut bytes, 4, Operand::CONSTANT_POOL_BIT | 3);
+        validate(&bytes, &permissive_bounds()).expect("last constant should pass");
+    }
+
     #[test]
     fn rejects_label_not_at_instruction_boundary() {
         // Build [Jump @4, End]: the Jump's target points into the middle of
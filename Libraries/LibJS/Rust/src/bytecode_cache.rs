@@ -13,7 +13,7 @@
 use std::collections::HashMap;
 use std::ffi::c_void;
 use std::ops::Range;
-use std::rc::Rc;
+use std::sync::Arc;
 
 use crate::bytecode::basic_block::SourceMapEntry;
 use crate::bytecode::ffi::{
@@ -29,7 +29,7 @@ use crate::bytecode::validator::{
 use crate::{CompiledProgram, CompiledProgramBytecode, ModuleCallbacks, ast, u32_from_usize};
 
 const MAGIC: &[u8; 8] = b"LBJSBC\0\0";
-const FORMAT_VERSION: u32 = 12;
+const FORMAT_VERSION: u32 = 16;
 const SOURCE_HASH_SIZE: usize = 32;
 const BYTECODE_ALIGNMENT: usize = 8;
 const COMPLETION_TYPE_VARIANT_COUNT: u32 = 6;
@@ -53,17 +53,44 @@ pub fn serialize_compiled_program(
     compiled: &CompiledProgram,
     program_type: ast::ProgramType,
     source_hash: &[u8; SOURCE_HASH_SIZE],
+    hot_function_offsets: &[u32],
 ) -> Vec<u8> {
     let mut encoder = Encoder::new();
     CacheBlob {
         compiled,
         program_type,
         source_hash,
+        hot_function_offsets,
     }
     .encode(&mut encoder);
     encoder.finish()
 }
 
+/// Return a copy of an encoded blob with its hot function profile replaced.
+///
+/// The profile is only known once the page has run for a while, after the
+/// blob was generated and stored. Since it's the last thing in the blob, it
+/// can be swapped out without decoding or re-encoding everything before it.
+pub fn replace_hot_function_offsets(blob: &[u8], hot_function_offsets: &[u32]) -> Option<Vec<u8>> {
+    let mut decoder = Decoder::new(blob, None);
+    decoder.expect_bytes(MAGIC)?;
+    (u32::decode(&mut decoder)? == FORMAT_VERSION).then_some(())?;
+
+    let count_offset = blob.len().checked_sub(size_of::<u32>())?;
+    let count: usize = u32::from_le_bytes(blob[count_offset..].try_into().ok()?)
+        .try_into()
+        .ok()?;
+    let profile_offset = count_offset.checked_sub(count.checked_mul(size_of::<u32>())?)?;
+    if profile_offset < MAGIC.len() + size_of::<u32>() {
+        return None;
+    }
+
+    let mut encoder = Encoder::new();
+    encoder.bytes(&blob[..profile_offset]);
+    HotFunctionProfile(hot_function_offsets).encode(&mut encoder);
+    Some(encoder.finish())
+}
+
 pub(crate) type FreeBytecodeCacheBlobOwner = unsafe extern "C" fn(*mut c_void);
 pub(crate) type CloneBytecodeCacheBlobOwner = unsafe extern "C" fn(*const c_void) -> *mut c_void;
 
@@ -145,6 +172,12 @@ struct ForeignBytecodeCacheBlob {
     free_owner: FreeBytecodeCacheBlobOwner,
 }
 
+// SAFETY: The blob bytes are immutable, so decoding can share them across threads. The owner callbacks are not
+// thread-safe, so the last reference to the blob must be dropped on the thread that decoded it; background decoding only
+// borrows records that the main thread keeps alive for the duration of the work.
+unsafe impl Send for ForeignBytecodeCacheBlob {}
+unsafe impl Sync for ForeignBytecodeCacheBlob {}
+
 impl Drop for ForeignBytecodeCacheBlob {
     fn drop(&mut self) {
         unsafe {
@@ -156,13 +189,13 @@ impl Drop for ForeignBytecodeCacheBlob {
 struct Decoder<'a> {
     bytes: &'a [u8],
     offset: usize,
-    foreign_blob: Option<Rc<ForeignBytecodeCacheBlob>>,
+    foreign_blob: Option<Arc<ForeignBytecodeCacheBlob>>,
 }
 
 impl<'a> Decoder<'a> {
     fn new(bytes: &'a [u8], owner: Option<ForeignBytecodeCacheBlobOwner>) -> Self {
         let foreign_blob = owner.map(|owner| {
-            Rc::new(ForeignBytecodeCacheBlob {
+            Arc::new(ForeignBytecodeCacheBlob {
                 data: bytes.as_ptr(),
                 length: bytes.len(),
                 owner: owner.owner,
@@ -523,9 +556,10 @@ impl ByteVector {
     }
 }
 
+#[derive(Clone)]
 enum DecodedBytecodeBytes {
     Foreign {
-        blob: Rc<ForeignBytecodeCacheBlob>,
+        blob: Arc<ForeignBytecodeCacheBlob>,
         range: Range<usize>,
     },
     #[cfg(test)]
@@ -660,6 +694,8 @@ struct CacheBlob<'a> {
     // time we go to attach the sidecar. Embedding the source hash makes a stale write harmless: a later read whose
     // source no longer matches will reject the blob and fall through to source compilation.
     source_hash: &'a [u8; SOURCE_HASH_SIZE],
+    // Source offsets of the functions that ran while the page was starting up, see HotFunctionProfile.
+    hot_function_offsets: &'a [u32],
 }
 
 impl Encode for CacheBlob<'_> {
@@ -676,6 +712,7 @@ impl Encode for CacheBlob<'_> {
         }
         .encode(encoder);
         ProgramRecord::from(self.compiled).encode(encoder);
+        HotFunctionProfile(self.hot_function_offsets).encode(encoder);
     }
 }
 
@@ -696,19 +733,60 @@ impl CacheBlob<'_> {
             is_strict_mode: bool::decode(decoder)?,
             metadata: DeclarationMetadataRecord::decode(decoder)?,
             program: ProgramRecord::decode(decoder)?,
+            hot_function_offsets: HotFunctionProfile::decode(decoder)?,
         })
     }
 }
 
+/// The bytecode cache identity offsets (SharedFunctionInstanceData's
+/// m_bytecode_cache_source_text_offset) of the functions that were called
+/// during startup on the load that generated the blob. Later loads decode
+/// those functions ahead of their first call.
+///
+/// Encoded as the offsets followed by their count, so that the profile can be
+/// found from the end of the blob and replaced in place, see
+/// `replace_hot_function_offsets()`.
+struct HotFunctionProfile<'a>(&'a [u32]);
+
+impl Encode for HotFunctionProfile<'_> {
+    fn encode(&self, encoder: &mut Encoder) {
+        for offset in self.0 {
+            offset.encode(encoder);
+        }
+        u32_from_usize(self.0.len()).encode(encoder);
+    }
+}
+
+impl HotFunctionProfile<'_> {
+    fn decode(decoder: &mut Decoder<'_>) -> Option<Vec<u32>> {
+        // The profile always runs to the end of the blob, so its length follows from what's left.
+        let remaining = decoder.bytes.len().checked_sub(size_of::<u32>())?;
+        if !remaining.is_multiple_of(size_of::<u32>()) {
+            return None;
+        }
+        let count = remaining / size_of::<u32>();
+        let mut offsets = Vec::with_capacity(count);
+        for _ in 0..count {
+            offsets.push(u32::decode(decoder)?);
+        }
+        (usize::try_from(u32::decode(decoder)?).ok()? == count).then_some(offsets)
+    }
+}
+
 pub(crate) struct DecodedCacheBlob {
     program_type: ast::ProgramType,
     has_top_level_await: bool,
     is_strict_mode: bool,
     metadata: DecodedDeclarationMetadata,
     program: DecodedProgramRecord,
+    hot_function_offsets: Vec<u32>,
 }
 
 impl DecodedCacheBlob {
+    pub(crate) fn hot_function_offsets(&self) -> &[u32] {
+        &self.hot_function_offsets
+    }
+
     fn validate(&self) {
         let _ = self.program_type as u8;
         let _ = self.has_top_level_await || self.is_strict_mode;
@@ -1520,6 +1598,63 @@ pub(crate) unsafe fn materialize_cached_function(
     }
 }
 
+pub(crate) unsafe fn clone_cached_function(cached_executable_ptr: *const c_void) -> *mut c_void {
+    unsafe {
+        if cached_executable_ptr.is_null() {
+            return std::ptr::null_mut();
+        }
+        let cached_executable = &*(cached_executable_ptr as *const DecodedCachedExecutableRecord);
+        Box::into_raw(Box::new(cached_executable.clone())) as *mut c_void
+    }
+}
+
+/// Decode and validate a cached function executable ahead of its first call.
+/// Only reads the record, so this may run on a background thread as long as
+/// the caller keeps the record alive until it returns.
+pub(crate) unsafe fn predecode_cached_function(cached_executable_ptr: *const c_void) -> *mut c_void {
+    unsafe {
+        if cached_executable_ptr.is_null() {
+            return std::ptr::null_mut();
+        }
+        let cached_executable = &*(cached_executable_ptr as *const DecodedCachedExecutableRecord);
+        let Some(executable) = cached_executable.decode_executable() else {
+            return std::ptr::null_mut();
+        };
+        if executable.validate_cached_bytecode().is_err() {
+            return std::ptr::null_mut();
+        }
+        Box::into_raw(Box::new(executable)) as *mut c_void
+    }
+}
+
+pub(crate) unsafe fn materialize_predecoded_function(
+    predecoded_executable_ptr: *mut c_void,
+    vm_ptr: *mut c_void,
+    source_code_ptr: *const c_void,
+    shared_function_data_list_ptr: *mut c_void,
+) -> *mut c_void {
+    unsafe {
+        if predecoded_executable_ptr.is_null() {
+            return std::ptr::null_mut();
+        }
+        let executable = Box::from_raw(predecoded_executable_ptr as *mut DecodedExecutableRecord);
+        let shared_function_data_owner = if shared_function_data_list_ptr.is_null() {
+            crate::bytecode::ffi::SharedFunctionDataOwner::None
+        } else {
+            crate::bytecode::ffi::SharedFunctionDataOwner::List(shared_function_data_list_ptr)
+        };
+        materialize_executable(*executable, vm_ptr, source_code_ptr, shared_function_data_owner)
+    }
+}
+
+pub(crate) unsafe fn free_predecoded_function(predecoded_executable_ptr: *mut c_void) {
+    unsafe {
+        if !predecoded_executable_ptr.is_null() {
+            drop(Box::from_raw(predecoded_executable_ptr as *mut DecodedExecutableRecord));
+        }
+    }
+}
+
 pub(crate) unsafe fn free_cached_function(cached_executable_ptr: *mut c_void) {
     unsafe {
         if !cached_executable_ptr.is_null() {
@@ -1641,8 +1776,13 @@ unsafe fn materialize_executable_for_install(
         let Some(exception_handlers) = exception_handlers.into_values() else {
             return std::ptr::null_mut();
         };
-        let Some(source_map) = source_map.into_values() else {
-            return std::ptr::null_mut();
+        let source_map_values;
+        let (source_map_entries, source_map_owner) = match source_map.entries_in_place() {
+            Some(entries) => (entries, source_map.owner_for_ffi()),
+            None => {
+                source_map_values = source_map.values();
+                (source_map_values.as_slice(), std::ptr::null_mut())
+            }
         };
 
         crate::bytecode::ffi::create_executable_from_slices(
@@ -1650,7 +1790,8 @@ unsafe fn materialize_executable_for_install(
                 bytecode: bytecode.as_slice(),
                 bytecode_owner: bytecode.owner_for_ffi(),
                 exception_handlers: &exception_handlers,
-                source_map: &source_map,
+                source_map: source_map_entries,
+                source_map_owner,
                 basic_block_start_offsets: &[],
                 number_of_registers,
                 number_of_arguments,
@@ -1662,6 +1803,7 @@ unsafe fn materialize_executable_for_install(
                 template_object_cache_count: cache_counters.template_object_cache_count,
                 object_shape_cache_count: cache_counters.object_shape_cache_count,
                 object_property_iterator_cache_count: cache_counters.object_property_iterator_cache_count,
+                type_feedback_slot_count: cache_counters.type_feedback_slot_count,
                 is_strict: strict,
                 length_identifier,
             },
@@ -2830,6 +2972,7 @@ impl DecodedExecutableRecord {
             template_object_cache_count: self.cache_counters.template_object_cache_count,
             object_shape_cache_count: self.cache_counters.object_shape_cache_count,
             object_property_iterator_cache_count: self.cache_counters.object_property_iterator_cache_count,
+            type_feedback_slot_count: self.cache_counters.type_feedback_slot_count,
             class_blueprint_count: self.class_blueprints.len() as u32,
             shared_function_data_count: self.shared_functions.len() as u32,
             completion_type_variant_count: COMPLETION_TYPE_VARIANT_COUNT,
@@ -2852,8 +2995,7 @@ impl DecodedExecutableRecord {
                 handler: handler.handler_offset,
             })
             .collect();
-        let source_map = self.source_map.values().ok_or(ValidationErrorKind::InvalidLength)?;
-        let source_map_offsets: Vec<u32> = source_map.iter().map(|entry| entry.bytecode_offset).collect();
+        let source_map_offsets = self.source_map.bytecode_offsets();
 
         validate_bytecode(
             self.bytecode.as_slice(),
@@ -2881,6 +3023,7 @@ impl DecodedExecutableRecord {
     }
 }
 
+#[derive(Clone)]
 struct DecodedCachedExecutableRecord {
     bytes: DecodedBytecodeBytes,
 }
@@ -2918,6 +3061,7 @@ impl Encode for CacheCounters<'_> {
         self.0.next_template_object_cache.encode(encoder);
         self.0.next_object_shape_cache.encode(encoder);
         self.0.next_object_property_iterator_cache.encode(encoder);
+        self.0.next_type_feedback_slot.encode(encoder);
     }
 }
 
@@ -2930,6 +3074,7 @@ impl CacheCounters<'_> {
             template_object_cache_count: u32::decode(decoder)?,
             object_shape_cache_count: u32::decode(decoder)?,
             object_property_iterator_cache_count: u32::decode(decoder)?,
+            type_feedback_slot_count: u32::decode(decoder)?,
         })
     }
 }
@@ -2941,6 +3086,7 @@ struct DecodedCacheCounters {
     template_object_cache_count: u32,
     object_shape_cache_count: u32,
     object_property_iterator_cache_count: u32,
+    type_feedback_slot_count: u32,
 }
 
 impl DecodedCacheCounters {
@@ -2950,7 +3096,8 @@ impl DecodedCacheCounters {
             + self.environment_coordinate_cache_count
             + self.template_object_cache_count
             + self.object_shape_cache_count
-            + self.object_property_iterator_cache_count;
+            + self.object_property_iterator_cache_count
+            + self.type_feedback_slot_count;
     }
 }
 
@@ -3187,48 +3334,81 @@ impl DecodedExceptionHandlerTable {
 
 struct SourceMapTable<'a>(&'a AssembledBytecode);
 
+// Source maps are stored as an aligned array of little-endian `SourceMapEntry`
+// records, so materialization can hand a mapped blob's entries to the C++
+// executable without copying them.
 impl Encode for SourceMapTable<'_> {
     fn encode(&self, encoder: &mut Encoder) {
-        DecodedRecordSequence::encode(encoder, &self.0.source_map, |entry, encoder| {
-            entry.bytecode_offset.encode(encoder);
-            entry.line.encode(encoder);
-            entry.column.encode(encoder);
-        });
+        let mut payload = Vec::with_capacity(self.0.source_map.len() * size_of::<SourceMapEntry>());
+        for entry in &self.0.source_map {
+            payload.extend_from_slice(&entry.bytecode_offset.to_le_bytes());
+            payload.extend_from_slice(&entry.line.to_le_bytes());
+            payload.extend_from_slice(&entry.column.to_le_bytes());
+        }
+        encoder.align_bytes_payload_to(BYTECODE_ALIGNMENT);
+        Bytes(&payload).encode(encoder);
     }
 }
 
 impl SourceMapTable<'_> {
     fn decode(decoder: &mut Decoder<'_>) -> Option<DecodedSourceMapTable> {
-        Some(DecodedSourceMapTable {
-            sequence: DecodedRecordSequence::decode(decoder)?,
-        })
+        decoder.align_bytes_payload_to(BYTECODE_ALIGNMENT)?;
+        let bytes = DecodedBytecodeBytes::decode(decoder)?;
+        bytes
+            .len()
+            .is_multiple_of(size_of::<SourceMapEntry>())
+            .then_some(DecodedSourceMapTable { bytes })
     }
 }
 
 struct DecodedSourceMapTable {
-    sequence: DecodedRecordSequence,
+    bytes: DecodedBytecodeBytes,
 }
 
 impl DecodedSourceMapTable {
     fn len(&self) -> usize {
-        self.sequence.len()
+        self.bytes.len() / size_of::<SourceMapEntry>()
     }
 
-    fn values(&self) -> Option<Vec<SourceMapEntry>> {
-        let mut decoder = self.sequence.decoder();
-        let mut values = Vec::with_capacity(self.sequence.len());
-        for _ in 0..self.sequence.len() {
-            values.push(SourceMapEntry {
-                bytecode_offset: u32::decode(&mut decoder)?,
-                line: u32::decode(&mut decoder)?,
-                column: u32::decode(&mut decoder)?,
-            });
+    fn entries(&self) -> impl Iterator<Item = SourceMapEntry> + '_ {
+        self.bytes
+            .as_slice()
+            .chunks_exact(size_of::<SourceMapEntry>())
+            .map(|chunk| {
+                let field = |index: usize| {
+                    let offset = index * size_of::<u32>();
+                    u32::from_le_bytes([chunk[offset], chunk[offset + 1], chunk[offset + 2], chunk[offset + 3]])
+                };
+                SourceMapEntry {
+                    bytecode_offset: field(0),
+                    line: field(1),
+                    column: field(2),
+                }
+            })
+    }
+
+    fn bytecode_offsets(&self) -> Vec<u32> {
+        self.entries().map(|entry| entry.bytecode_offset).collect()
+    }
+
+    fn values(&self) -> Vec<SourceMapEntry> {
+        self.entries().collect()
+    }
+
+    /// The stored entries, if they can be used in place on this target.
+    fn entries_in_place(&self) -> Option<&[SourceMapEntry]> {
+        if cfg!(target_endian = "big") {
+            return None;
         }
-        decoder.is_empty().then_some(values)
+        let bytes = self.bytes.as_slice();
+        if !(bytes.as_ptr() as usize).is_multiple_of(align_of::<SourceMapEntry>()) {
+            return None;
+        }
+        Some(unsafe { std::slice::from_raw_parts(bytes.as_ptr().cast(), self.len()) })
     }
 
-    fn into_values(self) -> Option<Vec<SourceMapEntry>> {
-        self.values()
+    fn owner_for_ffi(&self) -> *mut c_void {
+        self.bytes.owner_for_ffi()
     }
 }
 
@@ -3994,6 +4174,58 @@ mod tests {
         assert!(ConstantTable::decode(&mut decoder).is_none());
     }
 
+    #[test]
+    fn hot_function_profile_round_trips_at_end_of_blob() {
+        let mut encoder = Encoder::new();
+        encoder.bytes(&[0xAA; 5]);
+        HotFunctionProfile(&[3, 17, 42]).encode(&mut encoder);
+        let bytes = encoder.finish();
+
+        let mut decoder = Decoder::new(&bytes, None);
+        decoder.bytes(5).unwrap();
+        assert_eq!(HotFunctionProfile::decode(&mut decoder), Some(vec![3, 17, 42]));
+        assert!(decoder.is_empty());
+    }
+
+    #[test]
+    fn hot_function_profile_decode_rejects_mismatched_count() {
+        let mut bytes = Vec::new();
+        bytes.extend_from_slice(&7u32.to_le_bytes());
+        bytes.extend_from_slice(&2u32.to_le_bytes());
+
+        let mut decoder = Decoder::new(&bytes, None);
+        assert!(HotFunctionProfile::decode(&mut decoder).is_none());
+    }
+
+    #[test]
+    fn replace_hot_function_offsets_keeps_everything_before_the_profile() {
+        let mut encoder = Encoder::new();
+        encoder.bytes(MAGIC);
+        FORMAT_VERSION.encode(&mut encoder);
+        encoder.bytes(&[1, 2, 3]);
+        let prefix_length = encoder.bytes.len();
+        HotFunctionProfile(&[]).encode(&mut encoder);
+        let blob = encoder.finish();
+
+        let replaced = replace_hot_function_offsets(&blob, &[5, 9]).unwrap();
+        assert_eq!(replaced[..prefix_length], blob[..prefix_length]);
+        let mut decoder = Decoder::new(&replaced, None);
+        decoder.bytes(prefix_length).unwrap();
+        assert_eq!(HotFunctionProfile::decode(&mut decoder), Some(vec![5, 9]));
+
+        let replaced_again = replace_hot_function_offsets(&replaced, &[]).unwrap();
+        assert_eq!(replaced_again, blob);
+    }
+
+    #[test]
+    fn replace_hot_function_offsets_rejects_other_format_versions() {
+        let mut encoder = Encoder::new();
+        encoder.bytes(MAGIC);
+        (FORMAT_VERSION - 1).encode(&mut encoder);
+        HotFunctionProfile(&[]).encode(&mut encoder);
+        assert!(replace_hot_function_offsets(&encoder.finish(), &[1]).is_none());
+    }
+
     #[test]
     fn decode_rejects_mismatched_source_hash_before_payload() {
         let stored_source_hash = [1u8; SOURCE_HASH_SIZE];
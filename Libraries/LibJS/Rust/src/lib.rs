@@ -146,6 +146,16 @@ pub struct BytecodeCacheBlob {
     length: usize,
 }
 
+impl BytecodeCacheBlob {
+    fn from_vec(bytes: Vec<u8>) -> Self {
+        let length = bytes.len();
+        let mut bytes = bytes.into_boxed_slice();
+        let data = bytes.as_mut_ptr();
+        std::mem::forget(bytes);
+        Self { data, length }
+    }
+}
+
 pub struct DecodedBytecodeCacheBlob {
     _blob: bytecode_cache::DecodedCacheBlob,
 }
@@ -794,13 +804,16 @@ pub unsafe extern "C" fn rust_free_compiled_program(compiled: *mut CompiledProgr
 /// `rust_free_bytecode_cache_blob()`.
 ///
 /// # Safety
-/// `compiled` must be a valid pointer from `rust_compile_parsed_program_fully_off_thread()`.
+/// - `compiled` must be a valid pointer from `rust_compile_parsed_program_fully_off_thread()`.
+/// - `hot_function_offsets` must point to `hot_function_offsets_count` readable values, or be null if the count is 0.
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn rust_serialize_compiled_program_for_bytecode_cache(
     compiled: *const CompiledProgram,
     program_type: u8,
     source_hash: *const u8,
     source_hash_len: usize,
+    hot_function_offsets: *const u32,
+    hot_function_offsets_count: usize,
 ) -> BytecodeCacheBlob {
     unsafe {
         abort_on_panic(|| {
@@ -825,16 +838,60 @@ pub unsafe extern "C" fn rust_serialize_compiled_program_for_bytecode_cache(
             let source_hash = std::slice::from_raw_parts(source_hash, source_hash_len)
                 .try_into()
                 .expect("source hash length was checked");
-            let bytes = bytecode_cache::serialize_compiled_program(&*compiled, program_type, source_hash);
-            let length = bytes.len();
-            let mut bytes = bytes.into_boxed_slice();
-            let data = bytes.as_mut_ptr();
-            std::mem::forget(bytes);
-            BytecodeCacheBlob { data, length }
+            let hot_function_offsets = u32_slice_from_raw_parts(hot_function_offsets, hot_function_offsets_count);
+            let bytes =
+                bytecode_cache::serialize_compiled_program(&*compiled, program_type, source_hash, hot_function_offsets);
+            BytecodeCacheBlob::from_vec(bytes)
         })
     }
 }
 
+/// Copy an encoded bytecode cache blob, replacing its hot function profile.
+///
+/// Returns an empty blob if `data` is not a blob of the current format. The
+/// caller owns the returned bytes and must release them with
+/// `rust_free_bytecode_cache_blob()`.
+///
+/// # Safety
+/// - `data` must point to `length` readable bytes.
+/// - `hot_function_offsets` must point to `hot_function_offsets_count` readable values, or be null if the count is 0.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_bytecode_cache_blob_with_hot_function_offsets(
+    data: *const u8,
+    length: usize,
+    hot_function_offsets: *const u32,
+    hot_function_offsets_count: usize,
+) -> BytecodeCacheBlob {
+    unsafe {
+        abort_on_panic(|| {
+            if data.is_null() {
+                return BytecodeCacheBlob {
+                    data: std::ptr::null_mut(),
+                    length: 0,
+                };
+            }
+            let hot_function_offsets = u32_slice_from_raw_parts(hot_function_offsets, hot_function_offsets_count);
+            match bytecode_cache::replace_hot_function_offsets(
+                std::slice::from_raw_parts(data, length),
+                hot_function_offsets,
+            ) {
+                Some(bytes) => BytecodeCacheBlob::from_vec(bytes),
+                None => BytecodeCacheBlob {
+                    data: std::ptr::null_mut(),
+                    length: 0,
+                },
+            }
+        })
+    }
+}
+
+unsafe fn u32_slice_from_raw_parts<'a>(data: *const u32, count: usize) -> &'a [u32] {
+    if data.is_null() || count == 0 {
+        return &[];
+    }
+    unsafe { std::slice::from_raw_parts(data, count) }
+}
+
 /// Free a bytecode cache blob returned by `rust_serialize_compiled_program_for_bytecode_cache()`.
 ///
 /// # Safety
@@ -904,6 +961,26 @@ pub unsafe extern "C" fn rust_decode_bytecode_cache_blob_with_owner(
     }
 }
 
+/// Get the hot function profile recorded in a decoded bytecode cache blob.
+///
+/// The returned pointer is owned by the blob and valid until it is freed or
+/// materialized.
+///
+/// # Safety
+/// - `blob` must be a valid pointer from `rust_decode_bytecode_cache_blob_with_owner()`.
+/// - `count_out` must be a valid writable pointer.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_decoded_bytecode_cache_blob_hot_function_offsets(
+    blob: *const DecodedBytecodeCacheBlob,
+    count_out: *mut usize,
+) -> *const u32 {
+    unsafe {
+        let offsets = (*blob)._blob.hot_function_offsets();
+        *count_out = offsets.len();
+        offsets.as_ptr()
+    }
+}
+
 /// Free a decoded bytecode cache blob.
 ///
 /// # Safety
@@ -1114,6 +1191,17 @@ pub unsafe extern "C" fn rust_materialize_bytecode_cache_function(
     }
 }
 
+/// Clone a cached decoded function executable. The clone shares the
+/// underlying bytecode cache blob with the original.
+///
+/// # Safety
+/// `cached_executable` must be either null or a valid pointer attached to a
+/// `SharedFunctionInstanceData` by bytecode cache materialization.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_clone_cached_bytecode_executable(cached_executable: *const c_void) -> *mut c_void {
+    unsafe { abort_on_panic(|| bytecode_cache::clone_cached_function(cached_executable)) }
+}
+
 /// Free a cached decoded function executable without materializing it.
 ///
 /// # Safety
@@ -1128,6 +1216,60 @@ pub unsafe extern "C" fn rust_free_cached_bytecode_executable(cached_executable:
     }
 }
 
+/// Decode and validate a cached function executable without materializing
+/// it. Safe to call from a background thread; does not consume the cached
+/// executable. Returns null if the cached bytecode is rejected.
+///
+/// # Safety
+/// `cached_executable` must be either null or a valid pointer returned by
+/// `rust_clone_cached_bytecode_executable()` that no other thread is freeing
+/// or materializing, and whose last reference is dropped on the main thread.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_predecode_cached_bytecode_executable(cached_executable: *const c_void) -> *mut c_void {
+    unsafe { abort_on_panic(|| bytecode_cache::predecode_cached_function(cached_executable)) }
+}
+
+/// Materialize a function executable returned by
+/// `rust_predecode_cached_bytecode_executable()`.
+/// Consumes and frees the predecoded executable.
+///
+/// # Safety
+/// - `predecoded_executable` must be a valid pointer from `rust_predecode_cached_bytecode_executable()`.
+/// - `vm_ptr` must be a valid `JS::VM*`.
+/// - `source_code_ptr` must be a valid `JS::SourceCode const*`.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_materialize_predecoded_bytecode_function(
+    predecoded_executable: *mut c_void,
+    vm_ptr: *mut c_void,
+    source_code_ptr: *const c_void,
+    shared_function_data_list_ptr: *mut c_void,
+) -> *mut c_void {
+    unsafe {
+        abort_on_panic(|| {
+            bytecode_cache::materialize_predecoded_function(
+                predecoded_executable,
+                vm_ptr,
+                source_code_ptr,
+                shared_function_data_list_ptr,
+            )
+        })
+    }
+}
+
+/// Free a predecoded function executable without materializing it.
+///
+/// # Safety
+/// `predecoded_executable` must be either null or a valid pointer from
+/// `rust_predecode_cached_bytecode_executable()`.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_free_predecoded_bytecode_executable(predecoded_executable: *mut c_void) {
+    unsafe {
+        abort_on_panic(|| {
+            bytecode_cache::free_predecoded_function(predecoded_executable);
+        });
+    }
+}
+
 /// Materialize a precompiled function executable.
 /// Consumes and frees the precompiled executable.
 ///
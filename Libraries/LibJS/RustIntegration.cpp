@@ -418,9 +418,8 @@ void free_compiled_program(CompiledProgram* compiled)
     rust_free_compiled_program(compiled);
 }
 
-ByteBuffer serialize_compiled_program_for_bytecode_cache(CompiledProgram const& compiled, ProgramType type, ReadonlyBytes source_hash)
+static ByteBuffer take_bytecode_cache_blob(BytecodeCacheBlob blob)
 {
-    auto blob = rust_serialize_compiled_program_for_bytecode_cache(&compiled, static_cast<u8>(type), source_hash.data(), source_hash.size());
     if (!blob.data || blob.length == 0)
         return {};
 
@@ -429,6 +428,25 @@ ByteBuffer serialize_compiled_program_for_bytecode_cache(CompiledProgram const&
     return bytes;
 }
 
+ByteBuffer serialize_compiled_program_for_bytecode_cache(CompiledProgram const& compiled, ProgramType type, ReadonlyBytes source_hash, ReadonlySpan<u32> hot_function_offsets)
+{
+    return take_bytecode_cache_blob(rust_serialize_compiled_program_for_bytecode_cache(&compiled, static_cast<u8>(type), source_hash.data(), source_hash.size(), hot_function_offsets.data(), hot_function_offsets.size()));
+}
+
+ByteBuffer bytecode_cache_blob_with_hot_function_offsets(ReadonlyBytes blob, ReadonlySpan<u32> hot_function_offsets)
+{
+    return take_bytecode_cache_blob(rust_bytecode_cache_blob_with_hot_function_offsets(blob.data(), blob.size(), hot_function_offsets.data(), hot_function_offsets.size()));
+}
+
+Vector<u32> bytecode_cache_hot_function_offsets(DecodedBytecodeCacheBlob const* blob)
+{
+    size_t count = 0;
+    auto const* offsets = rust_decoded_bytecode_cache_blob_hot_function_offsets(blob, &count);
+    Vector<u32> result;
+    result.append(offsets, count);
+    return result;
+}
+
 static void free_bytecode_cache_blob_owner(void* owner)
 {
     delete static_cast<Core::ImmutableBytes*>(owner);
@@ -895,6 +913,7 @@ GC::Ptr<Bytecode::Executable> compile_function(VM& vm, SharedFunctionInstanceDat
     if (shared_data.m_cached_bytecode_executable) {
         GC::DeferGC defer_gc(vm.heap());
         TemporaryChange validate_cache_executables { s_validate_materialized_bytecode_cache_executables, true };
+        shared_data.retain_cached_bytecode_executable_for_flushing(vm);
         auto* exec = static_cast<Bytecode::Executable*>(rust_materialize_bytecode_cache_function(
             shared_data.m_cached_bytecode_executable,
             &vm,
@@ -945,12 +964,54 @@ void free_compiled_function(CompiledFunction* compiled)
     rust_free_compiled_function(compiled);
 }
 
+void* clone_cached_bytecode_executable(void const* executable)
+{
+    if (!executable)
+        return nullptr;
+    return rust_clone_cached_bytecode_executable(executable);
+}
+
 void free_cached_bytecode_executable(void* executable)
 {
     if (executable)
         rust_free_cached_bytecode_executable(executable);
 }
 
+void* predecode_cached_bytecode_executable(void const* executable)
+{
+    if (!executable)
+        return nullptr;
+    return rust_predecode_cached_bytecode_executable(executable);
+}
+
+GC::Ptr<Bytecode::Executable> materialize_predecoded_bytecode_executable(VM& vm, SharedFunctionInstanceData& shared_data, void* predecoded_executable)
+{
+    // The function may have been called (or its script torn down) while we were decoding.
+    if (shared_data.m_executable || !shared_data.m_cached_bytecode_executable) {
+        free_predecoded_bytecode_executable(predecoded_executable);
+        return nullptr;
+    }
+
+    GC::DeferGC defer_gc(vm.heap());
+    TemporaryChange validate_cache_executables { s_validate_materialized_bytecode_cache_executables, true };
+    shared_data.retain_cached_bytecode_executable_for_flushing(vm);
+    auto* exec = static_cast<Bytecode::Executable*>(rust_materialize_predecoded_bytecode_function(
+        predecoded_executable,
+        &vm,
+        shared_data.m_source_code.ptr(),
+        shared_data.m_owner_shared_function_data_list));
+    if (!exec)
+        return nullptr;
+    rust_free_cached_bytecode_executable(exchange(shared_data.m_cached_bytecode_executable, nullptr));
+    return exec;
+}
+
+void free_predecoded_bytecode_executable(void* executable)
+{
+    if (executable)
+        rust_free_predecoded_bytecode_executable(executable);
+}
+
 void free_precompiled_bytecode_executable(void* executable)
 {
     if (executable)
@@ -1185,6 +1246,7 @@ extern "C" void* rust_create_executable(
         data->template_object_cache_count,
         data->object_shape_cache_count,
         data->object_property_iterator_cache_count,
+        data->type_feedback_slot_count,
         data->number_of_registers,
         data->is_strict ? JS::Strict::Yes : JS::Strict::No);
 
@@ -1199,13 +1261,31 @@ extern "C" void* rust_create_executable(
     }
 
     // Set source map
-    executable->source_map.ensure_capacity(data->source_map_count);
-    for (size_t i = 0; i < data->source_map_count; ++i) {
-        executable->source_map.append({
-            data->source_map[i].bytecode_offset,
-            data->source_map[i].source_start_line,
-            data->source_map[i].source_start_column,
-        });
+    if (data->source_map_owner) {
+        // The entries already have our layout inside the bytecode cache blob, so use them in place.
+        static_assert(sizeof(FFISourceMapEntry) == sizeof(JS::Bytecode::SourceMapEntry));
+        static_assert(alignof(FFISourceMapEntry) == alignof(JS::Bytecode::SourceMapEntry));
+        auto source_map_owner = adopt_own_if_nonnull(static_cast<Core::ImmutableBytes*>(data->source_map_owner));
+        VERIFY(source_map_owner);
+        auto bytes = source_map_owner->bytes();
+        size_t offset = 0;
+        if (data->source_map_count > 0) {
+            auto const* source_map_bytes = reinterpret_cast<u8 const*>(data->source_map);
+            VERIFY(source_map_bytes >= bytes.data());
+            offset = static_cast<size_t>(source_map_bytes - bytes.data());
+        }
+        executable->source_map = JS::Bytecode::SourceMap { move(*source_map_owner), offset, data->source_map_count };
+    } else {
+        Vector<JS::Bytecode::SourceMapEntry> source_map;
+        source_map.ensure_capacity(data->source_map_count);
+        for (size_t i = 0; i < data->source_map_count; ++i) {
+            source_map.unchecked_append({
+                data->source_map[i].bytecode_offset,
+                data->source_map[i].source_start_line,
+                data->source_map[i].source_start_column,
+            });
+        }
+        executable->source_map = JS::Bytecode::SourceMap { move(source_map) };
     }
 
     // Keep basic block offsets transient. They are only needed by the
@@ -1228,9 +1308,8 @@ extern "C" void* rust_create_executable(
 
     // Set layout indices
     executable->local_index_base = data->number_of_registers;
-    executable->argument_index_base = data->number_of_registers + data->local_variable_count + data->constants_count;
+    executable->argument_index_base = data->number_of_registers + data->local_variable_count;
     executable->registers_and_locals_count = data->number_of_registers + data->local_variable_count;
-    executable->registers_and_locals_and_constants_count = data->number_of_registers + data->local_variable_count + data->constants_count;
     executable->number_of_arguments = data->number_of_arguments;
 
     // Set length identifier (for GetLength optimization)
@@ -1482,27 +1561,13 @@ extern "C" void* rust_sfd_executable(void const* sfd_ptr)
     return shared.m_executable.ptr();
 }
 
-static size_t bytecode_cache_source_text_offset(JS::SharedFunctionInstanceData const& shared)
-{
-    if (shared.m_has_bytecode_cache_source_text_range)
-        return shared.m_bytecode_cache_source_text_offset;
-    return shared.m_source_text_offset;
-}
-
-static size_t bytecode_cache_source_text_length(JS::SharedFunctionInstanceData const& shared)
-{
-    if (shared.m_has_bytecode_cache_source_text_range)
-        return shared.m_bytecode_cache_source_text_length;
-    return shared.m_source_text_length;
-}
-
 extern "C" bool rust_sfd_matches_bytecode_cache_function(void const* sfd_ptr, FFISharedFunctionData const* data)
 {
     if (!sfd_ptr || !data)
         return false;
     auto& shared = *static_cast<JS::SharedFunctionInstanceData const*>(sfd_ptr);
-    return bytecode_cache_source_text_offset(shared) == data->source_text_offset
-        && bytecode_cache_source_text_length(shared) == data->source_text_length
+    return shared.bytecode_cache_source_text_offset() == data->source_text_offset
+        && shared.bytecode_cache_source_text_length() == data->source_text_length
         && shared.m_function_length == data->function_length
         && shared.m_formal_parameter_count == data->formal_parameter_count
         && shared.m_kind == static_cast<JS::FunctionKind>(data->function_kind)
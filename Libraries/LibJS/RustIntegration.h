@@ -113,7 +113,15 @@ JS_API void free_parsed_program(FFI::ParsedProgram*);
 JS_API void free_compiled_program(FFI::CompiledProgram*);
 
 // Serialize a fully compiled program into a versioned bytecode cache blob.
-JS_API ByteBuffer serialize_compiled_program_for_bytecode_cache(FFI::CompiledProgram const&, ProgramType, ReadonlyBytes source_hash);
+JS_API ByteBuffer serialize_compiled_program_for_bytecode_cache(FFI::CompiledProgram const&, ProgramType, ReadonlyBytes source_hash, ReadonlySpan<u32> hot_function_offsets = {});
+
+// Copy a serialized bytecode cache blob, replacing its hot function profile. Returns an empty buffer if the blob is not
+// of the current format.
+JS_API ByteBuffer bytecode_cache_blob_with_hot_function_offsets(ReadonlyBytes blob, ReadonlySpan<u32> hot_function_offsets);
+
+// Get the hot function profile recorded in a decoded bytecode cache blob: the bytecode cache source text offsets of
+// the functions that ran during startup when the blob was generated.
+JS_API Vector<u32> bytecode_cache_hot_function_offsets(FFI::DecodedBytecodeCacheBlob const*);
 
 // Decode an ImmutableBytes-backed bytecode cache blob into a parser-free cache handle.
 JS_API FFI::DecodedBytecodeCacheBlob* decode_bytecode_cache_blob(Core::ImmutableBytes, ProgramType, ReadonlyBytes source_hash);
@@ -201,8 +209,22 @@ JS_API FFI::CompiledFunction* compile_function_off_thread(void* function_ast, si
 JS_API void materialize_compiled_function(FFI::CompiledFunction*, VM&, SourceCode const&, SharedFunctionInstanceData&);
 JS_API void free_compiled_function(FFI::CompiledFunction*);
 
+// Clone a Rust decoded bytecode cache executable pointer. Returns null if null.
+JS_API void* clone_cached_bytecode_executable(void const*);
+
 // Free a Rust decoded bytecode cache executable pointer. No-op if null.
-void free_cached_bytecode_executable(void*);
+JS_API void free_cached_bytecode_executable(void*);
+
+// Decode and validate a cloned bytecode cache executable ahead of its first call. Safe to call from any thread, as
+// long as the clone outlives the call and is freed on the main thread. Returns null if the bytecode is rejected.
+JS_API void* predecode_cached_bytecode_executable(void const*);
+
+// Materialize a function from a predecoded executable in place of its lazy bytecode cache input. Must be called on the
+// main thread. Consumes the predecoded executable, and returns null if the function no longer needs it.
+JS_API GC::Ptr<Bytecode::Executable> materialize_predecoded_bytecode_executable(VM&, SharedFunctionInstanceData&, void* predecoded_executable);
+
+// Free a predecoded executable without materializing it. No-op if null.
+JS_API void free_predecoded_bytecode_executable(void*);
 
 // Free a Rust precompiled bytecode executable pointer. No-op if null.
 void free_precompiled_bytecode_executable(void*);
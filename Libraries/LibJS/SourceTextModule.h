@@ -65,6 +65,7 @@ public:
     void finish_bytecode_cache_generation_without_install();
     bool try_install_bytecode_cache(FFI::DecodedBytecodeCacheBlob*, NonnullRefPtr<SourceCode const> source_code);
     void install_generated_bytecode_cache(FFI::DecodedBytecodeCacheBlob*, NonnullRefPtr<SourceCode const> source_code);
+    [[nodiscard]] Vector<u32> bytecode_cache_offsets_of_called_functions() const { return m_shared_function_data.bytecode_cache_offsets_of_called_functions(); }
 
 protected:
     virtual ThrowCompletionOr<void> initialize_environment(VM& vm) override;
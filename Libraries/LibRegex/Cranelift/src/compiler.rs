@@ -0,0 +1,612 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+use crate::{NativeInsn, RuntimeHelpers, context, opcode, result};
+
+use cranelift_codegen::Context;
+use cranelift_codegen::ir::condcodes::IntCC;
+use cranelift_codegen::ir::types;
+use cranelift_codegen::ir::{AbiParam, Block, Function, InstBuilder, MemFlags, SigRef, Signature, UserFuncName, Value};
+use cranelift_codegen::settings::{self, Configurable};
+use cranelift_frontend::{FunctionBuilder, FunctionBuilderContext, Variable};
+
+/// Set on backtrack stack entries that restore a register rather than resume
+/// at an instruction.
+const RESTORE_REGISTER_TAG: u64 = 1 << 63;
+
+/// Emits a backtracking matcher for one flattened NFA.
+///
+/// Every instruction gets its own block. The current position, backtrack
+/// stack pointer and remaining steps live in variables; registers live in the
+/// caller's buffer. A `Split` pushes a `(target, position)` entry and every
+/// register write pushes a `(tag | register, old value)` entry, so popping
+/// entries until a resume point is found undoes everything done since that
+/// choice was made. This is the same exploration order as the backtracking
+/// VM, so the first match found is the one the VM would report.
+struct Emitter<'a, 'b> {
+    builder: &'a mut FunctionBuilder<'b>,
+    insns: &'a [NativeInsn],
+    ranges: &'a [[u32; 2]],
+    code_unit_size: u32,
+    blocks: Vec<Block>,
+    backtrack_block: Block,
+    finish_block: Block,
+    stack_exhausted_block: Block,
+    pos_var: Variable,
+    sp_var: Variable,
+    steps_var: Variable,
+    input: Value,
+    input_length: Value,
+    registers: Value,
+    backtrack_stack: Value,
+    backtrack_stack_words: Value,
+    nfa: Value,
+    accepts_sig: SigRef,
+    accepts_address: i64,
+}
+
+pub struct RegexCompiler;
+
+impl RegexCompiler {
+    pub fn compile_to_bytes(
+        insns: &[NativeInsn],
+        ranges: &[[u32; 2]],
+        helpers: &RuntimeHelpers,
+        code_unit_size: u32,
+    ) -> Result<Vec<u8>, &'static str> {
+        if code_unit_size != 1 && code_unit_size != 2 {
+            return Err("unsupported code unit size");
+        }
+        Self::validate(insns, ranges)?;
+
+        let mut flag_builder = settings::builder();
+        flag_builder.set("opt_level", "speed").unwrap();
+        flag_builder.set("is_pic", "false").unwrap();
+        let flags = settings::Flags::new(flag_builder);
+        let isa = cranelift_native::builder()
+            .map_err(|_| "unsupported host architecture")?
+            .finish(flags)
+            .map_err(|_| "failed to build ISA")?;
+
+        // NB: The context layout and backtrack stack entries assume 64-bit pointers.
+        let ptr_type = isa.pointer_type();
+        if ptr_type != types::I64 {
+            return Err("unsupported pointer width");
+        }
+
+        // Function signature matches NativeEntry:
+        //   i32 fn(NativeMatchContext* context)
+        let host_cc = isa.default_call_conv();
+        let mut sig = Signature::new(host_cc);
+        sig.params.push(AbiParam::new(ptr_type)); // context
+        sig.returns.push(AbiParam::new(types::I32));
+
+        let mut func = Function::with_name_signature(UserFuncName::user(0, 0), sig);
+        let mut builder_ctx = FunctionBuilderContext::new();
+        let mut builder = FunctionBuilder::new(&mut func, &mut builder_ctx);
+
+        let pos_var = Variable::from_u32(0);
+        let sp_var = Variable::from_u32(1);
+        let steps_var = Variable::from_u32(2);
+        for var in [pos_var, sp_var, steps_var] {
+            builder.declare_var(var, types::I64);
+        }
+
+        let entry_block = builder.create_block();
+        builder.append_block_params_for_function_params(entry_block);
+        builder.switch_to_block(entry_block);
+
+        let context_val = builder.block_params(entry_block)[0];
+        let load_field = |builder: &mut FunctionBuilder, offset: i32| {
+            builder.ins().load(types::I64, MemFlags::trusted(), context_val, offset)
+        };
+        let input = load_field(&mut builder, context::INPUT);
+        let input_length = load_field(&mut builder, context::INPUT_LENGTH);
+        let start = load_field(&mut builder, context::START);
+        let registers = load_field(&mut builder, context::REGISTERS);
+        let backtrack_stack = load_field(&mut builder, context::BACKTRACK_STACK);
+        let backtrack_stack_words = load_field(&mut builder, context::BACKTRACK_STACK_WORDS);
+        let steps = load_field(&mut builder, context::STEPS_REMAINING);
+        let nfa = load_field(&mut builder, context::NFA);
+
+        let zero = builder.ins().iconst(types::I64, 0);
+        builder.def_var(pos_var, start);
+        builder.def_var(sp_var, zero);
+        builder.def_var(steps_var, steps);
+
+        // u32 fn(nfa, pc, code_point)
+        let accepts_sig = {
+            let mut s = Signature::new(host_cc);
+            s.params.push(AbiParam::new(ptr_type));
+            s.params.push(AbiParam::new(types::I32));
+            s.params.push(AbiParam::new(types::I32));
+            s.returns.push(AbiParam::new(types::I32));
+            builder.import_signature(s)
+        };
+
+        let blocks: Vec<Block> = insns.iter().map(|_| builder.create_block()).collect();
+        let backtrack_block = builder.create_block();
+        let finish_block = builder.create_block();
+        builder.append_block_param(finish_block, types::I32);
+        let stack_exhausted_block = builder.create_block();
+
+        builder.ins().jump(blocks[0], &[]);
+
+        let mut emitter = Emitter {
+            builder: &mut builder,
+            insns,
+            ranges,
+            code_unit_size,
+            blocks,
+            backtrack_block,
+            finish_block,
+            stack_exhausted_block,
+            pos_var,
+            sp_var,
+            steps_var,
+            input,
+            input_length,
+            registers,
+            backtrack_stack,
+            backtrack_stack_words,
+            nfa,
+            accepts_sig,
+            accepts_address: helpers.accepts as i64,
+        };
+
+        for pc in 0..insns.len() {
+            emitter.emit_instruction(pc);
+        }
+        emitter.emit_backtrack();
+        emitter.emit_exits(context_val);
+
+        builder.seal_all_blocks();
+        builder.finalize();
+
+        let mut ctx = Context::for_function(func);
+        let code = ctx
+            .compile(&*isa, &mut Default::default())
+            .map_err(|_| "cranelift compilation failed")?;
+
+        Ok(code.code_buffer().to_vec())
+    }
+
+    fn validate(insns: &[NativeInsn], ranges: &[[u32; 2]]) -> Result<(), &'static str> {
+        if insns.is_empty() {
+            return Err("empty program");
+        }
+        let count = insns.len();
+        for (pc, insn) in insns.iter().enumerate() {
+            let falls_through = !matches!(insn.opcode, opcode::JUMP | opcode::MATCH | opcode::FAIL);
+            if falls_through && pc + 1 >= count {
+                return Err("instruction falls off the end of the program");
+            }
+            match insn.opcode {
+                opcode::JUMP | opcode::SPLIT if insn.a as usize >= count => return Err("branch target out of range"),
+                opcode::SPLIT if insn.b as usize >= count => return Err("branch target out of range"),
+                opcode::CONSUME_CLASS if insn.a as usize + insn.b as usize > ranges.len() => {
+                    return Err("character class out of range");
+                }
+                opcode::CONSUME_CHAR..=opcode::FAIL => {}
+                _ => return Err("unsupported instruction"),
+            }
+        }
+        Ok(())
+    }
+}
+
+impl Emitter<'_, '_> {
+    fn emit_instruction(&mut self, pc: usize) {
+        let insn = self.insns[pc];
+        self.builder.switch_to_block(self.blocks[pc]);
+        match insn.opcode {
+            opcode::CONSUME_CHAR..=opcode::CONSUME_HELPER => self.emit_consume(pc, insn),
+            opcode::JUMP => {
+                self.builder.ins().jump(self.blocks[insn.a as usize], &[]);
+            }
+            opcode::SPLIT => {
+                let target = self.builder.ins().iconst(types::I64, i64::from(insn.b));
+                let pos = self.builder.use_var(self.pos_var);
+                self.emit_push(target, pos);
+                self.builder.ins().jump(self.blocks[insn.a as usize], &[]);
+            }
+            opcode::SAVE | opcode::CLEAR_REGISTER | opcode::PROGRESS_CHECK => self.emit_register_write(pc, insn),
+            opcode::ASSERT_START => {
+                // pos == 0 || (multiline && is_line_terminator(input[pos - 1]))
+                let pos = self.builder.use_var(self.pos_var);
+                let at_start = self.builder.ins().icmp_imm(IntCC::Equal, pos, 0);
+                if insn.a == 0 {
+                    self.builder
+                        .ins()
+                        .brif(at_start, self.blocks[pc + 1], &[], self.backtrack_block, &[]);
+                    return;
+                }
+                let check_block = self.builder.create_block();
+                self.builder
+                    .ins()
+                    .brif(at_start, self.blocks[pc + 1], &[], check_block, &[]);
+                self.builder.switch_to_block(check_block);
+                let previous = self.builder.ins().iadd_imm(pos, -1);
+                let code_unit = self.load_code_unit(previous);
+                let is_terminator = self.is_line_terminator(code_unit);
+                self.builder
+                    .ins()
+                    .brif(is_terminator, self.blocks[pc + 1], &[], self.backtrack_block, &[]);
+            }
+            opcode::ASSERT_END => {
+                // pos >= len || (multiline && is_line_terminator(input[pos]))
+                let pos = self.builder.use_var(self.pos_var);
+                let at_end = self
+                    .builder
+                    .ins()
+                    .icmp(IntCC::UnsignedGreaterThanOrEqual, pos, self.input_length);
+                if insn.a == 0 {
+                    self.builder
+                        .ins()
+                        .brif(at_end, self.blocks[pc + 1], &[], self.backtrack_block, &[]);
+                    return;
+                }
+                let check_block = self.builder.create_block();
+                self.builder
+                    .ins()
+                    .brif(at_end, self.blocks[pc + 1], &[], check_block, &[]);
+                self.builder.switch_to_block(check_block);
+                let code_unit = self.load_code_unit(pos);
+                let is_terminator = self.is_line_terminator(code_unit);
+                self.builder
+                    .ins()
+                    .brif(is_terminator, self.blocks[pc + 1], &[], self.backtrack_block, &[]);
+            }
+            opcode::ASSERT_WORD_BOUNDARY => self.emit_word_boundary(pc, insn),
+            opcode::MATCH => {
+                let value = self.builder.ins().iconst(types::I32, result::MATCH);
+                self.builder.ins().jump(self.finish_block, &[value]);
+            }
+            opcode::FAIL => {
+                self.builder.ins().jump(self.backtrack_block, &[]);
+            }
+            _ => unreachable!(),
+        }
+    }
+
+    /// Consume one code unit if it is accepted, otherwise backtrack.
+    fn emit_consume(&mut self, pc: usize, insn: NativeInsn) {
+        let pos = self.builder.use_var(self.pos_var);
+        let at_end = self
+            .builder
+            .ins()
+            .icmp(IntCC::UnsignedGreaterThanOrEqual, pos, self.input_length);
+        let check_block = self.builder.create_block();
+        self.builder
+            .ins()
+            .brif(at_end, self.backtrack_block, &[], check_block, &[]);
+
+        self.builder.switch_to_block(check_block);
+        let code_unit = self.load_code_unit(pos);
+        let accepted = match insn.opcode {
+            opcode::CONSUME_CHAR => {
+                if self.code_unit_size == 1 && insn.a > 0xFF {
+                    self.builder.ins().iconst(types::I8, 0)
+                } else {
+                    self.builder.ins().icmp_imm(IntCC::Equal, code_unit, i64::from(insn.a))
+                }
+            }
+            opcode::CONSUME_CHAR_PAIR => {
+                let first = self.builder.ins().icmp_imm(IntCC::Equal, code_unit, i64::from(insn.a));
+                let second = self.builder.ins().icmp_imm(IntCC::Equal, code_unit, i64::from(insn.b));
+                self.builder.ins().bor(first, second)
+            }
+            opcode::CONSUME_ANY => {
+                if insn.a != 0 {
+                    self.builder.ins().iconst(types::I8, 1)
+                } else {
+                    let is_terminator = self.is_line_terminator(code_unit);
+                    self.negate(is_terminator)
+                }
+            }
+            opcode::CONSUME_CLASS => {
+                let ranges = self.ranges;
+                let ranges = &ranges[insn.a as usize..(insn.a + insn.b) as usize];
+                let mut in_class = self.builder.ins().iconst(types::I8, 0);
+                for [start, end] in ranges.iter().copied() {
+                    let in_range = self.in_range(code_unit, start, end);
+                    in_class = self.builder.ins().bor(in_class, in_range);
+                }
+                self.negate_if(in_class, insn.c != 0)
+            }
+            opcode::CONSUME_DIGIT => {
+                let is_digit = self.in_range(code_unit, '0' as u32, '9' as u32);
+                self.negate_if(is_digit, insn.c != 0)
+            }
+            opcode::CONSUME_WORD => {
+                let is_word = self.is_word_character(code_unit);
+                self.negate_if(is_word, insn.c != 0)
+            }
+            opcode::CONSUME_HELPER => {
+                let callee = self.builder.ins().iconst(types::I64, self.accepts_address);
+                let pc_val = self.builder.ins().iconst(types::I32, i64::from(insn.a));
+                let call = self
+                    .builder
+                    .ins()
+                    .call_indirect(self.accepts_sig, callee, &[self.nfa, pc_val, code_unit]);
+                let accepted = self.builder.inst_results(call)[0];
+                self.builder.ins().icmp_imm(IntCC::NotEqual, accepted, 0)
+            }
+            _ => unreachable!(),
+        };
+
+        let advance_block = self.builder.create_block();
+        self.builder
+            .ins()
+            .brif(accepted, advance_block, &[], self.backtrack_block, &[]);
+
+        self.builder.switch_to_block(advance_block);
+        let next_pos = self.builder.ins().iadd_imm(pos, 1);
+        self.builder.def_var(self.pos_var, next_pos);
+        self.builder.ins().jump(self.blocks[pc + 1], &[]);
+    }
+
+    /// Save, clear or progress-check a register, remembering the old value
+    /// so that backtracking can restore it.
+    fn emit_register_write(&mut self, pc: usize, insn: NativeInsn) {
+        let offset = (insn.a * 4) as i32;
+        let pos = self.builder.use_var(self.pos_var);
+        let pos32 = self.builder.ins().ireduce(types::I32, pos);
+        let old = self
+            .builder
+            .ins()
+            .load(types::I32, MemFlags::trusted(), self.registers, offset);
+
+        if insn.opcode == opcode::PROGRESS_CHECK {
+            // An iteration that consumed nothing must not loop again.
+            let no_progress = self.builder.ins().icmp(IntCC::Equal, old, pos32);
+            let continue_block = self.builder.create_block();
+            self.builder
+                .ins()
+                .brif(no_progress, self.backtrack_block, &[], continue_block, &[]);
+            self.builder.switch_to_block(continue_block);
+        }
+
+        let tag = self
+            .builder
+            .ins()
+            .iconst(types::I64, (RESTORE_REGISTER_TAG | u64::from(insn.a)) as i64);
+        let old64 = self.builder.ins().uextend(types::I64, old);
+        self.emit_push(tag, old64);
+
+        let new_value = if insn.opcode == opcode::CLEAR_REGISTER {
+            self.builder.ins().iconst(types::I32, -1)
+        } else {
+            pos32
+        };
+        self.builder
+            .ins()
+            .store(MemFlags::trusted(), new_value, self.registers, offset);
+        self.builder.ins().jump(self.blocks[pc + 1], &[]);
+    }
+
+    fn emit_word_boundary(&mut self, pc: usize, insn: NativeInsn) {
+        let pos = self.builder.use_var(self.pos_var);
+
+        // before = pos > 0 && is_word_character(input[pos - 1])
+        let before_block = self.builder.create_block();
+        let before = self.builder.append_block_param(before_block, types::I8);
+        let load_before_block = self.builder.create_block();
+        let no = self.builder.ins().iconst(types::I8, 0);
+        let at_start = self.builder.ins().icmp_imm(IntCC::Equal, pos, 0);
+        self.builder
+            .ins()
+            .brif(at_start, before_block, &[no], load_before_block, &[]);
+
+        self.builder.switch_to_block(load_before_block);
+        let previous = self.builder.ins().iadd_imm(pos, -1);
+        let code_unit = self.load_code_unit(previous);
+        let is_word = self.is_word_character(code_unit);
+        self.builder.ins().jump(before_block, &[is_word]);
+
+        // after = pos < len && is_word_character(input[pos])
+        self.builder.switch_to_block(before_block);
+        let after_block = self.builder.create_block();
+        let after = self.builder.append_block_param(after_block, types::I8);
+        let load_after_block = self.builder.create_block();
+        let no = self.builder.ins().iconst(types::I8, 0);
+        let at_end = self
+            .builder
+            .ins()
+            .icmp(IntCC::UnsignedGreaterThanOrEqual, pos, self.input_length);
+        self.builder
+            .ins()
+            .brif(at_end, after_block, &[no], load_after_block, &[]);
+
+        self.builder.switch_to_block(load_after_block);
+        let code_unit = self.load_code_unit(pos);
+        let is_word = self.is_word_character(code_unit);
+        self.builder.ins().jump(after_block, &[is_word]);
+
+        self.builder.switch_to_block(after_block);
+        let at_boundary = self.builder.ins().icmp(IntCC::NotEqual, before, after);
+        let holds = self.negate_if(at_boundary, insn.c != 0);
+        self.builder
+            .ins()
+            .brif(holds, self.blocks[pc + 1], &[], self.backtrack_block, &[]);
+    }
+
+    /// Push a two-word entry onto the backtrack stack, leaving the builder in
+    /// a block where the push has happened.
+    fn emit_push(&mut self, first: Value, second: Value) {
+        let sp = self.builder.use_var(self.sp_var);
+        let new_sp = self.builder.ins().iadd_imm(sp, 2);
+        let full = self
+            .builder
+            .ins()
+            .icmp(IntCC::UnsignedGreaterThan, new_sp, self.backtrack_stack_words);
+        let push_block = self.builder.create_block();
+        self.builder
+            .ins()
+            .brif(full, self.stack_exhausted_block, &[], push_block, &[]);
+
+        self.builder.switch_to_block(push_block);
+        let byte_offset = self.builder.ins().ishl_imm(sp, 3);
+        let address = self.builder.ins().iadd(self.backtrack_stack, byte_offset);
+        self.builder.ins().store(MemFlags::trusted(), first, address, 0);
+        self.builder.ins().store(MemFlags::trusted(), second, address, 8);
+        self.builder.def_var(self.sp_var, new_sp);
+    }
+
+    /// Pop entries, restoring registers, until one says where to resume.
+    fn emit_backtrack(&mut self) {
+        self.builder.switch_to_block(self.backtrack_block);
+        let sp = self.builder.use_var(self.sp_var);
+        let is_empty = self.builder.ins().icmp_imm(IntCC::Equal, sp, 0);
+        let no_match = self.builder.ins().iconst(types::I32, result::NO_MATCH);
+        let check_steps_block = self.builder.create_block();
+        self.builder
+            .ins()
+            .brif(is_empty, self.finish_block, &[no_match], check_steps_block, &[]);
+
+        self.builder.switch_to_block(check_steps_block);
+        let steps = self.builder.use_var(self.steps_var);
+        let out_of_steps = self.builder.ins().icmp_imm(IntCC::Equal, steps, 0);
+        let out_of_steps_value = self.builder.ins().iconst(types::I32, result::OUT_OF_STEPS);
+        let pop_block = self.builder.create_block();
+        self.builder
+            .ins()
+            .brif(out_of_steps, self.finish_block, &[out_of_steps_value], pop_block, &[]);
+
+        self.builder.switch_to_block(pop_block);
+        let remaining_steps = self.builder.ins().iadd_imm(steps, -1);
+        self.builder.def_var(self.steps_var, remaining_steps);
+        let new_sp = self.builder.ins().iadd_imm(sp, -2);
+        self.builder.def_var(self.sp_var, new_sp);
+        let byte_offset = self.builder.ins().ishl_imm(new_sp, 3);
+        let address = self.builder.ins().iadd(self.backtrack_stack, byte_offset);
+        let first = self.builder.ins().load(types::I64, MemFlags::trusted(), address, 0);
+        let second = self.builder.ins().load(types::I64, MemFlags::trusted(), address, 8);
+        let restore_block = self.builder.create_block();
+        let resume_block = self.builder.create_block();
+        let is_restore = self.builder.ins().icmp_imm(IntCC::SignedLessThan, first, 0);
+        self.builder
+            .ins()
+            .brif(is_restore, restore_block, &[], resume_block, &[]);
+
+        self.builder.switch_to_block(restore_block);
+        let register = self.builder.ins().band_imm(first, !(RESTORE_REGISTER_TAG as i64));
+        let register_offset = self.builder.ins().ishl_imm(register, 2);
+        let register_address = self.builder.ins().iadd(self.registers, register_offset);
+        let old_value = self.builder.ins().ireduce(types::I32, second);
+        self.builder
+            .ins()
+            .store(MemFlags::trusted(), old_value, register_address, 0);
+        self.builder.ins().jump(self.backtrack_block, &[]);
+
+        self.builder.switch_to_block(resume_block);
+        self.builder.def_var(self.pos_var, second);
+        let mut targets: Vec<u32> = self
+            .insns
+            .iter()
+            .filter(|insn| insn.opcode == opcode::SPLIT)
+            .map(|insn| insn.b)
+            .collect();
+        targets.sort_unstable();
+        targets.dedup();
+        if targets.is_empty() {
+            // NB: Without splits nothing but register restores is ever pushed.
+            let no_match = self.builder.ins().iconst(types::I32, result::NO_MATCH);
+            self.builder.ins().jump(self.finish_block, &[no_match]);
+        } else {
+            self.emit_dispatch(first, &targets);
+        }
+    }
+
+    /// Branch to the block of `selector`, which is one of `targets`, with a
+    /// binary search.
+    fn emit_dispatch(&mut self, selector: Value, targets: &[u32]) {
+        if targets.len() == 1 {
+            self.builder.ins().jump(self.blocks[targets[0] as usize], &[]);
+            return;
+        }
+        let middle = targets.len() / 2;
+        let low_block = self.builder.create_block();
+        let high_block = self.builder.create_block();
+        let is_high =
+            self.builder
+                .ins()
+                .icmp_imm(IntCC::UnsignedGreaterThanOrEqual, selector, i64::from(targets[middle]));
+        self.builder.ins().brif(is_high, high_block, &[], low_block, &[]);
+
+        self.builder.switch_to_block(low_block);
+        self.emit_dispatch(selector, &targets[..middle]);
+        self.builder.switch_to_block(high_block);
+        self.emit_dispatch(selector, &targets[middle..]);
+    }
+
+    fn emit_exits(&mut self, context_val: Value) {
+        self.builder.switch_to_block(self.stack_exhausted_block);
+        let value = self.builder.ins().iconst(types::I32, result::STACK_EXHAUSTED);
+        self.builder.ins().jump(self.finish_block, &[value]);
+
+        // NB: The remaining steps are written back on every exit, as the caller
+        //     shares one budget between all start positions.
+        self.builder.switch_to_block(self.finish_block);
+        let value = self.builder.block_params(self.finish_block)[0];
+        let steps = self.builder.use_var(self.steps_var);
+        self.builder
+            .ins()
+            .store(MemFlags::trusted(), steps, context_val, context::STEPS_REMAINING);
+        self.builder.ins().return_(&[value]);
+    }
+
+    fn load_code_unit(&mut self, pos: Value) -> Value {
+        if self.code_unit_size == 1 {
+            let address = self.builder.ins().iadd(self.input, pos);
+            self.builder.ins().uload8(types::I32, MemFlags::trusted(), address, 0)
+        } else {
+            let byte_offset = self.builder.ins().ishl_imm(pos, 1);
+            let address = self.builder.ins().iadd(self.input, byte_offset);
+            self.builder.ins().uload16(types::I32, MemFlags::trusted(), address, 0)
+        }
+    }
+
+    /// `start <= code_unit <= end`, as a single unsigned comparison.
+    fn in_range(&mut self, code_unit: Value, start: u32, end: u32) -> Value {
+        if start == end {
+            return self.builder.ins().icmp_imm(IntCC::Equal, code_unit, i64::from(start));
+        }
+        let offset = self.builder.ins().iadd_imm(code_unit, -i64::from(start));
+        self.builder
+            .ins()
+            .icmp_imm(IntCC::UnsignedLessThanOrEqual, offset, i64::from(end - start))
+    }
+
+    fn is_line_terminator(&mut self, code_unit: Value) -> Value {
+        let line_feed = self.builder.ins().icmp_imm(IntCC::Equal, code_unit, 0x0A);
+        let carriage_return = self.builder.ins().icmp_imm(IntCC::Equal, code_unit, 0x0D);
+        let result = self.builder.ins().bor(line_feed, carriage_return);
+        if self.code_unit_size == 1 {
+            return result;
+        }
+        let separator = self.in_range(code_unit, 0x2028, 0x2029);
+        self.builder.ins().bor(result, separator)
+    }
+
+    /// `[A-Za-z0-9_]`
+    fn is_word_character(&mut self, code_unit: Value) -> Value {
+        let is_digit = self.in_range(code_unit, '0' as u32, '9' as u32);
+        let lowercased = self.builder.ins().bor_imm(code_unit, 0x20);
+        let is_letter = self.in_range(lowercased, 'a' as u32, 'z' as u32);
+        let is_underscore = self.builder.ins().icmp_imm(IntCC::Equal, code_unit, '_' as i64);
+        let result = self.builder.ins().bor(is_digit, is_letter);
+        self.builder.ins().bor(result, is_underscore)
+    }
+
+    fn negate(&mut self, condition: Value) -> Value {
+        self.builder.ins().icmp_imm(IntCC::Equal, condition, 0)
+    }
+
+    fn negate_if(&mut self, condition: Value, negated: bool) -> Value {
+        if negated { self.negate(condition) } else { condition }
+    }
+}
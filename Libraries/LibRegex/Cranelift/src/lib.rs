@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+pub mod compiler;
+
+use compiler::RegexCompiler;
+
+/// Instruction set of the flattened NFA.
+/// Keep in sync with `Libraries/LibRegex/Rust/src/native.rs`.
+pub mod opcode {
+    pub const CONSUME_CHAR: u32 = 0;
+    pub const CONSUME_CHAR_PAIR: u32 = 1;
+    pub const CONSUME_ANY: u32 = 2;
+    pub const CONSUME_CLASS: u32 = 3;
+    pub const CONSUME_DIGIT: u32 = 4;
+    pub const CONSUME_WORD: u32 = 5;
+    pub const CONSUME_HELPER: u32 = 6;
+    pub const JUMP: u32 = 7;
+    pub const SPLIT: u32 = 8;
+    pub const SAVE: u32 = 9;
+    pub const CLEAR_REGISTER: u32 = 10;
+    pub const PROGRESS_CHECK: u32 = 11;
+    pub const ASSERT_START: u32 = 12;
+    pub const ASSERT_END: u32 = 13;
+    pub const ASSERT_WORD_BOUNDARY: u32 = 14;
+    pub const MATCH: u32 = 15;
+    pub const FAIL: u32 = 16;
+}
+
+/// Operands:
+///   consume char:       a = code point
+///   consume char pair:  a, b = code points
+///   consume any:        a = whether line terminators match
+///   consume class:      a = first range, b = range count, c = negated
+///   digit/word:         c = negated
+///   consume helper:     a = NFA instruction index, passed to `accepts`
+///   jump:               a = target
+///   split:              a = preferred target, b = backtrack target
+///   save/clear/check:   a = register
+///   assert start/end:   a = multiline
+///   word boundary:      c = negated
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct NativeInsn {
+    pub opcode: u32,
+    pub a: u32,
+    pub b: u32,
+    pub c: u32,
+}
+
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct RuntimeHelpers {
+    // u32 fn(nfa, pc, code_point)
+    pub accepts: usize,
+}
+
+/// Byte offsets into the `NativeMatchContext` the generated code is called with.
+pub mod context {
+    pub const INPUT: i32 = 0;
+    pub const INPUT_LENGTH: i32 = 8;
+    pub const START: i32 = 16;
+    pub const REGISTERS: i32 = 24;
+    pub const BACKTRACK_STACK: i32 = 32;
+    pub const BACKTRACK_STACK_WORDS: i32 = 40;
+    pub const STEPS_REMAINING: i32 = 48;
+    pub const NFA: i32 = 56;
+}
+
+/// Values returned by the generated code.
+pub mod result {
+    pub const MATCH: i64 = 1;
+    pub const NO_MATCH: i64 = 0;
+    pub const OUT_OF_STEPS: i64 = -1;
+    pub const STACK_EXHAUSTED: i64 = -2;
+}
+
+pub fn compile_to_bytes(
+    insns: &[NativeInsn],
+    ranges: &[[u32; 2]],
+    helpers: &RuntimeHelpers,
+    code_unit_size: u32,
+) -> Result<Vec<u8>, &'static str> {
+    RegexCompiler::compile_to_bytes(insns, ranges, helpers, code_unit_size)
+}
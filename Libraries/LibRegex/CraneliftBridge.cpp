@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/ScopeGuard.h>
+#include <LibCore/Process.h>
+#include <LibRegex/RustRegex.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#if defined(AK_OS_WINDOWS)
+#    include <AK/Windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#if defined(AK_OS_MACOS)
+#    include <libkern/OSCacheControl.h>
+#    include <pthread.h>
+#endif
+
+namespace regex {
+
+namespace {
+
+// Keep in sync with Libraries/LibRegex/Rust/src/native.rs.
+struct InputHeader {
+    u32 function_count;
+    u32 helpers_offset;
+    u32 range_offset;
+    u32 range_count;
+    u64 code_region_start;
+    u64 total_size;
+};
+
+struct InputFunctionEntry {
+    u32 insn_offset;
+    u32 insn_count;
+    u32 code_unit_size;
+    u32 padding;
+};
+
+struct OutputFunctionEntry {
+    u64 code_offset;
+    u32 code_size;
+    u32 compiled;
+};
+
+struct CodeMapping {
+    void* mapping;
+    size_t size;
+};
+
+}
+
+void* try_cranelift_compile(RustRegex* regex)
+{
+    size_t request_size = 0;
+    auto* request = rust_regex_take_native_compile_request(regex, &request_size);
+    if (!request)
+        return nullptr;
+    ScopeGuard free_request = [request, request_size] { rust_regex_free_native_compile_request(request, request_size); };
+
+    InputHeader request_header;
+    if (request_size < sizeof(request_header))
+        return nullptr;
+    __builtin_memcpy(&request_header, request, sizeof(request_header));
+
+    auto const function_count = static_cast<size_t>(request_header.function_count);
+    auto const code_region_start = static_cast<size_t>(request_header.code_region_start);
+    auto const total_size = static_cast<size_t>(request_header.total_size);
+    auto const code_base_offset = code_region_start + sizeof(OutputFunctionEntry) * function_count;
+    if (code_region_start != request_size || code_base_offset > total_size)
+        return nullptr;
+
+#if defined(AK_OS_WINDOWS)
+    DWORD size_hi = static_cast<DWORD>(static_cast<u64>(total_size) >> 32);
+    DWORD size_lo = static_cast<DWORD>(total_size & 0xFFFFFFFF);
+    HANDLE section_handle = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, size_hi, size_lo, NULL);
+    if (!section_handle)
+        return nullptr;
+    SetHandleInformation(section_handle, HANDLE_FLAG_INHERIT, HANDLE_FLAG_INHERIT);
+    ScopeGuard close_handle = [section_handle] { CloseHandle(section_handle); };
+
+    auto* mapping = MapViewOfFile(section_handle, FILE_MAP_ALL_ACCESS, 0, 0, total_size);
+    if (!mapping)
+        return nullptr;
+    ScopeGuard unmap = [mapping] { UnmapViewOfFile(mapping); };
+#elif defined(AK_OS_MACOS)
+    // macOS lacks memfd_create; use shm_open + shm_unlink for an anonymous fd.
+    char shm_name[] = "/libregex-cranelift-XXXXXX";
+    arc4random_buf(shm_name + 20, 6);
+    for (int i = 20; i < 26; ++i)
+        shm_name[i] = 'A' + (static_cast<unsigned char>(shm_name[i]) % 26);
+    int fd = shm_open(shm_name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0)
+        return nullptr;
+    shm_unlink(shm_name);
+    // POSIX shm_open sets FD_CLOEXEC on the returned fd, which would close it
+    // in the spawned regex-compiler child. Clear it so the child inherits.
+    if (auto flags = fcntl(fd, F_GETFD); flags >= 0)
+        fcntl(fd, F_SETFD, flags & ~FD_CLOEXEC);
+    ScopeGuard close_fd = [fd] { close(fd); };
+    if (ftruncate(fd, static_cast<off_t>(total_size)) < 0)
+        return nullptr;
+
+    auto* mapping = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED)
+        return nullptr;
+    ScopeGuard unmap = [mapping, total_size] { munmap(mapping, total_size); };
+#else
+    int fd = memfd_create("libregex-cranelift", 0);
+    if (fd < 0)
+        return nullptr;
+    ScopeGuard close_fd = [fd] { close(fd); };
+    if (ftruncate(fd, static_cast<off_t>(total_size)) < 0)
+        return nullptr;
+
+    auto* mapping = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED)
+        return nullptr;
+    ScopeGuard unmap = [mapping, total_size] { munmap(mapping, total_size); };
+#endif
+
+    auto* base = static_cast<u8*>(mapping);
+    __builtin_memcpy(base, request, request_size);
+    __builtin_memset(base + request_size, 0, total_size - request_size);
+
+    Vector<ByteString> arguments;
+#if defined(AK_OS_WINDOWS)
+    arguments.append(ByteString::number(reinterpret_cast<uintptr_t>(section_handle)));
+#else
+    arguments.append(ByteString::number(fd));
+#endif
+
+    auto process_result = Core::Process::spawn({
+        .name = "regex-compiler"sv,
+        .executable = REGEX_CRANELIFT_COMPILER_PATH,
+        .arguments = arguments,
+    });
+    if (process_result.is_error())
+        return nullptr;
+    // NB: This blocks the thread that is running the regex until the compiler exits. The
+    //     matchers are installed into state that is only safe to touch from that thread, and
+    //     the regex may not outlive an asynchronous compile, so we take the stall and rely on
+    //     HOT_EXECUTION_THRESHOLD in native.rs to keep it rare.
+    auto status_result = process_result.release_value().wait_for_termination();
+    if (status_result.is_error() || status_result.value() != 0)
+        return nullptr;
+
+    // All entries share one executable mapping that covers every compiled function.
+    size_t code_end = 0;
+    for (size_t i = 0; i < function_count; ++i) {
+        auto const* output = reinterpret_cast<OutputFunctionEntry const*>(base + code_region_start + i * sizeof(OutputFunctionEntry));
+        if (!output->compiled)
+            continue;
+        auto const end = static_cast<size_t>(output->code_offset) + output->code_size;
+        if (code_base_offset + end > total_size)
+            return nullptr;
+        code_end = max(code_end, end);
+    }
+    if (code_end == 0)
+        return nullptr;
+
+#if defined(AK_OS_WINDOWS)
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    auto const page_size = static_cast<size_t>(si.dwPageSize);
+    auto const rx_aligned_size = (code_end + page_size - 1) & ~(page_size - 1);
+    auto* jit_mem = VirtualAlloc(nullptr, rx_aligned_size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (!jit_mem)
+        return nullptr;
+    __builtin_memcpy(jit_mem, base + code_base_offset, code_end);
+    DWORD old_protect;
+    VirtualProtect(jit_mem, rx_aligned_size, PAGE_EXECUTE_READ, &old_protect);
+    FlushInstructionCache(GetCurrentProcess(), jit_mem, code_end);
+
+    auto* code_base = static_cast<u8 const*>(jit_mem);
+    auto* handle = new CodeMapping { jit_mem, rx_aligned_size };
+#elif defined(AK_OS_MACOS)
+    auto const page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto const rx_aligned_size = (code_end + page_size - 1) & ~(page_size - 1);
+    auto* jit_mapping = mmap(nullptr, rx_aligned_size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANON | MAP_JIT, -1, 0);
+    if (jit_mapping == MAP_FAILED)
+        return nullptr;
+
+    pthread_jit_write_protect_np(0);
+    __builtin_memcpy(jit_mapping, base + code_base_offset, code_end);
+    pthread_jit_write_protect_np(1);
+    sys_icache_invalidate(jit_mapping, code_end);
+
+    auto* code_base = static_cast<u8 const*>(jit_mapping);
+    auto* handle = new CodeMapping { jit_mapping, rx_aligned_size };
+#else
+    auto const page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto const page_aligned_offset = code_base_offset & ~(page_size - 1);
+    auto const offset_within_page = code_base_offset - page_aligned_offset;
+    auto const rx_aligned_size = (offset_within_page + code_end + page_size - 1) & ~(page_size - 1);
+
+    auto* rx_mapping = mmap(nullptr, rx_aligned_size, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, static_cast<off_t>(page_aligned_offset));
+    if (rx_mapping == MAP_FAILED)
+        return nullptr;
+
+    auto* code_base = static_cast<u8 const*>(rx_mapping) + offset_within_page;
+    auto* handle = new CodeMapping { rx_mapping, rx_aligned_size };
+#endif
+
+    for (size_t i = 0; i < function_count; ++i) {
+        auto const* input = reinterpret_cast<InputFunctionEntry const*>(base + sizeof(InputHeader) + i * sizeof(InputFunctionEntry));
+        auto const* output = reinterpret_cast<OutputFunctionEntry const*>(base + code_region_start + i * sizeof(OutputFunctionEntry));
+        if (!output->compiled)
+            continue;
+        rust_regex_install_native_matcher(regex, input->code_unit_size, code_base + output->code_offset);
+    }
+
+    return handle;
+}
+
+void free_cranelift_code(void* handle)
+{
+    if (handle) {
+        auto* mapping = static_cast<CodeMapping*>(handle);
+#if defined(AK_OS_WINDOWS)
+        VirtualFree(mapping->mapping, 0, MEM_RELEASE);
+#else
+        munmap(mapping->mapping, mapping->size);
+#endif
+        delete mapping;
+    }
+}
+
+size_t cranelift_code_size(void* handle)
+{
+    if (!handle)
+        return 0;
+    return static_cast<CodeMapping*>(handle)->size;
+}
+
+}
@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibRegex/RustRegex.h>
+
+namespace regex {
+
+void* try_cranelift_compile(RustRegex*) { return nullptr; }
+void free_cranelift_code(void*) { }
+size_t cranelift_code_size(void*) { return 0; }
+
+}
@@ -111,4 +111,13 @@ ECMAScriptRegex::MatchPair ECMAScriptRegex::find_all_match(int index) const
     return { pair.start, pair.end };
 }
 
+size_t ECMAScriptRegex::memory_footprint() const
+{
+    size_t footprint = sizeof(Impl) + m_impl->rust_regex.memory_footprint();
+    footprint += m_impl->named_groups.capacity() * sizeof(ECMAScriptNamedCaptureGroup);
+    for (auto const& group : m_impl->named_groups)
+        footprint += group.name.byte_count();
+    return footprint;
+}
+
 }
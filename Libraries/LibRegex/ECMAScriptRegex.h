@@ -83,6 +83,10 @@ public:
     /// Get the i-th match from find_all results.
     MatchPair find_all_match(int index) const;
 
+    /// Approximate number of bytes this regex occupies. This grows as the regex is used, since matching builds DFA
+    /// states, scratch space and native code lazily.
+    size_t memory_footprint() const;
+
 private:
     struct Impl;
     ECMAScriptRegex(OwnPtr<Impl>);
@@ -248,6 +248,18 @@ impl Program {
         }
     }
 
+    /// Approximate number of heap bytes owned by this program.
+    pub fn heap_size(&self) -> usize {
+        let mut size = self.instructions.capacity() * size_of::<Instruction>()
+            + self.named_groups.capacity() * size_of::<NamedGroupEntry>();
+        for instruction in &self.instructions {
+            if let Instruction::CharClass { ranges, .. } = instruction {
+                size += ranges.capacity() * size_of::<CharRange>();
+            }
+        }
+        size
+    }
+
     pub fn emit(&mut self, inst: Instruction) -> u32 {
         let idx = self.instructions.len() as u32;
         self.instructions.push(inst);
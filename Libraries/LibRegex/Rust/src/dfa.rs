@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Lazily built DFA over the lowered NFA.
+//!
+//! Each DFA state is the set of NFA instructions that are waiting to consume
+//! a character, together with what kind of character precedes the current
+//! position (which is all zero-width assertions need to know about the past).
+//! States and transitions are built on demand while scanning, so the cost of
+//! determinization is only paid for the parts of the automaton the input
+//! actually visits.
+//!
+//! The DFA only answers whether a match exists. It does not track match
+//! positions or priorities, so callers use the Pike VM to find the actual
+//! match.
+
+use crate::nfa::{Assertion, Nfa, NfaInstruction};
+use crate::vm::{Input, is_high_surrogate, is_line_terminator, is_low_surrogate, is_word_char_unicode};
+use std::collections::HashMap;
+
+/// Upper bound on the number of cached states. If a pattern needs more, the
+/// DFA gives up for good and the Pike VM is used instead.
+const MAX_DFA_STATES: usize = 4096;
+
+const UNKNOWN: u32 = u32::MAX;
+const MATCHED: u32 = u32::MAX - 1;
+
+/// What an assertion can observe about one side of a position.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+enum Context {
+    /// Start or end of input.
+    Edge,
+    LineTerminator,
+    Word,
+    Other,
+}
+
+#[derive(PartialEq, Eq, Hash)]
+struct StateKey {
+    waiting: Box<[u32]>,
+    previous: Context,
+}
+
+struct State {
+    key: StateKey,
+    ascii_transitions: [u32; 128],
+    transitions: HashMap<u32, u32>,
+    matches_at_end: Option<bool>,
+}
+
+pub struct LazyDfa {
+    states: Vec<State>,
+    state_ids: HashMap<StateKey, u32>,
+    gave_up: bool,
+    /// Per `(pc, progress mask)` stamp of the closure that visited it.
+    visited: Vec<u32>,
+    generation: u32,
+    stack: Vec<(u32, usize)>,
+    waiting: Vec<u32>,
+}
+
+impl LazyDfa {
+    /// Approximate number of heap bytes owned by this DFA, which grows as
+    /// states are discovered during searches.
+    pub fn heap_size(&self) -> usize {
+        let mut size = self.states.capacity() * size_of::<State>()
+            + self.state_ids.capacity() * (size_of::<(StateKey, u32)>() + 1)
+            + self.visited.capacity() * size_of::<u32>()
+            + self.stack.capacity() * size_of::<(u32, usize)>()
+            + self.waiting.capacity() * size_of::<u32>();
+        for state in &self.states {
+            // The key is shared between the state and its `state_ids` entry.
+            size += 2 * state.key.waiting.len() * size_of::<u32>();
+            size += state.transitions.capacity() * (size_of::<(u32, u32)>() + 1);
+        }
+        size
+    }
+
+    pub fn new(nfa: &Nfa) -> Self {
+        Self {
+            states: Vec::new(),
+            state_ids: HashMap::new(),
+            gave_up: false,
+            visited: vec![0; nfa.instructions.len() << nfa.progress_registers.len()],
+            generation: 0,
+            stack: Vec::new(),
+            waiting: Vec::new(),
+        }
+    }
+
+    /// Whether the pattern matches anywhere at or after `start_pos`, or `None`
+    /// if the DFA grew too large to answer.
+    ///
+    /// Only valid for patterns that cannot match the empty string, since those
+    /// never match between the halves of a surrogate pair.
+    pub fn is_match<I: Input>(&mut self, nfa: &Nfa, input: I, start_pos: usize) -> Option<bool> {
+        if self.gave_up {
+            return None;
+        }
+
+        let mut pos = start_pos;
+        if nfa.unicode
+            && pos > 0
+            && pos < input.len()
+            && is_low_surrogate(input.code_unit(pos))
+            && is_high_surrogate(input.code_unit(pos - 1))
+        {
+            pos += 1;
+        }
+
+        let previous = if pos == 0 {
+            Context::Edge
+        } else {
+            Self::context_of(nfa, input.code_unit(pos - 1) as u32)
+        };
+        let mut state = self.state_id(StateKey {
+            waiting: Box::new([]),
+            previous,
+        })?;
+
+        while let Some((cp, length)) = nfa.character_at(input, pos) {
+            let cached = if cp < 128 {
+                self.states[state as usize].ascii_transitions[cp as usize]
+            } else {
+                self.states[state as usize]
+                    .transitions
+                    .get(&cp)
+                    .copied()
+                    .unwrap_or(UNKNOWN)
+            };
+            let next = if cached == UNKNOWN {
+                let next = self.compute_transition(nfa, state, Some(cp))?;
+                let current = &mut self.states[state as usize];
+                if cp < 128 {
+                    current.ascii_transitions[cp as usize] = next;
+                } else {
+                    current.transitions.insert(cp, next);
+                }
+                next
+            } else {
+                cached
+            };
+            if next == MATCHED {
+                return Some(true);
+            }
+            state = next;
+            pos += length;
+        }
+
+        if let Some(matches) = self.states[state as usize].matches_at_end {
+            return Some(matches);
+        }
+        let matches = self.compute_transition(nfa, state, None)? == MATCHED;
+        self.states[state as usize].matches_at_end = Some(matches);
+        Some(matches)
+    }
+
+    fn context_of(nfa: &Nfa, code_unit: u32) -> Context {
+        if is_line_terminator(code_unit) {
+            Context::LineTerminator
+        } else if is_word_char_unicode(code_unit, nfa.ignore_case && nfa.unicode) {
+            Context::Word
+        } else {
+            Context::Other
+        }
+    }
+
+    fn state_id(&mut self, key: StateKey) -> Option<u32> {
+        if let Some(id) = self.state_ids.get(&key) {
+            return Some(*id);
+        }
+        if self.states.len() >= MAX_DFA_STATES {
+            self.gave_up = true;
+            self.states = Vec::new();
+            self.state_ids = HashMap::new();
+            return None;
+        }
+        let id = self.states.len() as u32;
+        self.state_ids.insert(
+            StateKey {
+                waiting: key.waiting.clone(),
+                previous: key.previous,
+            },
+            id,
+        );
+        self.states.push(State {
+            key,
+            ascii_transitions: [UNKNOWN; 128],
+            transitions: HashMap::new(),
+            matches_at_end: None,
+        });
+        Some(id)
+    }
+
+    /// Compute the state reached from `state` by consuming `next`, or by
+    /// reaching the end of input if `next` is `None`. A new match attempt is
+    /// started at every position, so the start instruction is always live.
+    fn compute_transition(&mut self, nfa: &Nfa, state: u32, next: Option<u32>) -> Option<u32> {
+        let previous = self.states[state as usize].key.previous;
+        let upcoming = match next {
+            None => Context::Edge,
+            Some(cp) if cp > 0xFFFF => Context::Other,
+            Some(cp) => Self::context_of(nfa, cp),
+        };
+
+        self.generation = self.generation.wrapping_add(1);
+        if self.generation == 0 {
+            self.visited.fill(0);
+            self.generation = 1;
+        }
+        self.waiting.clear();
+        self.stack.clear();
+        self.stack.push((0, 0));
+        for pc in self.states[state as usize].key.waiting.iter().rev() {
+            self.stack.push((*pc, 0));
+        }
+
+        let mask_bits = nfa.progress_registers.len();
+        while let Some((mut pc, mut mask)) = self.stack.pop() {
+            loop {
+                let slot = ((pc as usize) << mask_bits) | mask;
+                if self.visited[slot] == self.generation {
+                    break;
+                }
+                self.visited[slot] = self.generation;
+
+                match &nfa.instructions[pc as usize] {
+                    NfaInstruction::Consume(matcher) => {
+                        if let Some(cp) = next
+                            && nfa.accepts(matcher, cp)
+                        {
+                            self.waiting.push(pc + 1);
+                        }
+                        break;
+                    }
+                    NfaInstruction::Match => return Some(MATCHED),
+                    NfaInstruction::Jump(target) => pc = *target,
+                    NfaInstruction::Split { prefer, other } => {
+                        self.stack.push((*other, mask));
+                        pc = *prefer;
+                    }
+                    NfaInstruction::Save(reg) => {
+                        if let Some(bit) = Self::progress_bit(nfa, *reg) {
+                            mask |= bit;
+                        }
+                        pc += 1;
+                    }
+                    NfaInstruction::ClearRegister(reg) => {
+                        if let Some(bit) = Self::progress_bit(nfa, *reg) {
+                            mask &= !bit;
+                        }
+                        pc += 1;
+                    }
+                    NfaInstruction::ProgressCheck(reg) => {
+                        let bit = Self::progress_bit(nfa, *reg).unwrap_or(0);
+                        if mask & bit != 0 {
+                            break;
+                        }
+                        mask |= bit;
+                        pc += 1;
+                    }
+                    NfaInstruction::Assert(assertion) => {
+                        if !Self::assertion_holds(nfa, *assertion, previous, upcoming) {
+                            break;
+                        }
+                        pc += 1;
+                    }
+                    NfaInstruction::Fail => break,
+                }
+            }
+        }
+
+        // NB: At the end of input there is no next state, only the answer.
+        let Some(cp) = next else {
+            return Some(UNKNOWN);
+        };
+        self.waiting.sort_unstable();
+        self.waiting.dedup();
+        let previous = if cp > 0xFFFF {
+            Context::Other
+        } else {
+            Self::context_of(nfa, cp)
+        };
+        let waiting = self.waiting.as_slice().into();
+        self.state_id(StateKey { waiting, previous })
+    }
+
+    #[inline(always)]
+    fn progress_bit(nfa: &Nfa, reg: u32) -> Option<usize> {
+        nfa.progress_registers
+            .iter()
+            .position(|r| *r == reg)
+            .map(|bit| 1 << bit)
+    }
+
+    fn assertion_holds(nfa: &Nfa, assertion: Assertion, previous: Context, upcoming: Context) -> bool {
+        match assertion {
+            Assertion::Start { multiline } => {
+                previous == Context::Edge || ((multiline || nfa.multiline) && previous == Context::LineTerminator)
+            }
+            Assertion::End { multiline } => {
+                upcoming == Context::Edge || ((multiline || nfa.multiline) && upcoming == Context::LineTerminator)
+            }
+            Assertion::WordBoundary => (previous == Context::Word) != (upcoming == Context::Word),
+            Assertion::NonWordBoundary => (previous == Context::Word) == (upcoming == Context::Word),
+        }
+    }
+}
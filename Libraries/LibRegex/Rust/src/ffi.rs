@@ -254,6 +254,20 @@ pub unsafe extern "C" fn rust_regex_capture_count(regex: *const RustRegex) -> u3
     regex.0.capture_count()
 }
 
+/// Get the approximate number of bytes the regex occupies, including scratch
+/// space and lazily built engines. This grows as the regex is used.
+///
+/// # Safety
+/// `regex` must be a valid pointer from `rust_regex_compile`.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_regex_heap_size(regex: *const RustRegex) -> usize {
+    if regex.is_null() {
+        return 0;
+    }
+    let regex = unsafe { &*regex };
+    regex.0.heap_size()
+}
+
 /// Return whether this regex is a whole-pattern literal for a single non-BMP
 /// code point in unicode mode.
 ///
@@ -389,3 +403,59 @@ pub unsafe extern "C" fn rust_regex_free_named_groups(groups: *mut RustRegexName
         drop(unsafe { Box::from_raw(std::ptr::slice_from_raw_parts_mut(groups, len)) });
     }
 }
+
+/// Return the native compile request for a regex that just became hot, or null.
+/// Only the first call after the regex becomes hot returns a request. The
+/// caller must free it with `rust_regex_free_native_compile_request`.
+///
+/// # Safety
+/// - `regex` must be a valid pointer from `rust_regex_compile`.
+/// - `out_size` must be a valid pointer.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_regex_take_native_compile_request(
+    regex: *const RustRegex,
+    out_size: *mut usize,
+) -> *mut u8 {
+    if regex.is_null() || out_size.is_null() {
+        return std::ptr::null_mut();
+    }
+    let regex = unsafe { &*regex };
+    let Some(request) = regex.0.take_native_compile_request() else {
+        return std::ptr::null_mut();
+    };
+    let boxed = request.into_boxed_slice();
+    unsafe { *out_size = boxed.len() };
+    Box::into_raw(boxed) as *mut u8
+}
+
+/// Free a request returned by `rust_regex_take_native_compile_request`.
+///
+/// # Safety
+/// `request` must be a pointer returned by `rust_regex_take_native_compile_request`
+/// together with its size, or null.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_regex_free_native_compile_request(request: *mut u8, size: usize) {
+    if !request.is_null() {
+        drop(unsafe { Box::from_raw(std::ptr::slice_from_raw_parts_mut(request, size)) });
+    }
+}
+
+/// Install a native matcher compiled from a request for this regex.
+///
+/// # Safety
+/// - `regex` must be a valid pointer from `rust_regex_compile`.
+/// - `entry` must point to executable code compiled for `code_unit_size` byte
+///   input, which must outlive the regex.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_regex_install_native_matcher(
+    regex: *const RustRegex,
+    code_unit_size: u32,
+    entry: *const std::ffi::c_void,
+) {
+    if regex.is_null() || entry.is_null() {
+        return;
+    }
+    let regex = unsafe { &*regex };
+    let entry = unsafe { std::mem::transmute::<*const std::ffi::c_void, crate::native::NativeEntry>(entry) };
+    unsafe { regex.0.install_native_matcher(code_unit_size, entry) };
+}
@@ -10,7 +10,12 @@ mod rust_allocator;
 pub mod ast;
 pub mod bytecode;
 pub mod compiler;
+pub mod dfa;
 pub mod ffi;
+pub mod native;
+pub mod nfa;
 pub mod parser;
+pub mod pikevm;
+pub mod prefilter;
 pub mod regex;
 pub mod vm;
@@ -0,0 +1,492 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Native matchers for hot programs.
+//!
+//! Programs that run often are handed to the out-of-process Cranelift compiler
+//! (`Libraries/LibRegex/Cranelift`), which turns the lowered NFA into a native
+//! backtracking matcher. The matcher explores the NFA in the same priority
+//! order as the backtracking VM, so it finds the same match and captures. If
+//! it runs out of steps, the search is handed to the linear-time engines just
+//! like an over-budget VM search.
+//!
+//! Programs that cannot be lowered to an NFA (backreferences, lookaround,
+//! modifiers) never get native code. In Unicode mode only one-byte input is
+//! matched natively, since two-byte input would need surrogate pair decoding.
+
+use crate::bytecode::{BuiltinCharacterClass, Program, SimpleMatch};
+use crate::nfa::{Assertion, Nfa, NfaInstruction};
+use crate::vm::{Input, PatternHints, next_candidate_start};
+use std::cell::{Cell, RefCell};
+use std::mem::{align_of, size_of};
+
+/// Number of VM searches after which a program is compiled to native code.
+/// The embedder compiles synchronously, stalling the search that tipped the
+/// program over for as long as the compiler process takes (typically a few
+/// milliseconds), so only programs that run often enough to amortize that
+/// are worth compiling.
+const HOT_EXECUTION_THRESHOLD: u32 = 10000;
+
+/// Programs larger than this take too long to compile to be worth it.
+const MAX_NATIVE_INSTRUCTIONS: usize = 4096;
+
+/// Character classes with more ranges than this are matched by calling back
+/// into `Nfa::accepts()`.
+const MAX_INLINE_RANGES: usize = 8;
+
+/// Backtrack stack size in words. Each entry takes two words.
+const INITIAL_BACKTRACK_STACK_WORDS: usize = 1024;
+const MAX_BACKTRACK_STACK_WORDS: usize = 1 << 22;
+
+/// Size of the region the compiler writes code into.
+const CODE_REGION_MIN_SIZE: usize = 64 * 1024;
+const CODE_BYTES_PER_INSTRUCTION: usize = 256;
+
+/// Instruction set understood by the Cranelift compiler.
+/// Keep in sync with `Libraries/LibRegex/Cranelift/src/lib.rs`.
+pub mod opcode {
+    /// Consume `a`.
+    pub const CONSUME_CHAR: u32 = 0;
+    /// Consume `a` or `b`.
+    pub const CONSUME_CHAR_PAIR: u32 = 1;
+    /// Consume anything, or anything but a line terminator if `a` is zero.
+    pub const CONSUME_ANY: u32 = 2;
+    /// Consume a character in ranges `a..a + b`, or outside them if `c` is set.
+    pub const CONSUME_CLASS: u32 = 3;
+    /// Consume `[0-9]`, or anything else if `c` is set.
+    pub const CONSUME_DIGIT: u32 = 4;
+    /// Consume `[A-Za-z0-9_]`, or anything else if `c` is set.
+    pub const CONSUME_WORD: u32 = 5;
+    /// Consume a character accepted by NFA instruction `a`, as decided by the `accepts` helper.
+    pub const CONSUME_HELPER: u32 = 6;
+    pub const JUMP: u32 = 7;
+    /// Continue at `a`, backtracking to `b`.
+    pub const SPLIT: u32 = 8;
+    pub const SAVE: u32 = 9;
+    pub const CLEAR_REGISTER: u32 = 10;
+    pub const PROGRESS_CHECK: u32 = 11;
+    /// Assert start of input, or of a line if `a` is set.
+    pub const ASSERT_START: u32 = 12;
+    /// Assert end of input, or of a line if `a` is set.
+    pub const ASSERT_END: u32 = 13;
+    /// Assert a word boundary, or its absence if `c` is set.
+    pub const ASSERT_WORD_BOUNDARY: u32 = 14;
+    pub const MATCH: u32 = 15;
+    pub const FAIL: u32 = 16;
+}
+
+/// Results returned by a native matcher.
+const NATIVE_MATCH: i32 = 1;
+const NATIVE_NO_MATCH: i32 = 0;
+const NATIVE_OUT_OF_STEPS: i32 = -1;
+const NATIVE_STACK_EXHAUSTED: i32 = -2;
+
+#[repr(C)]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct NativeInsn {
+    pub opcode: u32,
+    pub a: u32,
+    pub b: u32,
+    pub c: u32,
+}
+
+impl NativeInsn {
+    fn new(opcode: u32, a: u32, b: u32, c: u32) -> Self {
+        Self { opcode, a, b, c }
+    }
+}
+
+/// Layout of the compile request, shared with the compiler process and
+/// `CraneliftBridge.cpp`:
+///
+/// ```text
+/// InputHeader
+/// InputFunctionEntry[function_count]
+/// NativeInsn[...]
+/// [u32; 2][range_count]
+/// RuntimeHelpers
+/// OutputFunctionEntry[function_count]   <- code_region_start
+/// code...                               <- up to total_size
+/// ```
+#[repr(C)]
+#[derive(Clone, Copy)]
+struct InputHeader {
+    function_count: u32,
+    helpers_offset: u32,
+    range_offset: u32,
+    range_count: u32,
+    code_region_start: u64,
+    total_size: u64,
+}
+
+#[repr(C)]
+#[derive(Clone, Copy)]
+struct InputFunctionEntry {
+    insn_offset: u32,
+    insn_count: u32,
+    code_unit_size: u32,
+    _pad: u32,
+}
+
+#[repr(C)]
+#[derive(Clone, Copy)]
+struct RuntimeHelpers {
+    // u32 fn(nfa, pc, code_point)
+    accepts: usize,
+}
+
+/// Written by the compiler, only its size matters here.
+#[repr(C)]
+#[derive(Clone, Copy)]
+#[allow(dead_code)]
+struct OutputFunctionEntry {
+    code_offset: u64,
+    code_size: u32,
+    compiled: u32,
+}
+
+/// State shared between a native matcher and its caller. Every field is
+/// eight bytes wide, the compiler relies on these offsets.
+#[repr(C)]
+pub struct NativeMatchContext {
+    pub input: *const u8,
+    pub input_length: u64,
+    pub start: u64,
+    pub registers: *mut i32,
+    pub backtrack_stack: *mut u64,
+    pub backtrack_stack_words: u64,
+    pub steps_remaining: u64,
+    pub nfa: *const Nfa,
+}
+
+pub type NativeEntry = unsafe extern "C" fn(*mut NativeMatchContext) -> i32;
+
+/// Called by native code for characters it cannot classify inline.
+unsafe extern "C" fn native_accepts(nfa: *const Nfa, pc: u32, code_point: u32) -> u32 {
+    let nfa = unsafe { &*nfa };
+    match &nfa.instructions[pc as usize] {
+        NfaInstruction::Consume(matcher) => nfa.accepts(matcher, code_point) as u32,
+        _ => 0,
+    }
+}
+
+/// The flat program handed to the compiler.
+struct NativeProgram {
+    insns: Vec<NativeInsn>,
+    ranges: Vec<[u32; 2]>,
+}
+
+impl NativeProgram {
+    fn lower(nfa: &Nfa) -> Option<Self> {
+        if nfa.instructions.len() > MAX_NATIVE_INSTRUCTIONS {
+            return None;
+        }
+        let mut program = Self {
+            insns: Vec::with_capacity(nfa.instructions.len()),
+            ranges: Vec::new(),
+        };
+        for (pc, instruction) in nfa.instructions.iter().enumerate() {
+            let insn = match instruction {
+                NfaInstruction::Consume(matcher) => program.lower_consume(nfa, pc as u32, matcher),
+                NfaInstruction::Jump(target) => NativeInsn::new(opcode::JUMP, *target, 0, 0),
+                NfaInstruction::Split { prefer, other } => NativeInsn::new(opcode::SPLIT, *prefer, *other, 0),
+                NfaInstruction::Save(reg) => NativeInsn::new(opcode::SAVE, *reg, 0, 0),
+                NfaInstruction::ClearRegister(reg) => NativeInsn::new(opcode::CLEAR_REGISTER, *reg, 0, 0),
+                NfaInstruction::ProgressCheck(reg) => NativeInsn::new(opcode::PROGRESS_CHECK, *reg, 0, 0),
+                NfaInstruction::Assert(Assertion::Start { multiline }) => {
+                    NativeInsn::new(opcode::ASSERT_START, (*multiline || nfa.multiline) as u32, 0, 0)
+                }
+                NfaInstruction::Assert(Assertion::End { multiline }) => {
+                    NativeInsn::new(opcode::ASSERT_END, (*multiline || nfa.multiline) as u32, 0, 0)
+                }
+                // NB: Only non-Unicode programs see two-byte input natively, and no one-byte
+                //     character case folds into an ASCII word character, so the Unicode
+                //     ignore-case word characters need no special handling here.
+                NfaInstruction::Assert(Assertion::WordBoundary) => {
+                    NativeInsn::new(opcode::ASSERT_WORD_BOUNDARY, 0, 0, 0)
+                }
+                NfaInstruction::Assert(Assertion::NonWordBoundary) => {
+                    NativeInsn::new(opcode::ASSERT_WORD_BOUNDARY, 0, 0, 1)
+                }
+                NfaInstruction::Match => NativeInsn::new(opcode::MATCH, 0, 0, 0),
+                NfaInstruction::Fail => NativeInsn::new(opcode::FAIL, 0, 0, 0),
+            };
+            program.insns.push(insn);
+        }
+        Some(program)
+    }
+
+    fn lower_consume(&mut self, nfa: &Nfa, pc: u32, matcher: &SimpleMatch) -> NativeInsn {
+        match matcher {
+            SimpleMatch::AnyChar { dot_all } => {
+                NativeInsn::new(opcode::CONSUME_ANY, (*dot_all || nfa.dot_all) as u32, 0, 0)
+            }
+            SimpleMatch::Char(c) if !nfa.ignore_case => NativeInsn::new(opcode::CONSUME_CHAR, *c, 0, 0),
+            // NB: Canonicalize never maps a non-ASCII character to an ASCII one that
+            //     native code can see: legacy mode forbids it, and the exceptions in
+            //     Unicode mode (U+017F, U+212A) are outside of one-byte input.
+            SimpleMatch::Char(c) | SimpleMatch::CharNoCase(c, _) if *c < 0x80 => {
+                let lower = (*c as u8).to_ascii_lowercase() as u32;
+                let upper = (*c as u8).to_ascii_uppercase() as u32;
+                NativeInsn::new(opcode::CONSUME_CHAR_PAIR, lower, upper, 0)
+            }
+            SimpleMatch::CharClass { ranges, negated } if !nfa.ignore_case && ranges.len() <= MAX_INLINE_RANGES => {
+                let first = self.ranges.len() as u32;
+                self.ranges.extend(ranges.iter().map(|range| [range.start, range.end]));
+                NativeInsn::new(opcode::CONSUME_CLASS, first, ranges.len() as u32, *negated as u32)
+            }
+            SimpleMatch::BuiltinClass(BuiltinCharacterClass::Digit) => NativeInsn::new(opcode::CONSUME_DIGIT, 0, 0, 0),
+            SimpleMatch::BuiltinClass(BuiltinCharacterClass::NonDigit) => {
+                NativeInsn::new(opcode::CONSUME_DIGIT, 0, 0, 1)
+            }
+            SimpleMatch::BuiltinClass(BuiltinCharacterClass::Word) => NativeInsn::new(opcode::CONSUME_WORD, 0, 0, 0),
+            SimpleMatch::BuiltinClass(BuiltinCharacterClass::NonWord) => NativeInsn::new(opcode::CONSUME_WORD, 0, 0, 1),
+            _ => NativeInsn::new(opcode::CONSUME_HELPER, pc, 0, 0),
+        }
+    }
+
+    /// Serialize a compile request for the given code unit sizes.
+    fn encode(&self, code_unit_sizes: &[u32]) -> Vec<u8> {
+        let function_count = code_unit_sizes.len();
+        let entries_offset = size_of::<InputHeader>();
+        let insn_offset = align_up(
+            entries_offset + function_count * size_of::<InputFunctionEntry>(),
+            align_of::<NativeInsn>(),
+        );
+        let range_offset = insn_offset + self.insns.len() * size_of::<NativeInsn>();
+        let helpers_offset = align_up(
+            range_offset + self.ranges.len() * size_of::<[u32; 2]>(),
+            align_of::<RuntimeHelpers>(),
+        );
+        let code_region_start = align_up(
+            helpers_offset + size_of::<RuntimeHelpers>(),
+            align_of::<OutputFunctionEntry>(),
+        );
+        let code_region_size = CODE_REGION_MIN_SIZE.max(self.insns.len() * function_count * CODE_BYTES_PER_INSTRUCTION);
+        let total_size = code_region_start + function_count * size_of::<OutputFunctionEntry>() + code_region_size;
+
+        let mut buffer = vec![0u8; code_region_start];
+        write_pod(
+            &mut buffer,
+            0,
+            &InputHeader {
+                function_count: function_count as u32,
+                helpers_offset: helpers_offset as u32,
+                range_offset: range_offset as u32,
+                range_count: self.ranges.len() as u32,
+                code_region_start: code_region_start as u64,
+                total_size: total_size as u64,
+            },
+        );
+        for (index, code_unit_size) in code_unit_sizes.iter().enumerate() {
+            write_pod(
+                &mut buffer,
+                entries_offset + index * size_of::<InputFunctionEntry>(),
+                &InputFunctionEntry {
+                    insn_offset: insn_offset as u32,
+                    insn_count: self.insns.len() as u32,
+                    code_unit_size: *code_unit_size,
+                    _pad: 0,
+                },
+            );
+        }
+        for (index, insn) in self.insns.iter().enumerate() {
+            write_pod(&mut buffer, insn_offset + index * size_of::<NativeInsn>(), insn);
+        }
+        for (index, range) in self.ranges.iter().enumerate() {
+            write_pod(&mut buffer, range_offset + index * size_of::<[u32; 2]>(), range);
+        }
+        write_pod(
+            &mut buffer,
+            helpers_offset,
+            &RuntimeHelpers {
+                accepts: native_accepts as usize,
+            },
+        );
+        buffer
+    }
+}
+
+fn align_up(value: usize, alignment: usize) -> usize {
+    value.div_ceil(alignment) * alignment
+}
+
+fn write_pod<T: Copy>(buffer: &mut [u8], offset: usize, value: &T) {
+    let bytes = unsafe { std::slice::from_raw_parts((value as *const T).cast::<u8>(), size_of::<T>()) };
+    buffer[offset..offset + size_of::<T>()].copy_from_slice(bytes);
+}
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+enum NativeStatus {
+    /// Still counting executions.
+    Cold,
+    /// Ready to be compiled, waiting for the embedder to pick it up.
+    Hot,
+    /// Handed to the compiler; native code may or may not have been installed.
+    Requested,
+}
+
+pub(crate) enum NativeOutcome {
+    /// No native matcher for this input.
+    Unavailable,
+    Match,
+    NoMatch,
+    /// The matcher ran out of steps or stack; the caller should switch to a
+    /// linear-time engine.
+    GaveUp,
+}
+
+/// Execution counter and installed native code for one program.
+pub(crate) struct NativeState {
+    status: Cell<NativeStatus>,
+    executions_until_hot: Cell<u32>,
+    entry_u8: Cell<Option<NativeEntry>>,
+    entry_u16: Cell<Option<NativeEntry>>,
+    /// Reusable storage for native matchers, grown on demand.
+    registers: RefCell<Vec<i32>>,
+    backtrack_stack: RefCell<Vec<u64>>,
+}
+
+impl NativeState {
+    pub(crate) fn new() -> Self {
+        Self {
+            status: Cell::new(NativeStatus::Cold),
+            executions_until_hot: Cell::new(HOT_EXECUTION_THRESHOLD),
+            entry_u8: Cell::new(None),
+            entry_u16: Cell::new(None),
+            registers: RefCell::new(Vec::new()),
+            backtrack_stack: RefCell::new(Vec::new()),
+        }
+    }
+
+    /// Approximate number of heap bytes held on to for native matchers. The
+    /// executable code itself is owned by the embedder.
+    pub(crate) fn heap_size(&self) -> usize {
+        let registers = self.registers.try_borrow().map_or(0, |registers| registers.capacity());
+        let backtrack_stack = self.backtrack_stack.try_borrow().map_or(0, |stack| stack.capacity());
+        registers * size_of::<i32>() + backtrack_stack * size_of::<u64>()
+    }
+
+    /// Count a search that ran on the VM.
+    #[inline(always)]
+    pub(crate) fn record_execution(&self) {
+        if self.status.get() != NativeStatus::Cold {
+            return;
+        }
+        let remaining = self.executions_until_hot.get() - 1;
+        self.executions_until_hot.set(remaining);
+        if remaining == 0 {
+            self.status.set(NativeStatus::Hot);
+        }
+    }
+
+    /// Build the compile request for a program that just became hot. Returns
+    /// `None` if the program is not hot, was already requested, or cannot be
+    /// compiled.
+    pub(crate) fn take_compile_request(&self, nfa: &Nfa) -> Option<Vec<u8>> {
+        if self.status.get() != NativeStatus::Hot {
+            return None;
+        }
+        self.status.set(NativeStatus::Requested);
+        let program = NativeProgram::lower(nfa)?;
+        let code_unit_sizes: &[u32] = if nfa.unicode { &[1] } else { &[1, 2] };
+        Some(program.encode(code_unit_sizes))
+    }
+
+    /// Install the native matcher compiled for `code_unit_size` byte input.
+    pub(crate) fn install(&self, code_unit_size: u32, entry: NativeEntry) {
+        match code_unit_size {
+            1 => self.entry_u8.set(Some(entry)),
+            2 => self.entry_u16.set(Some(entry)),
+            _ => {}
+        }
+    }
+
+    /// Find the leftmost match at or after `start_pos`, or only at `start_pos`
+    /// if `anchored` is set. On a match, the registers are available through
+    /// `copy_registers()`.
+    #[allow(clippy::too_many_arguments)]
+    pub(crate) fn execute<I: Input>(
+        &self,
+        nfa: &Nfa,
+        program: &Program,
+        hints: &PatternHints,
+        input: I,
+        start_pos: usize,
+        anchored: bool,
+        step_budget: u64,
+    ) -> NativeOutcome {
+        let (data, code_unit_size) = input.raw_code_units();
+        let entry = match code_unit_size {
+            1 => self.entry_u8.get(),
+            _ => self.entry_u16.get(),
+        };
+        let Some(entry) = entry else {
+            return NativeOutcome::Unavailable;
+        };
+        if start_pos > input.len() {
+            return NativeOutcome::Unavailable;
+        }
+
+        let mut registers = self.registers.borrow_mut();
+        registers.resize(nfa.register_count as usize, -1);
+        let mut stack = self.backtrack_stack.borrow_mut();
+        if stack.is_empty() {
+            stack.resize(INITIAL_BACKTRACK_STACK_WORDS, 0);
+        }
+
+        let mut context = NativeMatchContext {
+            input: data,
+            input_length: input.len() as u64,
+            start: 0,
+            registers: registers.as_mut_ptr(),
+            backtrack_stack: stack.as_mut_ptr(),
+            backtrack_stack_words: stack.len() as u64,
+            steps_remaining: step_budget,
+            nfa,
+        };
+
+        let mut pos = start_pos;
+        loop {
+            if !anchored {
+                match next_candidate_start(program, input, hints, pos) {
+                    Some(candidate) => pos = candidate,
+                    None => return NativeOutcome::NoMatch,
+                }
+            }
+            registers.fill(-1);
+            context.start = pos as u64;
+            match unsafe { entry(&mut context) } {
+                NATIVE_MATCH => return NativeOutcome::Match,
+                NATIVE_NO_MATCH => {}
+                NATIVE_STACK_EXHAUSTED if stack.len() < MAX_BACKTRACK_STACK_WORDS => {
+                    // NB: Retry this position with a larger stack. The steps already
+                    //     taken still count against the budget.
+                    let new_len = stack.len() * 2;
+                    stack.resize(new_len, 0);
+                    context.backtrack_stack = stack.as_mut_ptr();
+                    context.backtrack_stack_words = stack.len() as u64;
+                    continue;
+                }
+                result => {
+                    debug_assert!(matches!(result, NATIVE_OUT_OF_STEPS | NATIVE_STACK_EXHAUSTED));
+                    return NativeOutcome::GaveUp;
+                }
+            }
+            if anchored || pos >= input.len() {
+                return NativeOutcome::NoMatch;
+            }
+            pos += 1;
+        }
+    }
+
+    /// Copy the registers of the last native match into `out`.
+    pub(crate) fn copy_registers(&self, capture_count: u32, out: &mut [i32]) {
+        let registers = self.registers.borrow();
+        let slots = ((capture_count as usize + 1) * 2).min(registers.len()).min(out.len());
+        out[..slots].copy_from_slice(&registers[..slots]);
+    }
+}
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Thompson NFA for the linear-time matching engines.
+//!
+//! The backtracking bytecode is lowered into a smaller instruction set in
+//! which every choice point is an explicit `Split` and every consuming
+//! instruction consumes exactly one character. This is only possible for
+//! programs whose future behavior depends on nothing but the current
+//! instruction and position, so patterns with backreferences, lookaround or
+//! modifier groups are rejected. Counted loops are unrolled.
+//!
+//! Spec:
+//! - <https://tc39.es/ecma262/#sec-pattern-semantics>
+
+use crate::bytecode::*;
+use crate::vm::{
+    Input, case_fold_eq, is_high_surrogate, is_line_terminator, is_low_surrogate, is_word_char_unicode,
+    match_builtin_class, match_char_class, match_unicode_property_all_case_equivalents,
+    match_unicode_property_case_insensitive, match_unicode_property_resolved,
+};
+
+/// Upper bound on the size of a lowered program. Beyond this, unrolling makes
+/// the per-position cost of the linear engines worse than backtracking.
+const MAX_NFA_INSTRUCTIONS: usize = 10_000;
+
+/// Upper bound on `instructions * registers`, which is the size of the capture
+/// storage each Pike VM thread list needs. Also bounds the size of the
+/// visited set, see `Nfa::progress_registers`.
+const MAX_NFA_THREAD_SLOTS: usize = 1 << 20;
+
+/// Upper bound on the number of distinct progress registers.
+const MAX_PROGRESS_REGISTERS: usize = 6;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Assertion {
+    Start { multiline: bool },
+    End { multiline: bool },
+    WordBoundary,
+    NonWordBoundary,
+}
+
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub enum NfaInstruction {
+    /// Consume one character if it is accepted by the matcher.
+    Consume(SimpleMatch),
+    Jump(u32),
+    /// Continue at both targets, `prefer` with higher priority.
+    Split {
+        prefer: u32,
+        other: u32,
+    },
+    Save(u32),
+    ClearRegister(u32),
+    /// Kill the thread if register `reg` already holds the current position,
+    /// otherwise store the current position in it.
+    ProgressCheck(u32),
+    Assert(Assertion),
+    Match,
+    Fail,
+}
+
+/// The lowered program together with the flags needed to interpret it.
+pub struct Nfa {
+    pub instructions: Vec<NfaInstruction>,
+    pub capture_count: u32,
+    pub register_count: u32,
+    /// Registers used by `ProgressCheck`. Two threads at the same instruction
+    /// and position only behave identically if they agree on which of these
+    /// registers hold the current position, so the linear engines track that
+    /// as part of their state.
+    pub progress_registers: Vec<u32>,
+    pub unicode: bool,
+    pub unicode_sets: bool,
+    pub ignore_case: bool,
+    pub multiline: bool,
+    pub dot_all: bool,
+}
+
+impl Nfa {
+    /// Approximate number of heap bytes owned by this NFA.
+    pub fn heap_size(&self) -> usize {
+        self.instructions.capacity() * size_of::<NfaInstruction>() + self.progress_registers.capacity() * size_of::<u32>()
+    }
+
+    /// Lower `program`, or return `None` if it uses features that need
+    /// backtracking or would unroll into an oversized program.
+    pub fn compile(program: &Program) -> Option<Self> {
+        let mut lowering = Lowering {
+            source: &program.instructions,
+            output: Vec::new(),
+        };
+        lowering.lower_range(0, program.instructions.len())?;
+        lowering.output.push(NfaInstruction::Fail);
+
+        let instructions = lowering.output;
+        let mut progress_registers = Vec::new();
+        for instruction in &instructions {
+            if let NfaInstruction::ProgressCheck(reg) = instruction
+                && !progress_registers.contains(reg)
+            {
+                progress_registers.push(*reg);
+            }
+        }
+        if progress_registers.len() > MAX_PROGRESS_REGISTERS
+            || instructions.len() > MAX_NFA_INSTRUCTIONS
+            || instructions.len() * program.register_count.max(1) as usize > MAX_NFA_THREAD_SLOTS
+            || instructions.len() << progress_registers.len() > MAX_NFA_THREAD_SLOTS
+        {
+            return None;
+        }
+
+        Some(Self {
+            instructions,
+            capture_count: program.capture_count,
+            register_count: program.register_count,
+            progress_registers,
+            unicode: program.unicode,
+            unicode_sets: program.unicode_sets,
+            ignore_case: program.ignore_case,
+            multiline: program.multiline,
+            dot_all: program.dot_all,
+        })
+    }
+
+    /// Decode the character at `pos`, returning it together with its length in
+    /// code units. This mirrors the backtracking VM: in Unicode mode, the low
+    /// half of a surrogate pair is not a character boundary.
+    #[inline(always)]
+    pub fn character_at<I: Input>(&self, input: I, pos: usize) -> Option<(u32, usize)> {
+        if pos >= input.len() {
+            return None;
+        }
+        let cu = input.code_unit(pos);
+        if !self.unicode {
+            return Some((cu as u32, 1));
+        }
+        if is_high_surrogate(cu) && pos + 1 < input.len() && is_low_surrogate(input.code_unit(pos + 1)) {
+            let lo = input.code_unit(pos + 1) as u32;
+            return Some((0x10000 + ((cu as u32 - 0xD800) << 10) + (lo - 0xDC00), 2));
+        }
+        if is_low_surrogate(cu) && pos > 0 && is_high_surrogate(input.code_unit(pos - 1)) {
+            return None;
+        }
+        Some((cu as u32, 1))
+    }
+
+    /// Whether `cp` is accepted by a consuming instruction, with the same
+    /// semantics as the corresponding backtracking VM instruction.
+    #[inline(always)]
+    pub fn accepts(&self, matcher: &SimpleMatch, cp: u32) -> bool {
+        match matcher {
+            SimpleMatch::AnyChar { dot_all } => *dot_all || self.dot_all || !is_line_terminator(cp),
+            SimpleMatch::Char(c) => {
+                if self.ignore_case {
+                    case_fold_eq(cp, *c, self.unicode)
+                } else {
+                    cp == *c
+                }
+            }
+            SimpleMatch::CharNoCase(lo, _hi) => case_fold_eq(cp, *lo, self.unicode),
+            SimpleMatch::CharClass { ranges, negated } => {
+                match_char_class(cp, ranges, self.ignore_case, self.unicode, self.unicode_sets) != *negated
+            }
+            SimpleMatch::BuiltinClass(class) => match_builtin_class(cp, *class, self.ignore_case && self.unicode),
+            SimpleMatch::UnicodeProperty(data) => {
+                if self.ignore_case && self.unicode {
+                    if data.negated && !self.unicode_sets {
+                        !match_unicode_property_all_case_equivalents(cp, &data.name, data.value.as_deref())
+                    } else {
+                        match_unicode_property_case_insensitive(cp, &data.name, data.value.as_deref()) != data.negated
+                    }
+                } else {
+                    match_unicode_property_resolved(cp, &data.name, data.value.as_deref(), data.resolved.as_ref())
+                        != data.negated
+                }
+            }
+            SimpleMatch::Union(lhs, rhs) => self.accepts(lhs, cp) || self.accepts(rhs, cp),
+        }
+    }
+
+    /// The bitmask of progress registers in `registers` that hold `pos`.
+    #[inline(always)]
+    pub fn progress_mask(&self, registers: &[i32], pos: usize) -> usize {
+        let mut mask = 0;
+        for (bit, reg) in self.progress_registers.iter().enumerate() {
+            if registers[*reg as usize] == pos as i32 {
+                mask |= 1 << bit;
+            }
+        }
+        mask
+    }
+
+    /// Evaluate a zero-width assertion at `pos`.
+    #[inline(always)]
+    pub fn assertion_holds<I: Input>(&self, assertion: Assertion, input: I, pos: usize) -> bool {
+        match assertion {
+            Assertion::Start { multiline } => {
+                pos == 0 || ((multiline || self.multiline) && is_line_terminator(input.code_unit(pos - 1) as u32))
+            }
+            Assertion::End { multiline } => {
+                pos >= input.len() || ((multiline || self.multiline) && is_line_terminator(input.code_unit(pos) as u32))
+            }
+            Assertion::WordBoundary | Assertion::NonWordBoundary => {
+                let unicode_ignore_case = self.ignore_case && self.unicode;
+                let before = pos > 0 && is_word_char_unicode(input.code_unit(pos - 1) as u32, unicode_ignore_case);
+                let after = pos < input.len() && is_word_char_unicode(input.code_unit(pos) as u32, unicode_ignore_case);
+                (before != after) == (assertion == Assertion::WordBoundary)
+            }
+        }
+    }
+}
+
+struct Lowering<'a> {
+    source: &'a [Instruction],
+    output: Vec<NfaInstruction>,
+}
+
+impl Lowering<'_> {
+    fn emit(&mut self, instruction: NfaInstruction) -> Option<u32> {
+        if self.output.len() >= MAX_NFA_INSTRUCTIONS {
+            return None;
+        }
+        self.output.push(instruction);
+        Some((self.output.len() - 1) as u32)
+    }
+
+    fn current_offset(&self) -> u32 {
+        self.output.len() as u32
+    }
+
+    /// Lower `source[start..end]`, appending to the output. Jumps may only
+    /// target instructions inside the range, or `end`, which continues after
+    /// the lowered code. This lets loop bodies be lowered more than once.
+    fn lower_range(&mut self, start: usize, end: usize) -> Option<()> {
+        let mut new_offsets = vec![u32::MAX; end - start];
+        let mut jumps_to_patch = Vec::new();
+
+        let mut pc = start;
+        while pc < end {
+            new_offsets[pc - start] = self.current_offset();
+            match &self.source[pc] {
+                Instruction::Char(c) => {
+                    self.emit(NfaInstruction::Consume(SimpleMatch::Char(*c)))?;
+                }
+                Instruction::CharNoCase(lo, hi) => {
+                    self.emit(NfaInstruction::Consume(SimpleMatch::CharNoCase(*lo, *hi)))?;
+                }
+                Instruction::AnyChar { dot_all } => {
+                    self.emit(NfaInstruction::Consume(SimpleMatch::AnyChar { dot_all: *dot_all }))?;
+                }
+                Instruction::CharClass { ranges, negated } => {
+                    self.emit(NfaInstruction::Consume(SimpleMatch::CharClass {
+                        ranges: ranges.clone(),
+                        negated: *negated,
+                    }))?;
+                }
+                Instruction::BuiltinClass(class) => {
+                    self.emit(NfaInstruction::Consume(SimpleMatch::BuiltinClass(*class)))?;
+                }
+                Instruction::UnicodeProperty(data) => {
+                    self.emit(NfaInstruction::Consume(SimpleMatch::UnicodeProperty(data.clone())))?;
+                }
+                Instruction::Jump(target) => {
+                    let at = self.emit(NfaInstruction::Jump(u32::MAX))?;
+                    jumps_to_patch.push((at, *target as usize));
+                }
+                Instruction::Split { prefer, other } => {
+                    let at = self.emit(NfaInstruction::Split {
+                        prefer: u32::MAX,
+                        other: u32::MAX,
+                    })?;
+                    jumps_to_patch.push((at, *prefer as usize));
+                    jumps_to_patch.push((at, *other as usize));
+                }
+                Instruction::Save(reg) => {
+                    self.emit(NfaInstruction::Save(*reg))?;
+                }
+                Instruction::ClearRegister(reg) => {
+                    self.emit(NfaInstruction::ClearRegister(*reg))?;
+                }
+                Instruction::ProgressCheck { reg, .. } => {
+                    // NB: The captures listed in `clear_captures` are only cleared on the
+                    //     failing path, which kills the thread here.
+                    self.emit(NfaInstruction::ProgressCheck(*reg))?;
+                }
+                Instruction::AssertStart { multiline } => {
+                    self.emit(NfaInstruction::Assert(Assertion::Start { multiline: *multiline }))?;
+                }
+                Instruction::AssertEnd { multiline } => {
+                    self.emit(NfaInstruction::Assert(Assertion::End { multiline: *multiline }))?;
+                }
+                Instruction::AssertWordBoundary => {
+                    self.emit(NfaInstruction::Assert(Assertion::WordBoundary))?;
+                }
+                Instruction::AssertNonWordBoundary => {
+                    self.emit(NfaInstruction::Assert(Assertion::NonWordBoundary))?;
+                }
+                Instruction::Match => {
+                    self.emit(NfaInstruction::Match)?;
+                }
+                Instruction::Fail => {
+                    self.emit(NfaInstruction::Fail)?;
+                }
+                Instruction::Nop => {}
+                Instruction::GreedyLoop { matcher, min, max } => {
+                    self.lower_simple_loop(matcher, *min, *max, true)?;
+                }
+                Instruction::LazyLoop { matcher, min, max } => {
+                    self.lower_simple_loop(matcher, *min, *max, false)?;
+                }
+                Instruction::RepeatStart { .. } => {
+                    pc = self.lower_counted_optional_repetitions(pc)?;
+                    continue;
+                }
+                Instruction::RepeatCheck { .. }
+                | Instruction::Backref(_)
+                | Instruction::BackrefNamed(_)
+                | Instruction::LookStart { .. }
+                | Instruction::LookEnd
+                | Instruction::PushModifiers { .. }
+                | Instruction::PopModifiers
+                | Instruction::StringPropertyMatch { .. } => return None,
+            }
+            pc += 1;
+        }
+
+        let continuation = self.current_offset();
+        for (at, target) in jumps_to_patch {
+            let new_target = if target == end {
+                continuation
+            } else if (start..end).contains(&target) && new_offsets[target - start] != u32::MAX {
+                new_offsets[target - start]
+            } else {
+                return None;
+            };
+            match &mut self.output[at as usize] {
+                NfaInstruction::Jump(t) => *t = new_target,
+                NfaInstruction::Split { prefer, .. } if *prefer == u32::MAX => *prefer = new_target,
+                NfaInstruction::Split { other, .. } => *other = new_target,
+                _ => unreachable!(),
+            }
+        }
+        Some(())
+    }
+
+    /// Lower `matcher{min,max}`, which always consumes exactly one character
+    /// per iteration and so needs no progress check.
+    fn lower_simple_loop(&mut self, matcher: &SimpleMatch, min: u32, max: Option<u32>, greedy: bool) -> Option<()> {
+        if min as usize > MAX_NFA_INSTRUCTIONS {
+            return None;
+        }
+        for _ in 0..min {
+            self.emit(NfaInstruction::Consume(matcher.clone()))?;
+        }
+
+        let Some(max) = max else {
+            let split = self.emit(NfaInstruction::Split {
+                prefer: u32::MAX,
+                other: u32::MAX,
+            })?;
+            self.emit(NfaInstruction::Consume(matcher.clone()))?;
+            self.emit(NfaInstruction::Jump(split))?;
+            let after = self.current_offset();
+            self.output[split as usize] = Self::loop_split(split + 1, after, greedy);
+            return Some(());
+        };
+
+        let optional_count = max.saturating_sub(min) as usize;
+        if optional_count > MAX_NFA_INSTRUCTIONS {
+            return None;
+        }
+        let mut splits = Vec::with_capacity(optional_count);
+        for _ in 0..optional_count {
+            splits.push(self.emit(NfaInstruction::Split {
+                prefer: u32::MAX,
+                other: u32::MAX,
+            })?);
+            self.emit(NfaInstruction::Consume(matcher.clone()))?;
+        }
+        let after = self.current_offset();
+        for split in splits {
+            self.output[split as usize] = Self::loop_split(split + 1, after, greedy);
+        }
+        Some(())
+    }
+
+    /// Unroll the loop emitted by `compile_counted_optional_repetitions`:
+    ///
+    /// ```text
+    /// pc:     RepeatStart
+    /// pc + 1: RepeatCheck { min: 0, max: Some(n), body: pc + 3 }
+    /// pc + 2: Jump(after)
+    /// pc + 3: <body>
+    ///         Jump(pc + 1)
+    /// after:
+    /// ```
+    ///
+    /// Returns the source offset to continue lowering at.
+    fn lower_counted_optional_repetitions(&mut self, pc: usize) -> Option<usize> {
+        let Some(Instruction::RepeatCheck {
+            min: 0,
+            max: Some(count),
+            body,
+            greedy,
+            ..
+        }) = self.source.get(pc + 1)
+        else {
+            return None;
+        };
+        let Some(Instruction::Jump(after)) = self.source.get(pc + 2) else {
+            return None;
+        };
+        let (count, body, greedy, after) = (*count as usize, *body as usize, *greedy, *after as usize);
+        if body != pc + 3 || after <= body || self.source.get(after - 1) != Some(&Instruction::Jump(pc as u32 + 1)) {
+            return None;
+        }
+        if count > MAX_NFA_INSTRUCTIONS {
+            return None;
+        }
+
+        let mut splits = Vec::with_capacity(count);
+        for _ in 0..count {
+            splits.push(self.emit(NfaInstruction::Split {
+                prefer: u32::MAX,
+                other: u32::MAX,
+            })?);
+            self.lower_range(body, after - 1)?;
+        }
+        let exit = self.current_offset();
+        for split in splits {
+            self.output[split as usize] = Self::loop_split(split + 1, exit, greedy);
+        }
+        Some(after)
+    }
+
+    fn loop_split(body: u32, exit: u32, greedy: bool) -> NfaInstruction {
+        if greedy {
+            NfaInstruction::Split {
+                prefer: body,
+                other: exit,
+            }
+        } else {
+            NfaInstruction::Split {
+                prefer: exit,
+                other: body,
+            }
+        }
+    }
+}
@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Pike VM over the lowered NFA.
+//!
+//! All threads advance through the input in lockstep, so a search takes
+//! O(input length * NFA size) time no matter how much the backtracking VM
+//! would have to backtrack. Threads are kept in priority order, which is the
+//! order the backtracking VM would explore them in, so the leftmost match and
+//! its captures are exactly the ones the backtracking VM reports.
+
+use crate::bytecode::Program;
+use crate::nfa::{Nfa, NfaInstruction};
+use crate::vm::{Input, PatternHints, is_high_surrogate, is_low_surrogate, next_candidate_start};
+
+/// A list of threads at one input position, in priority order.
+struct ThreadList {
+    /// Instructions with a live thread, highest priority first. Only
+    /// `Consume` and `Match` instructions ever hold threads.
+    pcs: Vec<u32>,
+    /// Registers for each thread, indexed by `pc * register_count`.
+    registers: Vec<i32>,
+    /// Per `(pc, progress mask)` stamp of the generation that visited it.
+    visited: Vec<u32>,
+    generation: u32,
+}
+
+impl ThreadList {
+    fn heap_size(&self) -> usize {
+        self.pcs.capacity() * size_of::<u32>()
+            + self.registers.capacity() * size_of::<i32>()
+            + self.visited.capacity() * size_of::<u32>()
+    }
+
+    fn new(nfa: &Nfa) -> Self {
+        let pc_count = nfa.instructions.len();
+        Self {
+            pcs: Vec::with_capacity(pc_count),
+            registers: vec![-1; pc_count * nfa.register_count as usize],
+            visited: vec![0; pc_count << nfa.progress_registers.len()],
+            generation: 1,
+        }
+    }
+
+    fn clear(&mut self) {
+        self.pcs.clear();
+        self.generation = self.generation.wrapping_add(1);
+        if self.generation == 0 {
+            self.visited.fill(0);
+            self.generation = 1;
+        }
+    }
+
+    /// Mark `slot` as visited, returning whether it already was.
+    #[inline(always)]
+    fn check_and_mark(&mut self, slot: usize) -> bool {
+        if self.visited[slot] == self.generation {
+            return true;
+        }
+        self.visited[slot] = self.generation;
+        false
+    }
+}
+
+enum Frame {
+    Explore(u32),
+    RestoreRegister(u32, i32),
+}
+
+/// Reusable state for running the Pike VM.
+pub struct PikeVm {
+    current: ThreadList,
+    next: ThreadList,
+    /// Threads for a zero-width attempt in the middle of a surrogate pair.
+    between_surrogates: ThreadList,
+    stack: Vec<Frame>,
+    registers: Vec<i32>,
+    matched: Vec<i32>,
+}
+
+impl PikeVm {
+    /// Approximate number of heap bytes owned by this VM's thread lists and
+    /// scratch space.
+    pub fn heap_size(&self) -> usize {
+        self.current.heap_size()
+            + self.next.heap_size()
+            + self.between_surrogates.heap_size()
+            + self.stack.capacity() * size_of::<Frame>()
+            + self.registers.capacity() * size_of::<i32>()
+            + self.matched.capacity() * size_of::<i32>()
+    }
+
+    pub fn new(nfa: &Nfa) -> Self {
+        Self {
+            current: ThreadList::new(nfa),
+            next: ThreadList::new(nfa),
+            between_surrogates: ThreadList::new(nfa),
+            stack: Vec::new(),
+            registers: vec![-1; nfa.register_count as usize],
+            matched: vec![-1; nfa.register_count as usize],
+        }
+    }
+
+    /// Find the leftmost match at or after `start_pos`, or only at `start_pos`
+    /// if `anchored` is set, and return its registers.
+    pub fn execute<I: Input>(
+        &mut self,
+        nfa: &Nfa,
+        program: &Program,
+        hints: &PatternHints,
+        input: I,
+        start_pos: usize,
+        anchored: bool,
+    ) -> Option<&[i32]> {
+        if self.search(nfa, program, hints, input, start_pos, anchored) {
+            Some(&self.matched)
+        } else {
+            None
+        }
+    }
+
+    /// Find all non-overlapping matches, writing `(start, end)` pairs into
+    /// `result_buf`. Returns the number of matches, or -1 if the buffer is too
+    /// small.
+    pub fn find_all<I: Input>(
+        &mut self,
+        nfa: &Nfa,
+        program: &Program,
+        hints: &PatternHints,
+        input: I,
+        start_pos: usize,
+        result_buf: &mut [i32],
+    ) -> i32 {
+        let mut count = 0usize;
+        let mut pos = start_pos;
+        while pos <= input.len() && self.search(nfa, program, hints, input, pos, false) {
+            let idx = count * 2;
+            if idx + 1 >= result_buf.len() {
+                return -1;
+            }
+            let (match_start, match_end) = (self.matched[0], self.matched[1]);
+            result_buf[idx] = match_start;
+            result_buf[idx + 1] = match_end;
+            count += 1;
+            pos = if match_end == match_start {
+                match_end as usize + 1
+            } else {
+                match_end as usize
+            };
+        }
+        count as i32
+    }
+
+    fn search<I: Input>(
+        &mut self,
+        nfa: &Nfa,
+        program: &Program,
+        hints: &PatternHints,
+        input: I,
+        start_pos: usize,
+        anchored: bool,
+    ) -> bool {
+        let mut found = false;
+        let mut pos = start_pos;
+        self.current.clear();
+
+        loop {
+            if self.current.pcs.is_empty() {
+                if found {
+                    break;
+                }
+                if anchored {
+                    if pos != start_pos {
+                        break;
+                    }
+                } else {
+                    match next_candidate_start(program, input, hints, pos) {
+                        Some(candidate) => pos = candidate,
+                        None => break,
+                    }
+                }
+                if Self::is_between_surrogates(nfa, input, pos) {
+                    // NB: No character starts here, so only an empty match is possible.
+                    if self.zero_width_match(nfa, input, pos) {
+                        found = true;
+                        break;
+                    }
+                    if anchored {
+                        break;
+                    }
+                    pos += 1;
+                    continue;
+                }
+            }
+
+            // A new attempt starting here has lower priority than every thread
+            // that started earlier, and loses to any match already found.
+            if !found && (!anchored || pos == start_pos) {
+                self.registers.fill(-1);
+                Self::add_thread(
+                    nfa,
+                    input,
+                    pos,
+                    0,
+                    &mut self.current,
+                    &mut self.registers,
+                    &mut self.stack,
+                );
+            }
+
+            let character = nfa.character_at(input, pos);
+            self.next.clear();
+            let register_count = nfa.register_count as usize;
+            for index in 0..self.current.pcs.len() {
+                let pc = self.current.pcs[index];
+                let slot = pc as usize * register_count;
+                match &nfa.instructions[pc as usize] {
+                    NfaInstruction::Match => {
+                        // Everything after this thread has lower priority.
+                        self.matched
+                            .copy_from_slice(&self.current.registers[slot..slot + register_count]);
+                        found = true;
+                        break;
+                    }
+                    NfaInstruction::Consume(matcher) => {
+                        let Some((cp, length)) = character else {
+                            continue;
+                        };
+                        if !nfa.accepts(matcher, cp) {
+                            continue;
+                        }
+                        self.registers
+                            .copy_from_slice(&self.current.registers[slot..slot + register_count]);
+                        Self::add_thread(
+                            nfa,
+                            input,
+                            pos + length,
+                            pc + 1,
+                            &mut self.next,
+                            &mut self.registers,
+                            &mut self.stack,
+                        );
+                    }
+                    _ => unreachable!(),
+                }
+            }
+
+            let Some((_, length)) = character else {
+                break;
+            };
+
+            // The backtracking VM also tries to match between the halves of a
+            // surrogate pair. Such an attempt ranks below every live thread but
+            // above all attempts that start later.
+            if length == 2 && !found && !anchored && self.zero_width_match(nfa, input, pos + 1) {
+                found = true;
+            }
+
+            std::mem::swap(&mut self.current, &mut self.next);
+            pos += length;
+        }
+
+        found
+    }
+
+    #[inline(always)]
+    fn is_between_surrogates<I: Input>(nfa: &Nfa, input: I, pos: usize) -> bool {
+        nfa.unicode
+            && pos > 0
+            && pos < input.len()
+            && is_low_surrogate(input.code_unit(pos))
+            && is_high_surrogate(input.code_unit(pos - 1))
+    }
+
+    /// Try to match without consuming anything at `pos`, storing the
+    /// registers of the highest priority match in `self.matched`.
+    fn zero_width_match<I: Input>(&mut self, nfa: &Nfa, input: I, pos: usize) -> bool {
+        let list = &mut self.between_surrogates;
+        list.clear();
+        self.registers.fill(-1);
+        Self::add_thread(nfa, input, pos, 0, list, &mut self.registers, &mut self.stack);
+        let register_count = nfa.register_count as usize;
+        for pc in &list.pcs {
+            if nfa.instructions[*pc as usize] == NfaInstruction::Match {
+                let slot = *pc as usize * register_count;
+                self.matched
+                    .copy_from_slice(&list.registers[slot..slot + register_count]);
+                return true;
+            }
+        }
+        false
+    }
+
+    /// Follow every zero-width instruction reachable from `pc` at `pos`, in
+    /// priority order, adding a thread to `list` for each `Consume` or `Match`
+    /// reached. `registers` holds the incoming thread's registers and is
+    /// restored before returning.
+    fn add_thread<I: Input>(
+        nfa: &Nfa,
+        input: I,
+        pos: usize,
+        pc: u32,
+        list: &mut ThreadList,
+        registers: &mut [i32],
+        stack: &mut Vec<Frame>,
+    ) {
+        let register_count = nfa.register_count as usize;
+        let mask_bits = nfa.progress_registers.len();
+        stack.push(Frame::Explore(pc));
+        while let Some(frame) = stack.pop() {
+            let mut pc = match frame {
+                Frame::Explore(pc) => pc,
+                Frame::RestoreRegister(reg, value) => {
+                    registers[reg as usize] = value;
+                    continue;
+                }
+            };
+            loop {
+                let instruction = &nfa.instructions[pc as usize];
+                // NB: Consuming threads can share a slot regardless of their progress
+                //     registers, since those cannot hold the next position.
+                let mask = match instruction {
+                    NfaInstruction::Consume(_) | NfaInstruction::Match => 0,
+                    _ if mask_bits == 0 => 0,
+                    _ => nfa.progress_mask(registers, pos),
+                };
+                if list.check_and_mark(((pc as usize) << mask_bits) | mask) {
+                    break;
+                }
+                match instruction {
+                    NfaInstruction::Consume(_) | NfaInstruction::Match => {
+                        let slot = pc as usize * register_count;
+                        list.registers[slot..slot + register_count].copy_from_slice(registers);
+                        list.pcs.push(pc);
+                        break;
+                    }
+                    NfaInstruction::Jump(target) => pc = *target,
+                    NfaInstruction::Split { prefer, other } => {
+                        stack.push(Frame::Explore(*other));
+                        pc = *prefer;
+                    }
+                    NfaInstruction::Save(reg) => {
+                        stack.push(Frame::RestoreRegister(*reg, registers[*reg as usize]));
+                        registers[*reg as usize] = pos as i32;
+                        pc += 1;
+                    }
+                    NfaInstruction::ClearRegister(reg) => {
+                        stack.push(Frame::RestoreRegister(*reg, registers[*reg as usize]));
+                        registers[*reg as usize] = -1;
+                        pc += 1;
+                    }
+                    NfaInstruction::ProgressCheck(reg) => {
+                        if registers[*reg as usize] == pos as i32 {
+                            break;
+                        }
+                        stack.push(Frame::RestoreRegister(*reg, registers[*reg as usize]));
+                        registers[*reg as usize] = pos as i32;
+                        pc += 1;
+                    }
+                    NfaInstruction::Assert(assertion) => {
+                        if !nfa.assertion_holds(*assertion, input, pos) {
+                            break;
+                        }
+                        pc += 1;
+                    }
+                    NfaInstruction::Fail => break,
+                }
+            }
+        }
+    }
+}
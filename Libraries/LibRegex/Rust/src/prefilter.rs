@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Vectorized searches for candidate match positions, run ahead of the VM.
+//!
+//! - `find_code_units_u8/u16()` are memchr, memchr2 and memchr3 over ASCII
+//!   and UTF-16 input.
+//! - `Teddy` finds the next position where one of a set of short literals may
+//!   begin, using the nibble-shuffle technique from Hyperscan's Teddy.
+//! - `rarest_code_unit_index()` picks the code unit of a literal that is
+//!   least likely to occur, which is the best one to scan for.
+//!
+//! On x86-64, SSE2 is part of the baseline and SSSE3 is detected at runtime.
+//! Other targets scan a 64-bit word at a time (SWAR), and Teddy falls back to
+//! per-position table lookups.
+
+use crate::vm::Input;
+
+/// Between one and three code units, any of which can start a match.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct CodeUnitSet {
+    units: [u16; 3],
+    len: u8,
+}
+
+impl CodeUnitSet {
+    pub(crate) fn new(units: &[u16]) -> Option<Self> {
+        let mut set = Self { units: [0; 3], len: 0 };
+        for unit in units {
+            if set.as_slice().contains(unit) {
+                continue;
+            }
+            if set.len == 3 {
+                return None;
+            }
+            set.units[set.len as usize] = *unit;
+            set.len += 1;
+        }
+        if set.len == 0 { None } else { Some(set) }
+    }
+
+    #[inline(always)]
+    pub(crate) fn as_slice(&self) -> &[u16] {
+        &self.units[..self.len as usize]
+    }
+}
+
+/// A way to skip ahead to the next position where a match may start.
+pub enum Prefilter {
+    CodeUnits(CodeUnitSet),
+    Teddy(Box<Teddy>),
+}
+
+impl Prefilter {
+    /// Find the first candidate position at or after `start`.
+    #[inline(always)]
+    pub(crate) fn find<I: Input>(&self, input: I, start: usize) -> Option<usize> {
+        match self {
+            Prefilter::CodeUnits(set) => input.find_code_unit_in_set(start, input.len(), set),
+            Prefilter::Teddy(teddy) => input.find_teddy_candidate(start, teddy),
+        }
+    }
+}
+
+/// Find the first position in `haystack[start..end]` that holds one of `set`.
+#[inline(always)]
+pub(crate) fn find_code_units_u16(haystack: &[u16], start: usize, end: usize, set: &[u16]) -> Option<usize> {
+    let slice = haystack.get(start..end)?;
+    let offset = match *set {
+        [a] => find_u16(slice, [a]),
+        [a, b] => find_u16(slice, [a, b]),
+        [a, b, c] => find_u16(slice, [a, b, c]),
+        _ => slice.iter().position(|unit| set.contains(unit)),
+    }?;
+    Some(start + offset)
+}
+
+/// Find the first position in `haystack[start..end]` that holds one of `set`.
+/// ASCII-backed input never holds anything outside ASCII.
+#[inline(always)]
+pub(crate) fn find_code_units_u8(haystack: &[u8], start: usize, end: usize, set: &[u16]) -> Option<usize> {
+    let slice = haystack.get(start..end)?;
+    let mut bytes = [0u8; 3];
+    let mut count = 0;
+    for unit in set {
+        if *unit <= 0x7F && count < bytes.len() {
+            bytes[count] = *unit as u8;
+            count += 1;
+        }
+    }
+    let offset = match bytes[..count] {
+        [a] => find_u8(slice, [a]),
+        [a, b] => find_u8(slice, [a, b]),
+        [a, b, c] => find_u8(slice, [a, b, c]),
+        _ => None,
+    }?;
+    Some(start + offset)
+}
+
+#[inline(always)]
+fn find_u8<const N: usize>(haystack: &[u8], needles: [u8; N]) -> Option<usize> {
+    #[cfg(target_arch = "x86_64")]
+    {
+        x86::find_u8(haystack, needles)
+    }
+    #[cfg(not(target_arch = "x86_64"))]
+    {
+        swar::find_u8(haystack, needles)
+    }
+}
+
+#[inline(always)]
+fn find_u16<const N: usize>(haystack: &[u16], needles: [u16; N]) -> Option<usize> {
+    #[cfg(target_arch = "x86_64")]
+    {
+        x86::find_u16(haystack, needles)
+    }
+    #[cfg(not(target_arch = "x86_64"))]
+    {
+        swar::find_u16(haystack, needles)
+    }
+}
+
+/// Return the index of the code unit in `literal` that is least likely to
+/// occur in typical web text.
+pub(crate) fn rarest_code_unit_index(literal: &[u16]) -> usize {
+    let mut best = 0;
+    for (index, unit) in literal.iter().enumerate() {
+        if frequency_rank(*unit) < frequency_rank(literal[best]) {
+            best = index;
+        }
+    }
+    best
+}
+
+/// A rough measure of how common a code unit is in markup, scripts and prose.
+fn frequency_rank(unit: u16) -> u8 {
+    match unit {
+        0x20 => 255,
+        0x65 | 0x74 | 0x61 | 0x6F | 0x69 | 0x6E | 0x73 | 0x72 | 0x68 | 0x6C => 220,
+        0x61..=0x7A => 180,
+        0x22 | 0x27 | 0x2C | 0x2D | 0x2E | 0x2F | 0x3A | 0x3B | 0x3C | 0x3D | 0x3E | 0x0A | 0x09 => 170,
+        0x30..=0x39 => 150,
+        0x41..=0x5A => 120,
+        0x00..=0x7F => 80,
+        _ => 40,
+    }
+}
+
+/// Number of literals a Teddy searcher is willing to handle. Beyond this, the
+/// buckets fill up and nearly every position becomes a candidate.
+const MAX_TEDDY_LITERALS: usize = 64;
+
+/// Multi-literal candidate search.
+///
+/// Literals are spread over 8 buckets. For each of the first 1 to 3 code units
+/// of a literal (its fingerprint), a table maps each possible code unit to the
+/// set of buckets whose literals have that unit at that offset. A position is a
+/// candidate if some bucket is present in the tables for all of the following
+/// code units. Candidates must be verified against the actual literals.
+pub struct Teddy {
+    fingerprint_len: usize,
+    /// Bucket bits for the low and the high nibble of each fingerprint byte.
+    #[cfg_attr(not(target_arch = "x86_64"), allow(dead_code))]
+    nibble_masks: [[[u8; 16]; 2]; 3],
+    /// Exact bucket bits for each fingerprint byte.
+    byte_masks: [[u8; 256]; 3],
+    #[cfg_attr(not(target_arch = "x86_64"), allow(dead_code))]
+    use_ssse3: bool,
+}
+
+impl Teddy {
+    /// Build a searcher for the start positions of `literals`. Literals must be
+    /// non-empty and limited to Latin-1. With `ascii_case_insensitive`, ASCII
+    /// letters match either case.
+    pub(crate) fn new(literals: &[Vec<u16>], ascii_case_insensitive: bool) -> Option<Self> {
+        if literals.is_empty() || literals.len() > MAX_TEDDY_LITERALS {
+            return None;
+        }
+        if literals
+            .iter()
+            .any(|literal| literal.is_empty() || literal.iter().any(|unit| *unit > 0xFF))
+        {
+            return None;
+        }
+
+        let fingerprint_len = literals.iter().map(|literal| literal.len()).min()?.min(3);
+
+        // Keep literals with similar fingerprints in the same bucket, so that
+        // buckets stay selective.
+        let mut order: Vec<usize> = (0..literals.len()).collect();
+        order.sort_by(|a, b| literals[*a][..fingerprint_len].cmp(&literals[*b][..fingerprint_len]));
+
+        let mut teddy = Self {
+            fingerprint_len,
+            nibble_masks: [[[0; 16]; 2]; 3],
+            byte_masks: [[0; 256]; 3],
+            use_ssse3: Self::has_ssse3(),
+        };
+        for (rank, index) in order.iter().enumerate() {
+            let bucket_bit = 1u8 << (rank * 8 / literals.len());
+            for (offset, unit) in literals[*index][..fingerprint_len].iter().enumerate() {
+                let byte = *unit as u8;
+                let variants = if ascii_case_insensitive && byte.is_ascii_alphabetic() {
+                    [byte.to_ascii_lowercase(), byte.to_ascii_uppercase()]
+                } else {
+                    [byte, byte]
+                };
+                for variant in variants {
+                    teddy.nibble_masks[offset][0][(variant & 0xF) as usize] |= bucket_bit;
+                    teddy.nibble_masks[offset][1][(variant >> 4) as usize] |= bucket_bit;
+                    teddy.byte_masks[offset][variant as usize] |= bucket_bit;
+                }
+            }
+        }
+        Some(teddy)
+    }
+
+    #[cfg(target_arch = "x86_64")]
+    fn has_ssse3() -> bool {
+        std::arch::is_x86_feature_detected!("ssse3")
+    }
+
+    #[cfg(not(target_arch = "x86_64"))]
+    fn has_ssse3() -> bool {
+        false
+    }
+
+    /// Find the first candidate position at or after `start`.
+    pub(crate) fn find_u8(&self, haystack: &[u8], start: usize) -> Option<usize> {
+        #[cfg(target_arch = "x86_64")]
+        if self.use_ssse3 {
+            // SAFETY: SSSE3 support was detected when this searcher was built.
+            return unsafe { x86::teddy_find_u8(self, haystack, start) };
+        }
+        self.find_scalar(haystack.len(), start, |pos| haystack[pos] as u16)
+    }
+
+    /// Find the first candidate position at or after `start`.
+    pub(crate) fn find_u16(&self, haystack: &[u16], start: usize) -> Option<usize> {
+        #[cfg(target_arch = "x86_64")]
+        if self.use_ssse3 {
+            // SAFETY: SSSE3 support was detected when this searcher was built.
+            return unsafe { x86::teddy_find_u16(self, haystack, start) };
+        }
+        self.find_scalar(haystack.len(), start, |pos| haystack[pos])
+    }
+
+    #[inline(always)]
+    pub(crate) fn find_scalar(&self, len: usize, start: usize, code_unit: impl Fn(usize) -> u16) -> Option<usize> {
+        if len < self.fingerprint_len {
+            return None;
+        }
+        (start..=len - self.fingerprint_len).find(|pos| self.is_candidate_at(*pos, &code_unit))
+    }
+
+    #[inline(always)]
+    fn is_candidate_at(&self, pos: usize, code_unit: &impl Fn(usize) -> u16) -> bool {
+        let mut buckets = 0xFF;
+        for offset in 0..self.fingerprint_len {
+            let unit = code_unit(pos + offset);
+            if unit > 0xFF {
+                return false;
+            }
+            buckets &= self.byte_masks[offset][unit as usize];
+            if buckets == 0 {
+                return false;
+            }
+        }
+        true
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+mod x86 {
+    use super::Teddy;
+    use std::arch::x86_64::*;
+
+    #[inline(always)]
+    pub(super) fn find_u8<const N: usize>(haystack: &[u8], needles: [u8; N]) -> Option<usize> {
+        let mut pos = 0;
+        // SAFETY: SSE2 is part of the x86-64 baseline, and every load reads 16
+        //         bytes that lie within `haystack`.
+        unsafe {
+            let splats = needles.map(|needle| _mm_set1_epi8(needle as i8));
+            while pos + 16 <= haystack.len() {
+                let chunk = _mm_loadu_si128(haystack.as_ptr().add(pos).cast());
+                let mut equal = _mm_cmpeq_epi8(chunk, splats[0]);
+                for splat in &splats[1..] {
+                    equal = _mm_or_si128(equal, _mm_cmpeq_epi8(chunk, *splat));
+                }
+                let mask = _mm_movemask_epi8(equal) as u32;
+                if mask != 0 {
+                    return Some(pos + mask.trailing_zeros() as usize);
+                }
+                pos += 16;
+            }
+        }
+        let offset = haystack[pos..].iter().position(|byte| needles.contains(byte))?;
+        Some(pos + offset)
+    }
+
+    #[inline(always)]
+    pub(super) fn find_u16<const N: usize>(haystack: &[u16], needles: [u16; N]) -> Option<usize> {
+        let mut pos = 0;
+        // SAFETY: SSE2 is part of the x86-64 baseline, and every load reads 8
+        //         code units that lie within `haystack`.
+        unsafe {
+            let splats = needles.map(|needle| _mm_set1_epi16(needle as i16));
+            while pos + 8 <= haystack.len() {
+                let chunk = _mm_loadu_si128(haystack.as_ptr().add(pos).cast());
+                let mut equal = _mm_cmpeq_epi16(chunk, splats[0]);
+                for splat in &splats[1..] {
+                    equal = _mm_or_si128(equal, _mm_cmpeq_epi16(chunk, *splat));
+                }
+                let mask = _mm_movemask_epi8(equal) as u32;
+                if mask != 0 {
+                    return Some(pos + mask.trailing_zeros() as usize / 2);
+                }
+                pos += 8;
+            }
+        }
+        let offset = haystack[pos..].iter().position(|unit| needles.contains(unit))?;
+        Some(pos + offset)
+    }
+
+    /// Return a mask with one bit per byte of `chunks`, set for positions
+    /// where the fingerprint of some bucket matches.
+    #[inline(always)]
+    unsafe fn teddy_candidates(teddy: &Teddy, chunks: &[__m128i; 3]) -> u32 {
+        // SAFETY: The caller has checked for SSSE3, and the masks are 16 bytes each.
+        unsafe {
+            let low_nibbles = _mm_set1_epi8(0x0F);
+            let mut buckets = _mm_set1_epi8(-1);
+            for (offset, chunk) in chunks.iter().enumerate().take(teddy.fingerprint_len) {
+                let low_mask = _mm_loadu_si128(teddy.nibble_masks[offset][0].as_ptr().cast());
+                let high_mask = _mm_loadu_si128(teddy.nibble_masks[offset][1].as_ptr().cast());
+                let low = _mm_and_si128(*chunk, low_nibbles);
+                let high = _mm_and_si128(_mm_srli_epi16(*chunk, 4), low_nibbles);
+                let matched = _mm_and_si128(_mm_shuffle_epi8(low_mask, low), _mm_shuffle_epi8(high_mask, high));
+                buckets = _mm_and_si128(buckets, matched);
+            }
+            let empty = _mm_movemask_epi8(_mm_cmpeq_epi8(buckets, _mm_setzero_si128())) as u32;
+            !empty & 0xFFFF
+        }
+    }
+
+    #[target_feature(enable = "ssse3")]
+    pub(super) unsafe fn teddy_find_u8(teddy: &Teddy, haystack: &[u8], start: usize) -> Option<usize> {
+        let lookahead = teddy.fingerprint_len - 1;
+        let mut pos = start;
+        // SAFETY: Each load reads 16 bytes starting at most `lookahead` bytes
+        //         past `pos`, and the loop leaves room for that.
+        unsafe {
+            let mut chunks = [_mm_setzero_si128(); 3];
+            while pos + 16 + lookahead <= haystack.len() {
+                for (offset, chunk) in chunks.iter_mut().enumerate().take(teddy.fingerprint_len) {
+                    *chunk = _mm_loadu_si128(haystack.as_ptr().add(pos + offset).cast());
+                }
+                let candidates = teddy_candidates(teddy, &chunks);
+                if candidates != 0 {
+                    let candidate = pos + candidates.trailing_zeros() as usize;
+                    if teddy.is_candidate_at(candidate, &|pos| haystack[pos] as u16) {
+                        return Some(candidate);
+                    }
+                    // NB: Nibble masks can pair the nibbles of different literals.
+                    //     Continue right after the false positive.
+                    pos = candidate + 1;
+                    continue;
+                }
+                pos += 16;
+            }
+        }
+        teddy.find_scalar(haystack.len(), pos, |pos| haystack[pos] as u16)
+    }
+
+    #[target_feature(enable = "ssse3")]
+    pub(super) unsafe fn teddy_find_u16(teddy: &Teddy, haystack: &[u16], start: usize) -> Option<usize> {
+        let lookahead = teddy.fingerprint_len - 1;
+        let mut pos = start;
+        // SAFETY: Each pair of loads reads 16 code units starting at most
+        //         `lookahead` code units past `pos`, and the loop leaves room for that.
+        unsafe {
+            let mut chunks = [_mm_setzero_si128(); 3];
+            while pos + 16 + lookahead <= haystack.len() {
+                for (offset, chunk) in chunks.iter_mut().enumerate().take(teddy.fingerprint_len) {
+                    let base = haystack.as_ptr().add(pos + offset);
+                    // NB: Saturation maps code units above Latin-1 to 0x00 or 0xFF,
+                    //     which can only produce false positives.
+                    *chunk = _mm_packus_epi16(_mm_loadu_si128(base.cast()), _mm_loadu_si128(base.add(8).cast()));
+                }
+                let candidates = teddy_candidates(teddy, &chunks);
+                if candidates != 0 {
+                    let candidate = pos + candidates.trailing_zeros() as usize;
+                    if teddy.is_candidate_at(candidate, &|pos| haystack[pos]) {
+                        return Some(candidate);
+                    }
+                    pos = candidate + 1;
+                    continue;
+                }
+                pos += 16;
+            }
+        }
+        teddy.find_scalar(haystack.len(), pos, |pos| haystack[pos])
+    }
+}
+
+#[cfg(not(target_arch = "x86_64"))]
+mod swar {
+    const LOW_BYTES: u64 = 0x0101_0101_0101_0101;
+    const HIGH_BYTE_BITS: u64 = 0x8080_8080_8080_8080;
+    const LOW_UNITS: u64 = 0x0001_0001_0001_0001;
+    const HIGH_UNIT_BITS: u64 = 0x8000_8000_8000_8000;
+
+    /// Set the high bit of each lane of `word` that is zero. Lanes above the
+    /// first zero lane may also be flagged, so only the lowest flag is exact.
+    #[inline(always)]
+    fn zero_lanes(word: u64, low: u64, high: u64) -> u64 {
+        word.wrapping_sub(low) & !word & high
+    }
+
+    #[inline(always)]
+    pub(super) fn find_u8<const N: usize>(haystack: &[u8], needles: [u8; N]) -> Option<usize> {
+        let splats = needles.map(|needle| LOW_BYTES * needle as u64);
+        let mut pos = 0;
+        while pos + 8 <= haystack.len() {
+            let word = u64::from_le_bytes(haystack[pos..pos + 8].try_into().unwrap());
+            let mut found = 0;
+            for splat in splats {
+                found |= zero_lanes(word ^ splat, LOW_BYTES, HIGH_BYTE_BITS);
+            }
+            if found != 0 {
+                return Some(pos + found.trailing_zeros() as usize / 8);
+            }
+            pos += 8;
+        }
+        let offset = haystack[pos..].iter().position(|byte| needles.contains(byte))?;
+        Some(pos + offset)
+    }
+
+    #[inline(always)]
+    pub(super) fn find_u16<const N: usize>(haystack: &[u16], needles: [u16; N]) -> Option<usize> {
+        let splats = needles.map(|needle| LOW_UNITS * needle as u64);
+        let mut pos = 0;
+        while pos + 4 <= haystack.len() {
+            let word = haystack[pos] as u64
+                | (haystack[pos + 1] as u64) << 16
+                | (haystack[pos + 2] as u64) << 32
+                | (haystack[pos + 3] as u64) << 48;
+            let mut found = 0;
+            for splat in splats {
+                found |= zero_lanes(word ^ splat, LOW_UNITS, HIGH_UNIT_BITS);
+            }
+            if found != 0 {
+                return Some(pos + found.trailing_zeros() as usize / 16);
+            }
+            pos += 4;
+        }
+        let offset = haystack[pos..].iter().position(|unit| needles.contains(unit))?;
+        Some(pos + offset)
+    }
+}
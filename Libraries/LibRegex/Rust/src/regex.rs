@@ -9,10 +9,31 @@
 /// This is the main entry point for using the regex engine.
 use crate::ast::{Alternative, Atom, Disjunction, Flags, Pattern, Term};
 use crate::bytecode::{Instruction, NamedGroupEntry, append_code_point_wtf16};
+use crate::dfa::LazyDfa;
+use crate::native::{NativeEntry, NativeOutcome, NativeState};
+use crate::nfa::Nfa;
+use crate::pikevm::PikeVm;
+use crate::prefilter::{self, Teddy};
 use crate::{compiler, parser, vm};
 use std::cell::RefCell;
 use std::collections::HashSet;
 
+/// Steps the backtracking VM may take per search before handing the search
+/// over to the linear-time engines, in addition to a per-code-unit allowance.
+const BACKTRACK_BUDGET_BASE: u64 = 1_000_000;
+const BACKTRACK_BUDGET_PER_CODE_UNIT: u64 = 64;
+
+/// Linear-time engines for patterns that never need to backtrack into
+/// themselves, i.e. those without backreferences, lookaround or modifiers.
+struct LinearEngine {
+    nfa: Nfa,
+    /// Built on first use, as most searches never fall back.
+    pike_vm: RefCell<Option<PikeVm>>,
+    dfa: RefCell<Option<LazyDfa>>,
+    /// Native code for the NFA, once the program is hot.
+    native: NativeState,
+}
+
 /// A compiled regular expression.
 pub struct Regex {
     /// Program for the backtracking VM (with fused loop optimizations).
@@ -26,8 +47,12 @@ pub struct Regex {
     /// Pre-computed u16 alternatives for fast literal alternation matching.
     /// Alternatives stay in source order to preserve leftmost-first semantics.
     literal_alt_u16: Option<Vec<Vec<u16>>>,
+    /// Multi-literal candidate search over the alternatives above.
+    literal_alt_teddy: Option<Teddy>,
     /// Cached VM scratch space for reuse across exec calls.
     scratch: RefCell<vm::VmScratch>,
+    /// Fallback for searches that exhaust the backtracking budget.
+    linear: Option<LinearEngine>,
 }
 
 impl Regex {
@@ -42,6 +67,15 @@ impl Regex {
         let literal_u16 = extract_literal_u16(&parsed, flags);
         let word_boundary_literal_u16 = extract_word_boundary_literal_u16(&parsed, flags);
         let literal_alt_u16 = extract_literal_alternatives_u16(&parsed, flags);
+        let literal_alt_teddy = literal_alt_u16
+            .as_deref()
+            .and_then(|alts| Teddy::new(alts, flags.ignore_case));
+        let linear = Nfa::compile(&program).map(|nfa| LinearEngine {
+            nfa,
+            pike_vm: RefCell::new(None),
+            dfa: RefCell::new(None),
+            native: NativeState::new(),
+        });
 
         Ok(Self {
             program,
@@ -50,7 +84,9 @@ impl Regex {
             literal_u16,
             word_boundary_literal_u16,
             literal_alt_u16,
+            literal_alt_teddy,
             scratch: RefCell::new(vm::VmScratch::new()),
+            linear,
         })
     }
 
@@ -68,8 +104,15 @@ impl Regex {
 
     pub(crate) fn exec_into_input<I: vm::Input>(&self, input: I, start: usize, out: &mut [i32]) -> vm::VmResult {
         if self.flags.sticky {
-            let scratch = &mut *self.scratch.borrow_mut();
-            return vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, out, scratch);
+            if let Some(result) = self.native_exec(input, start, out) {
+                return self.linear_exec_if_over_budget(result, input, start, out);
+            }
+            let result = {
+                let scratch = &mut *self.scratch.borrow_mut();
+                self.prepare_scratch(scratch, input.len(), start);
+                vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, out, scratch)
+            };
+            return self.linear_exec_if_over_budget(result, input, start, out);
         }
 
         // Fast path for literal patterns: use fast substring search.
@@ -90,14 +133,21 @@ impl Regex {
         }
         // Fast path for literal alternation patterns.
         if let Some(ref alts) = self.literal_alt_u16 {
-            return if Self::literal_alt_search(input, start, alts, &self.flags, out) {
+            return if Self::literal_alt_search(input, start, alts, self.literal_alt_teddy.as_ref(), &self.flags, out) {
                 vm::VmResult::Match
             } else {
                 vm::VmResult::NoMatch
             };
         }
-        let scratch = &mut *self.scratch.borrow_mut();
-        vm::execute_into_with_scratch(&self.program, input, start, &self.hints, out, scratch)
+        if let Some(result) = self.native_exec(input, start, out) {
+            return self.linear_exec_if_over_budget(result, input, start, out);
+        }
+        let result = {
+            let scratch = &mut *self.scratch.borrow_mut();
+            self.prepare_scratch(scratch, input.len(), start);
+            vm::execute_into_with_scratch(&self.program, input, start, &self.hints, out, scratch)
+        };
+        self.linear_exec_if_over_budget(result, input, start, out)
     }
 
     /// Test whether the regex matches anywhere in the input.
@@ -112,8 +162,15 @@ impl Regex {
     pub(crate) fn test_input<I: vm::Input>(&self, input: I, start: usize) -> vm::VmResult {
         if self.flags.sticky {
             let mut out = [-1i32; 2];
-            let scratch = &mut *self.scratch.borrow_mut();
-            return vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, &mut out, scratch);
+            if let Some(result) = self.native_exec(input, start, &mut out) {
+                return self.linear_exec_if_over_budget(result, input, start, &mut out);
+            }
+            let result = {
+                let scratch = &mut *self.scratch.borrow_mut();
+                self.prepare_scratch(scratch, input.len(), start);
+                vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, &mut out, scratch)
+            };
+            return self.linear_exec_if_over_budget(result, input, start, &mut out);
         }
 
         if let Some(ref needle) = self.literal_u16 {
@@ -132,7 +189,14 @@ impl Regex {
         }
         if let Some(ref alts) = self.literal_alt_u16 {
             let mut out = [-1i32; 2];
-            return if Self::literal_alt_search(input, start, alts, &self.flags, &mut out) {
+            return if Self::literal_alt_search(
+                input,
+                start,
+                alts,
+                self.literal_alt_teddy.as_ref(),
+                &self.flags,
+                &mut out,
+            ) {
                 vm::VmResult::Match
             } else {
                 vm::VmResult::NoMatch
@@ -140,8 +204,125 @@ impl Regex {
         }
         // Reuse cached scratch space for the VM. Only need group 0 for test().
         let mut out = [-1i32; 2];
-        let scratch = &mut *self.scratch.borrow_mut();
-        vm::execute_into_with_scratch(&self.program, input, start, &self.hints, &mut out, scratch)
+        let result = match self.native_exec(input, start, &mut out) {
+            Some(result) => result,
+            None => {
+                let scratch = &mut *self.scratch.borrow_mut();
+                self.prepare_scratch(scratch, input.len(), start);
+                vm::execute_into_with_scratch(&self.program, input, start, &self.hints, &mut out, scratch)
+            }
+        };
+        if result == vm::VmResult::LimitExceeded
+            && let Some(linear) = &self.linear
+            && let Some(matched) = self.linear_is_match(linear, input, start)
+        {
+            return if matched {
+                vm::VmResult::Match
+            } else {
+                vm::VmResult::NoMatch
+            };
+        }
+        self.linear_exec_if_over_budget(result, input, start, &mut out)
+    }
+
+    /// Limit the backtracking VM to a budget proportional to the input length
+    /// if a linear-time engine can take over when it runs out.
+    fn prepare_scratch(&self, scratch: &mut vm::VmScratch, input_len: usize, start: usize) {
+        let budget = self.linear.as_ref().map(|_| Self::backtrack_budget(input_len, start));
+        scratch.set_step_budget(budget);
+    }
+
+    fn backtrack_budget(input_len: usize, start: usize) -> u64 {
+        BACKTRACK_BUDGET_BASE + BACKTRACK_BUDGET_PER_CODE_UNIT * input_len.saturating_sub(start) as u64
+    }
+
+    /// Search with the native matcher if the program has one for this input.
+    /// Otherwise, count the search towards the program becoming hot and return
+    /// `None` so that the caller runs the VM.
+    fn native_exec<I: vm::Input>(&self, input: I, start: usize, out: &mut [i32]) -> Option<vm::VmResult> {
+        let linear = self.linear.as_ref()?;
+        let outcome = linear.native.execute(
+            &linear.nfa,
+            &self.program,
+            &self.hints,
+            input,
+            start,
+            self.flags.sticky,
+            Self::backtrack_budget(input.len(), start),
+        );
+        match outcome {
+            NativeOutcome::Unavailable => {
+                linear.native.record_execution();
+                None
+            }
+            NativeOutcome::Match => {
+                linear.native.copy_registers(self.program.capture_count, out);
+                Some(vm::VmResult::Match)
+            }
+            NativeOutcome::NoMatch => Some(vm::VmResult::NoMatch),
+            // NB: Like an over-budget VM search, this is handed to the linear-time engines.
+            NativeOutcome::GaveUp => Some(vm::VmResult::LimitExceeded),
+        }
+    }
+
+    /// The request to hand to the native compiler if the program just became
+    /// hot, see `native.rs`. Returns `None` on every other call.
+    pub fn take_native_compile_request(&self) -> Option<Vec<u8>> {
+        let linear = self.linear.as_ref()?;
+        linear.native.take_compile_request(&linear.nfa)
+    }
+
+    /// Install native code built from `take_native_compile_request()`.
+    ///
+    /// # Safety
+    /// `entry` must be the compiled entry point for `code_unit_size` byte input,
+    /// and must stay executable for as long as this regex is alive.
+    pub unsafe fn install_native_matcher(&self, code_unit_size: u32, entry: NativeEntry) {
+        if let Some(linear) = &self.linear {
+            linear.native.install(code_unit_size, entry);
+        }
+    }
+
+    /// Redo a search that exhausted the backtracking budget with the Pike VM.
+    fn linear_exec_if_over_budget<I: vm::Input>(
+        &self,
+        result: vm::VmResult,
+        input: I,
+        start: usize,
+        out: &mut [i32],
+    ) -> vm::VmResult {
+        if result != vm::VmResult::LimitExceeded {
+            return result;
+        }
+        let Some(linear) = &self.linear else {
+            return result;
+        };
+        // NB: Scanning with the DFA is much cheaper than running the Pike VM, so
+        //     use it to rule out inputs without any match first.
+        if !self.flags.sticky && self.linear_is_match(linear, input, start) == Some(false) {
+            return vm::VmResult::NoMatch;
+        }
+        let mut pike_vm = linear.pike_vm.borrow_mut();
+        let pike_vm = pike_vm.get_or_insert_with(|| PikeVm::new(&linear.nfa));
+        let Some(registers) = pike_vm.execute(&linear.nfa, &self.program, &self.hints, input, start, self.flags.sticky)
+        else {
+            return vm::VmResult::NoMatch;
+        };
+        let slots = ((self.program.capture_count as usize + 1) * 2)
+            .min(registers.len())
+            .min(out.len());
+        out[..slots].copy_from_slice(&registers[..slots]);
+        vm::VmResult::Match
+    }
+
+    /// Whether there is any match at or after `start`, if the DFA can tell.
+    fn linear_is_match<I: vm::Input>(&self, linear: &LinearEngine, input: I, start: usize) -> Option<bool> {
+        if self.flags.sticky || self.hints.can_match_empty() {
+            return None;
+        }
+        let mut dfa = linear.dfa.borrow_mut();
+        dfa.get_or_insert_with(|| LazyDfa::new(&linear.nfa))
+            .is_match(&linear.nfa, input, start)
     }
 
     /// Fast literal substring search for whole-pattern literal fast paths.
@@ -206,18 +387,17 @@ impl Regex {
             return false;
         }
 
-        // Case-sensitive: use fast first-character scan + verify.
-        let first = needle[0];
+        // Case-sensitive: scan for the rarest code unit of the needle, then verify.
         let needle_len = needle.len();
         if start + needle_len > input.len() {
             return false;
         }
+        let rare = prefilter::rarest_code_unit_index(needle);
         let mut pos = start;
         let end = input.len() - needle_len + 1;
         while pos < end {
-            // Bulk scan for first character.
-            match input.find_code_unit(pos, end, first) {
-                Some(candidate_pos) => pos = candidate_pos,
+            match input.find_code_unit(pos + rare, end + rare, needle[rare]) {
+                Some(candidate_pos) => pos = candidate_pos - rare,
                 None => return false,
             }
             // Verify rest of needle.
@@ -281,14 +461,22 @@ impl Regex {
         input: I,
         start: usize,
         alts: &[Vec<u16>],
+        teddy: Option<&Teddy>,
         flags: &Flags,
         out: &mut [i32],
     ) -> bool {
         if flags.ignore_case {
-            return Self::literal_alt_search_ascii_ignore_case(input, start, alts, out);
+            return Self::literal_alt_search_ascii_ignore_case(input, start, alts, teddy, out);
         }
 
-        for pos in start..input.len() {
+        let mut pos = start;
+        while pos < input.len() {
+            if let Some(teddy) = teddy {
+                match input.find_teddy_candidate(pos, teddy) {
+                    Some(candidate_pos) => pos = candidate_pos,
+                    None => return false,
+                }
+            }
             let first_ch = input.code_unit(pos);
             for alt in alts {
                 if alt[0] != first_ch {
@@ -306,6 +494,7 @@ impl Regex {
                     return true;
                 }
             }
+            pos += 1;
         }
         false
     }
@@ -314,6 +503,7 @@ impl Regex {
         input: I,
         start: usize,
         alts: &[Vec<u16>],
+        teddy: Option<&Teddy>,
         out: &mut [i32],
     ) -> bool {
         let min_alt_len = alts.iter().map(|alt| alt.len()).min().unwrap_or(0);
@@ -329,7 +519,13 @@ impl Regex {
         let mut pos = start;
         let end = input.len() - min_alt_len + 1;
         while pos < end {
-            match find_ascii_case_insensitive_code_unit_in_set(input, pos, end, &first_code_units) {
+            let next = match teddy {
+                Some(teddy) => input
+                    .find_teddy_candidate(pos, teddy)
+                    .filter(|candidate_pos| *candidate_pos < end),
+                None => find_ascii_case_insensitive_code_unit_in_set(input, pos, end, &first_code_units),
+            };
+            match next {
                 Some(candidate_pos) => pos = candidate_pos,
                 None => return false,
             }
@@ -430,6 +626,7 @@ impl Regex {
         input: I,
         start: usize,
         alts: &[Vec<u16>],
+        teddy: Option<&Teddy>,
         flags: &Flags,
         result_buf: &mut [i32],
     ) -> i32 {
@@ -443,7 +640,7 @@ impl Regex {
             }
             out[0] = -1;
             out[1] = -1;
-            if !Self::literal_alt_search(input, pos, alts, flags, &mut out) {
+            if !Self::literal_alt_search(input, pos, alts, teddy, flags, &mut out) {
                 break;
             }
             let idx = count as usize * 2;
@@ -501,6 +698,27 @@ impl Regex {
         self.program.capture_count
     }
 
+    /// Approximate number of bytes this regex occupies, including the scratch
+    /// space and lazily built engines that grow as it is used. Native code is
+    /// owned by the embedder and not counted here.
+    pub fn heap_size(&self) -> usize {
+        let u16_bytes = |literal: &Vec<u16>| literal.capacity() * size_of::<u16>();
+        let mut size = size_of::<Self>() + self.program.heap_size();
+        size += self.literal_u16.as_ref().map_or(0, u16_bytes);
+        size += self.word_boundary_literal_u16.as_ref().map_or(0, u16_bytes);
+        if let Some(alternatives) = &self.literal_alt_u16 {
+            size += alternatives.capacity() * size_of::<Vec<u16>>();
+            size += alternatives.iter().map(u16_bytes).sum::<usize>();
+        }
+        size += self.scratch.try_borrow().map_or(0, |scratch| scratch.heap_size());
+        if let Some(linear) = &self.linear {
+            size += linear.nfa.heap_size() + linear.native.heap_size();
+            size += linear.pike_vm.try_borrow().map_or(0, |pike_vm| pike_vm.as_ref().map_or(0, PikeVm::heap_size));
+            size += linear.dfa.try_borrow().map_or(0, |dfa| dfa.as_ref().map_or(0, LazyDfa::heap_size));
+        }
+        size
+    }
+
     /// Get the named capture groups (in order of appearance in the pattern).
     pub fn named_groups(&self) -> &[NamedGroupEntry] {
         &self.program.named_groups
@@ -517,7 +735,8 @@ impl Regex {
 
     /// Find all non-overlapping matches starting from `start`.
     /// Writes (match_start, match_end) i32 pairs directly into `result_buf`.
-    /// Returns number of matches found, or -1 if buffer is too small.
+    /// Returns number of matches found, or -1 if buffer is too small, or -2 if
+    /// the step limit was exceeded.
     pub fn find_all_into(&self, input: &[u16], start: usize, result_buf: &mut [i32]) -> i32 {
         self.find_all_into_input(input, start, result_buf)
     }
@@ -536,11 +755,36 @@ impl Regex {
         }
         // Fast path for literal alternation patterns.
         if let Some(ref alts) = self.literal_alt_u16 {
-            return Self::literal_alt_find_all(input, start, alts, &self.flags, result_buf);
+            return Self::literal_alt_find_all(
+                input,
+                start,
+                alts,
+                self.literal_alt_teddy.as_ref(),
+                &self.flags,
+                result_buf,
+            );
         }
         // Use the VM-internal find_all loop which reuses a single VM across matches.
-        let scratch = &mut *self.scratch.borrow_mut();
-        vm::find_all_with_scratch(&self.program, input, start, &self.hints, result_buf, scratch)
+        let result = {
+            let scratch = &mut *self.scratch.borrow_mut();
+            self.prepare_scratch(scratch, input.len(), start);
+            vm::find_all_with_scratch(&self.program, input, start, &self.hints, result_buf, scratch)
+        };
+        if result != -2 {
+            return result;
+        }
+        let Some(linear) = &self.linear else {
+            return result;
+        };
+        let mut pike_vm = linear.pike_vm.borrow_mut();
+        pike_vm.get_or_insert_with(|| PikeVm::new(&linear.nfa)).find_all(
+            &linear.nfa,
+            &self.program,
+            &self.hints,
+            input,
+            start,
+            result_buf,
+        )
     }
 }
 
@@ -569,16 +813,7 @@ fn find_ascii_case_insensitive_code_unit<I: vm::Input>(
     end: usize,
     needle: u16,
 ) -> Option<usize> {
-    let folded_needle = fold_ascii_for_compare(needle);
-    let mut pos = start;
-    while pos < end {
-        let code_unit = input.code_unit(pos);
-        if code_unit <= 0x7F && fold_ascii_for_compare(code_unit) == folded_needle {
-            return Some(pos);
-        }
-        pos += 1;
-    }
-    None
+    input.find_code_unit_in_set(start, end, &vm::ascii_case_variants(needle)?)
 }
 
 #[inline(always)]
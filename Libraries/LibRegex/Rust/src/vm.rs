@@ -13,6 +13,7 @@
 //! - <https://tc39.es/ecma262/#sec-pattern-semantics>
 //! - <https://tc39.es/ecma262/#sec-regexpbuiltinexec>
 use crate::bytecode::*;
+use crate::prefilter::{self, CodeUnitSet, Prefilter, Teddy};
 
 /// Maximum number of steps before aborting (prevents ReDoS).
 const MATCH_LIMIT: u64 = 10_000_000;
@@ -29,6 +30,9 @@ pub trait Input: Copy {
     fn len(self) -> usize;
     fn code_unit(self, pos: usize) -> u16;
 
+    /// A pointer to the first code unit and the size of each in bytes, for native matchers.
+    fn raw_code_units(self) -> (*const u8, u32);
+
     #[inline(always)]
     fn is_empty(self) -> bool {
         self.len() == 0
@@ -46,6 +50,19 @@ pub trait Input: Copy {
         None
     }
 
+    /// Find the first position in `start..end` holding any code unit of `set`.
+    #[inline(always)]
+    fn find_code_unit_in_set(self, start: usize, end: usize, set: &CodeUnitSet) -> Option<usize> {
+        (start..end).find(|&pos| set.as_slice().contains(&self.code_unit(pos)))
+    }
+
+    /// Find the first position at or after `start` where one of the literals
+    /// of `teddy` may begin.
+    #[inline(always)]
+    fn find_teddy_candidate(self, start: usize, teddy: &Teddy) -> Option<usize> {
+        teddy.find_scalar(self.len(), start, |pos| self.code_unit(pos))
+    }
+
     #[inline(always)]
     fn next_literal_start(self, start_pos: usize, ch16: u16) -> Option<usize> {
         self.find_code_unit(start_pos, self.len(), ch16)
@@ -97,10 +114,24 @@ impl Input for &[u16] {
         self[pos]
     }
 
+    #[inline(always)]
+    fn raw_code_units(self) -> (*const u8, u32) {
+        (self.as_ptr().cast(), 2)
+    }
+
     #[inline(always)]
     fn find_code_unit(self, start: usize, end: usize, ch16: u16) -> Option<usize> {
-        let offset = self.get(start..end)?.iter().position(|&c| c == ch16)?;
-        Some(start + offset)
+        prefilter::find_code_units_u16(self, start, end, &[ch16])
+    }
+
+    #[inline(always)]
+    fn find_code_unit_in_set(self, start: usize, end: usize, set: &CodeUnitSet) -> Option<usize> {
+        prefilter::find_code_units_u16(self, start, end, set.as_slice())
+    }
+
+    #[inline(always)]
+    fn find_teddy_candidate(self, start: usize, teddy: &Teddy) -> Option<usize> {
+        teddy.find_u16(self, start)
     }
 
     #[inline(always)]
@@ -130,14 +161,24 @@ impl Input for &[u8] {
         self[pos] as u16
     }
 
+    #[inline(always)]
+    fn raw_code_units(self) -> (*const u8, u32) {
+        (self.as_ptr(), 1)
+    }
+
     #[inline(always)]
     fn find_code_unit(self, start: usize, end: usize, ch16: u16) -> Option<usize> {
-        let byte = u8::try_from(ch16).ok()?;
-        if byte > 0x7F {
-            return None;
-        }
-        let offset = self.get(start..end)?.iter().position(|&c| c == byte)?;
-        Some(start + offset)
+        prefilter::find_code_units_u8(self, start, end, &[ch16])
+    }
+
+    #[inline(always)]
+    fn find_code_unit_in_set(self, start: usize, end: usize, set: &CodeUnitSet) -> Option<usize> {
+        prefilter::find_code_units_u8(self, start, end, set.as_slice())
+    }
+
+    #[inline(always)]
+    fn find_teddy_candidate(self, start: usize, teddy: &Teddy) -> Option<usize> {
+        teddy.find_u8(self, start)
     }
 
     #[inline(always)]
@@ -297,11 +338,14 @@ fn contains_u16_from<I: Input>(input: I, start: usize, needle: &[u16]) -> bool {
         return false;
     }
 
+    // Scan for the least common code unit of the needle, so that fewer
+    // candidates need to be verified.
+    let rare = prefilter::rarest_code_unit_index(needle);
     let mut pos = start;
     let end = input.len() - needle.len() + 1;
     while pos < end {
-        match input.find_code_unit(pos, end, needle[0]) {
-            Some(candidate_pos) => pos = candidate_pos,
+        match input.find_code_unit(pos + rare, end + rare, needle[rare]) {
+            Some(candidate_pos) => pos = candidate_pos - rare,
             None => return false,
         }
         if input.matches_u16_at(pos, needle) {
@@ -331,19 +375,15 @@ fn contains_ascii_case_insensitive_u16_from<I: Input>(input: I, start: usize, ne
         return false;
     }
 
-    let folded_first = fold_ascii_for_compare(needle[0]);
+    let Some(first) = ascii_case_variants(needle[0]) else {
+        return false;
+    };
     let mut pos = start;
     let end = input.len() - needle_len + 1;
     while pos < end {
-        while pos < end {
-            let code_unit = input.code_unit(pos);
-            if code_unit <= 0x7F && fold_ascii_for_compare(code_unit) == folded_first {
-                break;
-            }
-            pos += 1;
-        }
-        if pos >= end {
-            return false;
+        match input.find_code_unit_in_set(pos, end, &first) {
+            Some(candidate_pos) => pos = candidate_pos,
+            None => return false,
         }
         if matches_ascii_case_insensitive_u16_at(input, pos, needle) {
             return true;
@@ -353,6 +393,17 @@ fn contains_ascii_case_insensitive_u16_from<I: Input>(input: I, start: usize, ne
     false
 }
 
+/// The code units that match `ch` under ASCII case folding, or `None` if
+/// nothing does.
+#[inline(always)]
+pub(crate) fn ascii_case_variants(ch: u16) -> Option<CodeUnitSet> {
+    match ch {
+        0x41..=0x5A | 0x61..=0x7A => CodeUnitSet::new(&[ch | 0x20, ch & !0x20]),
+        0x00..=0x7F => CodeUnitSet::new(&[ch]),
+        _ => None,
+    }
+}
+
 #[inline(always)]
 fn matches_ascii_case_insensitive_u16_at<I: Input>(input: I, pos: usize, needle: &[u16]) -> bool {
     if pos + needle.len() > input.len() {
@@ -442,8 +493,17 @@ fn first_filter_matches<I: Input>(program: &Program, input: I, pos: usize, filte
 }
 
 #[inline(always)]
-fn next_candidate_start<I: Input>(program: &Program, input: I, hints: &PatternHints, mut pos: usize) -> Option<usize> {
+pub(crate) fn next_candidate_start<I: Input>(
+    program: &Program,
+    input: I,
+    hints: &PatternHints,
+    mut pos: usize,
+) -> Option<usize> {
     while pos <= input.len() {
+        if let Some(ref prefilter) = hints.prefilter {
+            pos = prefilter.find(input, pos)?;
+        }
+
         if program.unicode
             && !hints.can_match_empty
             && pos > 0
@@ -971,6 +1031,8 @@ pub struct PatternHints {
     first_char: Option<(u32, bool)>,
     /// First instruction filter: skip positions where the first matcher can't match.
     first_filter: Option<SimpleMatch>,
+    /// Vectorized search for positions that can begin a match, derived from the above.
+    prefilter: Option<Prefilter>,
     /// Leading alternatives that can only begin at position 0 or at one of a
     /// small set of literal code units.
     start_position_hint: Option<StartPositionHint>,
@@ -989,6 +1051,12 @@ pub struct PatternHints {
     can_match_empty: bool,
 }
 
+impl PatternHints {
+    pub(crate) fn can_match_empty(&self) -> bool {
+        self.can_match_empty
+    }
+}
+
 pub(crate) struct RequiredLiteralHint {
     pub literal: Vec<u16>,
     pub ascii_case_insensitive: bool,
@@ -1135,6 +1203,97 @@ fn next_literal_start_from_hint<I: Input>(input: I, start: usize, hint: &StartPo
     input.next_literal_start(start, *literal)
 }
 
+/// Pick a vectorized search for the positions where a match can begin. Every
+/// position the other start filters accept must also be found by it.
+fn analyze_prefilter(
+    program: &Program,
+    first_char: Option<(u32, bool)>,
+    first_filter: Option<&SimpleMatch>,
+    filter_inst: Option<&Instruction>,
+    filter_offset: usize,
+) -> Option<Prefilter> {
+    if let Some((ch, case_insensitive)) = first_char {
+        let ch16 = u16::try_from(ch).ok()?;
+        if !case_insensitive {
+            return Some(Prefilter::CodeUnits(CodeUnitSet::new(&[ch16])?));
+        }
+        let variants = ascii_case_variants(ch16)?;
+        // NB: Unicode case folding maps KELVIN SIGN to 'k' and LATIN SMALL
+        //     LETTER LONG S to 's'. No other non-ASCII code point folds into ASCII.
+        let extra = match ch16 | 0x20 {
+            0x6B if program.unicode => Some(0x212A),
+            0x73 if program.unicode => Some(0x017F),
+            _ => None,
+        };
+        let mut units = variants.as_slice().to_vec();
+        units.extend(extra);
+        return Some(Prefilter::CodeUnits(CodeUnitSet::new(&units)?));
+    }
+
+    if let Some(Instruction::Split { .. }) = filter_inst
+        && !program.ignore_case
+    {
+        let prefixes = leading_literal_prefixes(&program.instructions, filter_offset)?;
+        let first_units: Vec<u16> = prefixes.iter().map(|prefix| prefix[0]).collect();
+        if let Some(set) = CodeUnitSet::new(&first_units) {
+            return Some(Prefilter::CodeUnits(set));
+        }
+        return Teddy::new(&prefixes, false).map(|teddy| Prefilter::Teddy(Box::new(teddy)));
+    }
+
+    let units = match first_filter? {
+        SimpleMatch::Char(c) => vec![u16::try_from(*c).ok()?],
+        SimpleMatch::CharClass { ranges, negated: false } => {
+            let mut units = Vec::new();
+            for range in ranges {
+                if range.end > 0xFFFF || range.end.saturating_sub(range.start) >= 3 {
+                    return None;
+                }
+                units.extend((range.start..=range.end).map(|cp| cp as u16));
+                if units.len() > 3 {
+                    return None;
+                }
+            }
+            units
+        }
+        _ => return None,
+    };
+    Some(Prefilter::CodeUnits(CodeUnitSet::new(&units)?))
+}
+
+/// Collect the leading literal code units (up to 3) of each alternative in the
+/// Split chain at `start`, or `None` if some alternative doesn't begin with a
+/// literal.
+fn leading_literal_prefixes(instructions: &[Instruction], start: usize) -> Option<Vec<Vec<u16>>> {
+    let mut prefixes = Vec::new();
+    let mut pc = start;
+    loop {
+        match instructions.get(pc)? {
+            Instruction::Split { prefer, other } => {
+                prefixes.push(leading_literal_prefix_at(instructions, *prefer as usize)?);
+                pc = *other as usize;
+            }
+            _ => {
+                prefixes.push(leading_literal_prefix_at(instructions, pc)?);
+                return Some(prefixes);
+            }
+        }
+    }
+}
+
+fn leading_literal_prefix_at(instructions: &[Instruction], mut pc: usize) -> Option<Vec<u16>> {
+    let mut prefix = Vec::new();
+    while prefix.len() < 3 {
+        match instructions.get(pc) {
+            Some(Instruction::Char(c)) if *c <= 0xFFFF => prefix.push(*c as u16),
+            Some(Instruction::Save(_) | Instruction::Nop) => {}
+            _ => break,
+        }
+        pc += 1;
+    }
+    if prefix.is_empty() { None } else { Some(prefix) }
+}
+
 /// Analyze the program to extract optimization hints.
 pub(crate) fn analyze_pattern(
     program: &Program,
@@ -1184,6 +1343,8 @@ pub(crate) fn analyze_pattern(
         None
     };
 
+    let prefilter = analyze_prefilter(program, first_char, first_filter.as_ref(), filter_inst, filter_offset);
+
     let start_position_hint = if !program.unicode {
         analyze_start_position_hint(&program.instructions, filter_offset)
     } else {
@@ -1265,6 +1426,7 @@ pub(crate) fn analyze_pattern(
     PatternHints {
         first_char,
         first_filter,
+        prefilter,
         start_position_hint,
         starts_with_anchor,
         anchor_multiline,
@@ -1355,12 +1517,28 @@ pub struct VmScratch {
     backtrack_stack: Vec<SavedState>,
     register_pool: Vec<i32>,
     modifier_stack: Vec<ActiveModifiers>,
+    step_budget: Option<u64>,
 }
 
 impl VmScratch {
     pub fn new() -> Self {
         Self::default()
     }
+
+    /// Approximate number of heap bytes held on to for reuse across searches.
+    pub fn heap_size(&self) -> usize {
+        self.registers.capacity() * size_of::<i32>()
+            + self.backtrack_stack.capacity() * size_of::<SavedState>()
+            + self.register_pool.capacity() * size_of::<i32>()
+            + self.modifier_stack.capacity() * size_of::<ActiveModifiers>()
+    }
+
+    /// Replace the per-attempt `MATCH_LIMIT` with a budget shared by all
+    /// start positions of a single search. Used when a linear-time engine can
+    /// take over, so that backtracking gives up long before it goes quadratic.
+    pub(crate) fn set_step_budget(&mut self, budget: Option<u64>) {
+        self.step_budget = budget;
+    }
 }
 
 struct Vm<'a, I: Input> {
@@ -1374,6 +1552,9 @@ struct Vm<'a, I: Input> {
     /// this pool. Avoids per-Split Vec allocation.
     register_pool: &'a mut Vec<i32>,
     steps: u64,
+    step_limit: u64,
+    /// Whether `steps` accumulates across start positions, see `VmScratch::set_step_budget()`.
+    cumulative_steps: bool,
     modifiers: ActiveModifiers,
     modifier_stack: &'a mut Vec<ActiveModifiers>,
     /// True when executing a lookbehind body (characters consumed right-to-left).
@@ -1400,6 +1581,8 @@ impl<'a, I: Input> Vm<'a, I> {
             backtrack_stack: &mut scratch.backtrack_stack,
             register_pool: &mut scratch.register_pool,
             steps: 0,
+            step_limit: scratch.step_budget.unwrap_or(MATCH_LIMIT),
+            cumulative_steps: scratch.step_budget.is_some(),
             modifiers: ActiveModifiers {
                 ignore_case: program.ignore_case,
                 multiline: program.multiline,
@@ -1430,7 +1613,9 @@ impl<'a, I: Input> Vm<'a, I> {
         self.registers.fill(-1);
         self.backtrack_stack.clear();
         self.register_pool.clear();
-        self.steps = 0;
+        if !self.cumulative_steps {
+            self.steps = 0;
+        }
         self.modifiers = ActiveModifiers {
             ignore_case: self.program.ignore_case,
             multiline: self.program.multiline,
@@ -1458,7 +1643,7 @@ impl<'a, I: Input> Vm<'a, I> {
         let input_len = input.len();
         'vm_loop: loop {
             self.steps += 1;
-            if self.steps >= MATCH_LIMIT {
+            if self.steps >= self.step_limit {
                 return VmResult::LimitExceeded;
             }
 
@@ -1821,7 +2006,7 @@ impl<'a, I: Input> Vm<'a, I> {
         let num_instructions = instructions.len();
         'vm_loop: loop {
             self.steps += 1;
-            if self.steps >= MATCH_LIMIT {
+            if self.steps >= self.step_limit {
                 return VmResult::LimitExceeded;
             }
 
@@ -3457,7 +3642,7 @@ fn is_word_char(cp: u32) -> bool {
 /// definition, including the Unicode ignore-case extension when requested.
 /// <https://tc39.es/ecma262/#sec-wordcharacters>
 #[inline(always)]
-fn is_word_char_unicode(cp: u32, unicode_ignore_case: bool) -> bool {
+pub(crate) fn is_word_char_unicode(cp: u32, unicode_ignore_case: bool) -> bool {
     if is_word_char(cp) {
         return true;
     }
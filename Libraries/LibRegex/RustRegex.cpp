@@ -48,6 +48,7 @@ CompiledRustRegex::~CompiledRustRegex()
 {
     if (m_regex)
         rust_regex_free(m_regex);
+    free_cranelift_code(m_native_code);
 }
 
 CompiledRustRegex::CompiledRustRegex(CompiledRustRegex&& other)
@@ -57,8 +58,10 @@ CompiledRustRegex::CompiledRustRegex(CompiledRustRegex&& other)
     , m_capture_count(other.m_capture_count)
     , m_capture_count_cached(other.m_capture_count_cached)
     , m_find_all_buffer(move(other.m_find_all_buffer))
+    , m_native_code(other.m_native_code)
 {
     other.m_regex = nullptr;
+    other.m_native_code = nullptr;
     other.m_capture_count = 0;
     other.m_capture_count_cached = false;
 }
@@ -68,13 +71,16 @@ CompiledRustRegex& CompiledRustRegex::operator=(CompiledRustRegex&& other)
     if (this != &other) {
         if (m_regex)
             rust_regex_free(m_regex);
+        free_cranelift_code(m_native_code);
         m_regex = other.m_regex;
         m_named_groups = move(other.m_named_groups);
         m_capture_buffer = move(other.m_capture_buffer);
         m_capture_count = other.m_capture_count;
         m_capture_count_cached = other.m_capture_count_cached;
         m_find_all_buffer = move(other.m_find_all_buffer);
+        m_native_code = other.m_native_code;
         other.m_regex = nullptr;
+        other.m_native_code = nullptr;
         other.m_capture_count = 0;
         other.m_capture_count_cached = false;
     }
@@ -95,25 +101,28 @@ int CompiledRustRegex::exec_internal(Utf16View input, size_t start_pos) const
     auto slots = m_capture_count * 2;
     m_capture_buffer.resize(slots);
 
+    int result;
     if (input.has_ascii_storage()) {
         auto ascii = input.ascii_span();
-        return rust_regex_exec_into_ascii(
+        result = rust_regex_exec_into_ascii(
             m_regex,
             reinterpret_cast<uint8_t const*>(ascii.data()),
             ascii.size(),
             start_pos,
             m_capture_buffer.data(),
             slots);
+    } else {
+        auto utf16 = input.utf16_span();
+        result = rust_regex_exec_into(
+            m_regex,
+            reinterpret_cast<unsigned short const*>(utf16.data()),
+            utf16.size(),
+            start_pos,
+            m_capture_buffer.data(),
+            slots);
     }
-
-    auto utf16 = input.utf16_span();
-    return rust_regex_exec_into(
-        m_regex,
-        reinterpret_cast<unsigned short const*>(utf16.data()),
-        utf16.size(),
-        start_pos,
-        m_capture_buffer.data(),
-        slots);
+    compile_native_code_if_hot();
+    return result;
 }
 
 unsigned int CompiledRustRegex::total_groups() const
@@ -132,21 +141,42 @@ bool CompiledRustRegex::is_single_non_bmp_literal() const
 
 int CompiledRustRegex::test(Utf16View input, size_t start_pos) const
 {
+    int result;
     if (input.has_ascii_storage()) {
         auto ascii = input.ascii_span();
-        return rust_regex_test_ascii(
+        result = rust_regex_test_ascii(
             m_regex,
             reinterpret_cast<uint8_t const*>(ascii.data()),
             ascii.size(),
             start_pos);
+    } else {
+        auto utf16 = input.utf16_span();
+        result = rust_regex_test(
+            m_regex,
+            reinterpret_cast<unsigned short const*>(utf16.data()),
+            utf16.size(),
+            start_pos);
     }
+    compile_native_code_if_hot();
+    return result;
+}
 
-    auto utf16 = input.utf16_span();
-    return rust_regex_test(
-        m_regex,
-        reinterpret_cast<unsigned short const*>(utf16.data()),
-        utf16.size(),
-        start_pos);
+size_t CompiledRustRegex::memory_footprint() const
+{
+    size_t footprint = rust_regex_heap_size(m_regex) + cranelift_code_size(m_native_code);
+    footprint += m_capture_buffer.capacity() * sizeof(int);
+    footprint += m_find_all_buffer.capacity() * sizeof(int);
+    footprint += m_named_groups.capacity() * sizeof(RustNamedCaptureGroup);
+    for (auto const& group : m_named_groups)
+        footprint += group.name.byte_count();
+    return footprint;
+}
+
+void CompiledRustRegex::compile_native_code_if_hot() const
+{
+    if (m_native_code)
+        return;
+    m_native_code = try_cranelift_compile(m_regex);
 }
 
 int CompiledRustRegex::find_all(Utf16View input, size_t start_pos) const
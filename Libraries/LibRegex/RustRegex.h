@@ -58,9 +58,15 @@ public:
 
     Vector<RustNamedCaptureGroup> const& named_groups() const { return m_named_groups; }
 
+    /// Approximate number of bytes this regex occupies, including its native code and the scratch and result buffers
+    /// that grow as it is used.
+    size_t memory_footprint() const;
+
 private:
     explicit CompiledRustRegex(RustRegex* regex);
 
+    void compile_native_code_if_hot() const;
+
     RustRegex* m_regex { nullptr };
     Vector<RustNamedCaptureGroup> m_named_groups;
     /// Pre-allocated buffer for capture results to avoid per-exec allocation.
@@ -69,6 +75,15 @@ private:
     mutable bool m_capture_count_cached { false };
     /// Buffer for find_all results.
     mutable Vector<int> m_find_all_buffer;
+    /// Executable mapping holding the native matchers, once the regex got hot enough to compile.
+    mutable void* m_native_code { nullptr };
 };
 
+/// Compile a regex that became hot to native code and install it. Returns a
+/// handle to the code mapping, or null if there was nothing to compile.
+void* try_cranelift_compile(RustRegex*);
+void free_cranelift_code(void*);
+/// Size of the executable mapping behind a handle from try_cranelift_compile(), or 0 for null.
+size_t cranelift_code_size(void*);
+
 } // namespace regex
@@ -50,11 +50,14 @@ void RequestClient::die()
 
     for (auto& [id, promise] : m_pending_cache_size_estimations)
         promise->reject(Error::from_string_literal("RequestServer process died"));
+    for (auto& [id, promise] : m_pending_shared_cache_retrievals)
+        promise->reject(Error::from_string_literal("RequestServer process died"));
 
     auto websockets = move(m_websockets);
 
     m_requests.clear();
     m_pending_cache_size_estimations.clear();
+    m_pending_shared_cache_retrievals.clear();
     m_websockets.clear();
 
     for (auto& [id, websocket] : websockets) {
@@ -102,6 +105,33 @@ ErrorOr<Optional<Core::AnonymousBuffer>> RequestClient::retrieve_cache_associate
     return IPCProxy::retrieve_cache_associated_data(url, method, headers, vary_key, associated_data);
 }
 
+ErrorOr<void> RequestClient::store_shared_cache_associated_data(ReadonlyBytes content_hash, HTTP::CacheEntryAssociatedData associated_data, ReadonlyBytes data)
+{
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(data.size()));
+    memcpy(buffer.data<void>(), data.data(), data.size());
+
+    async_store_shared_cache_associated_data(TRY(ByteBuffer::copy(content_hash)), associated_data, move(buffer));
+    return {};
+}
+
+NonnullRefPtr<Core::Promise<Optional<Core::ImmutableBytes>>> RequestClient::retrieve_shared_cache_associated_data(ReadonlyBytes content_hash, HTTP::CacheEntryAssociatedData associated_data)
+{
+    auto promise = Core::Promise<Optional<Core::ImmutableBytes>>::construct();
+
+    auto content_hash_buffer = ByteBuffer::copy(content_hash);
+    if (content_hash_buffer.is_error()) {
+        promise->reject(content_hash_buffer.release_error());
+        return promise;
+    }
+
+    auto shared_cache_retrieval_id = m_next_shared_cache_retrieval_id++;
+    m_pending_shared_cache_retrievals.set(shared_cache_retrieval_id, promise);
+
+    async_retrieve_shared_cache_associated_data(shared_cache_retrieval_id, content_hash_buffer.release_value(), associated_data);
+
+    return promise;
+}
+
 bool RequestClient::stop_request(Badge<Request>, Request& request)
 {
     if (!m_requests.contains(request.id()))
@@ -140,6 +170,26 @@ void RequestClient::estimated_cache_size(u64 cache_size_estimation_id, CacheSize
         (*promise)->resolve(sizes);
 }
 
+void RequestClient::shared_cache_associated_data_retrieved(u64 shared_cache_retrieval_id, Optional<IPC::File> file, u64 size)
+{
+    auto promise = m_pending_shared_cache_retrievals.take(shared_cache_retrieval_id);
+    if (!promise.has_value())
+        return;
+
+    if (!file.has_value()) {
+        (*promise)->resolve(Optional<Core::ImmutableBytes> {});
+        return;
+    }
+
+    auto data = map_javascript_bytecode_file(file->take_fd(), size);
+    if (data.is_error()) {
+        (*promise)->reject(data.release_error());
+        return;
+    }
+
+    (*promise)->resolve(data.release_value());
+}
+
 void RequestClient::request_started(u64 request_id, IPC::File response_file)
 {
     auto request = m_requests.get(request_id);
@@ -8,6 +8,7 @@
 
 #include <AK/HashMap.h>
 #include <LibCore/AnonymousBuffer.h>
+#include <LibCore/ImmutableBytes.h>
 #include <LibHTTP/Cache/CacheMode.h>
 #include <LibHTTP/Cache/Utilities.h>
 #include <LibHTTP/Cookie/IncludeCredentials.h>
@@ -46,6 +47,8 @@ public:
     NonnullRefPtr<Core::Promise<CacheSizes>> estimate_cache_size_accessed_since(UnixDateTime since);
     ErrorOr<bool> store_cache_associated_data(URL::URL const&, ByteString const& method, Optional<HTTP::HeaderList const&> request_headers, Optional<u64> vary_key, HTTP::CacheEntryAssociatedData, ReadonlyBytes);
     ErrorOr<Optional<Core::AnonymousBuffer>> retrieve_cache_associated_data(URL::URL const&, ByteString const& method, Optional<HTTP::HeaderList const&> request_headers, Optional<u64> vary_key, HTTP::CacheEntryAssociatedData);
+    ErrorOr<void> store_shared_cache_associated_data(ReadonlyBytes content_hash, HTTP::CacheEntryAssociatedData, ReadonlyBytes);
+    NonnullRefPtr<Core::Promise<Optional<Core::ImmutableBytes>>> retrieve_shared_cache_associated_data(ReadonlyBytes content_hash, HTTP::CacheEntryAssociatedData);
 
     Function<String(URL::URL const&)> on_retrieve_http_cookie;
     Function<void()> on_request_server_died;
@@ -72,6 +75,7 @@ private:
     virtual void websocket_certificate_requested(u64 websocket_id) override;
 
     virtual void estimated_cache_size(u64 cache_size_estimation_id, CacheSizes sizes) override;
+    virtual void shared_cache_associated_data_retrieved(u64 shared_cache_retrieval_id, Optional<IPC::File>, u64 size) override;
 
     HashMap<u64, RefPtr<Request>> m_requests;
     u64 m_next_request_id { 0 };
@@ -81,6 +85,9 @@ private:
 
     HashMap<u64, NonnullRefPtr<Core::Promise<CacheSizes>>> m_pending_cache_size_estimations;
     u64 m_next_cache_size_estimation_id { 0 };
+
+    HashMap<u64, NonnullRefPtr<Core::Promise<Optional<Core::ImmutableBytes>>>> m_pending_shared_cache_retrievals;
+    u64 m_next_shared_cache_retrieval_id { 0 };
 };
 
 }
@@ -7,6 +7,7 @@
  */
 
 #include <AK/Array.h>
+#include <AK/BinarySearch.h>
 #include <AK/NumericLimits.h>
 #include <AK/StringBuilder.h>
 #include <AK/UnicodeUtils.h>
@@ -47,10 +48,15 @@
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/MimeSniff/MimeType.h>
+#include <LibWeb/Platform/Timer.h>
 #include <LibWeb/WebAssembly/WebAssemblyModule.h>
 
 namespace Web::HTML {
 
+// How long a freshly compiled script gets to run before we record which of its functions were called. Those functions
+// are predecoded ahead of their first call whenever the script is later loaded from the bytecode cache.
+static constexpr int bytecode_cache_profile_window_ms = 5000;
+
 struct OffThreadCompiledProgram {
     JS::FFI::ParsedProgram* parsed { nullptr };
     JS::FFI::CompiledProgram* compiled { nullptr };
@@ -103,13 +109,22 @@ struct BytecodeCacheInstallTarget {
         }
         VERIFY_NOT_REACHED();
     }
+
+    Vector<u32> bytecode_cache_offsets_of_called_functions() const
+    {
+        if (auto script_record = script.ptr())
+            return script_record->bytecode_cache_offsets_of_called_functions();
+        if (auto module_record = module.ptr())
+            return module_record->bytecode_cache_offsets_of_called_functions();
+        return {};
+    }
 };
 
-static ::Crypto::Hash::Digest<::Crypto::Hash::SHA256::DigestSize * 8> bytecode_cache_source_hash(JS::SourceCode const& source_code)
+static ::Crypto::Hash::Digest<::Crypto::Hash::SHA256::DigestSize * 8> bytecode_cache_source_hash(Utf16View const& code)
 {
-    if (source_code.code_view().has_ascii_storage()) {
+    if (code.has_ascii_storage()) {
         auto hasher = ::Crypto::Hash::SHA256::create();
-        auto ascii = source_code.code_view().ascii_span();
+        auto ascii = code.ascii_span();
 
         constexpr size_t chunk_size = 4096;
         Array<u16, chunk_size> utf16_data;
@@ -124,7 +139,7 @@ static ::Crypto::Hash::Digest<::Crypto::Hash::SHA256::DigestSize * 8> bytecode_c
         return hasher->digest();
     }
 
-    return ::Crypto::Hash::SHA256::hash(reinterpret_cast<u8 const*>(source_code.utf16_data()), source_code.length_in_code_units() * sizeof(u16));
+    return ::Crypto::Hash::SHA256::hash(reinterpret_cast<u8 const*>(code.utf16_span().data()), code.length_in_code_units() * sizeof(u16));
 }
 
 struct DecodedSourceTextInfo {
@@ -234,19 +249,65 @@ static Optional<BytecodeCacheContext> bytecode_cache_context_for_request(Fetch::
     };
 }
 
+// Bytecode only depends on the source text it was compiled from, so the same library served from many URLs can share a
+// single blob. This is consulted when the response has no bytecode of its own; the blob is still validated against the
+// source hash and during materialization, exactly like a per-URL blob.
+// The lookup is an asynchronous round trip to RequestServer, so that a cache miss does not block the main thread.
+static void retrieve_bytecode_cache(Optional<Core::ImmutableBytes> response_bytecode, Optional<DecodedSourceTextInfo> const& source_text_info, Function<void(Optional<Core::ImmutableBytes>)> on_retrieved)
+{
+    if (response_bytecode.has_value() || !source_text_info.has_value() || !ResourceLoader::is_initialized() || !ResourceLoader::the().request_client()) {
+        on_retrieved(move(response_bytecode));
+        return;
+    }
+
+    auto callback = GC::make_root(GC::create_function(Bindings::main_thread_vm().heap(), move(on_retrieved)));
+
+    ResourceLoader::the().request_client()->retrieve_shared_cache_associated_data(source_text_info->hash.bytes(), HTTP::CacheEntryAssociatedData::JavaScriptBytecode)
+        ->when_resolved([callback](Optional<Core::ImmutableBytes>& bytecode) {
+            callback->function()(move(bytecode));
+            // AD-HOC: See compile_off_thread(); the callback may complete a module fetch, which queues promise reactions.
+            perform_a_microtask_checkpoint();
+        })
+        .when_rejected([callback](Error const&) {
+            callback->function()({});
+            perform_a_microtask_checkpoint();
+        });
+}
+
+// Once the script has had a chance to run, record which of its functions were called into the hot function profile of
+// its bytecode cache blob and store the blob again. Only the profile at the end of the blob is rewritten.
+static void schedule_bytecode_cache_profile_recording(Core::ImmutableBytes blob, ::Crypto::Hash::Digest<::Crypto::Hash::SHA256::DigestSize * 8> source_hash, BytecodeCacheContext cache_context, BytecodeCacheInstallTarget install_target)
+{
+    auto& heap = Bindings::main_thread_vm().heap();
+    Platform::Timer::create_single_shot(heap, bytecode_cache_profile_window_ms, GC::create_function(heap, [blob = move(blob), source_hash, cache_context = move(cache_context), install_target = move(install_target)] {
+        auto hot_function_offsets = install_target.bytecode_cache_offsets_of_called_functions();
+        if (hot_function_offsets.is_empty())
+            return;
+
+        auto profiled_blob = JS::RustIntegration::bytecode_cache_blob_with_hot_function_offsets(blob.bytes(), hot_function_offsets);
+        if (profiled_blob.is_empty())
+            return;
+
+        if (!ResourceLoader::is_initialized() || !ResourceLoader::the().request_client())
+            return;
+        (void)ResourceLoader::the().request_client()->store_cache_associated_data(cache_context.url, cache_context.method, *cache_context.request_headers, cache_context.vary_key, HTTP::CacheEntryAssociatedData::JavaScriptBytecode, profiled_blob);
+        (void)ResourceLoader::the().request_client()->store_shared_cache_associated_data(source_hash.bytes(), HTTP::CacheEntryAssociatedData::JavaScriptBytecode, profiled_blob);
+    }))->start();
+}
+
 // Schedule a fresh, fully off-thread compile of the script source for the purpose of producing a bytecode cache blob.
 // The execution path has already received its (latency-trimmed) compile artifact and is running, so this work happens
 // entirely on a background thread and never blocks the main thread on cache generation.
 // Reparsing here is intentional: the execution-path compile only eagerly generates top-level bytecode plus direct
 // IIFEs, while the cache wants every nested function compiled so that warm loads avoid lazy compile work entirely. Once
 // the blob is back on the main thread, try to install that same blob into the live script/module before storing it.
-static void schedule_bytecode_cache_generation(NonnullRefPtr<JS::SourceCode const> original_source_code, JS::RustIntegration::ProgramType type, size_t line_number_offset, BytecodeCacheContext cache_context, BytecodeCacheInstallTarget install_target)
+static void schedule_bytecode_cache_generation(NonnullRefPtr<JS::SourceCode const> original_source_code, ::Crypto::Hash::Digest<::Crypto::Hash::SHA256::DigestSize * 8> source_hash, JS::RustIntegration::ProgramType type, size_t line_number_offset, BytecodeCacheContext cache_context, BytecodeCacheInstallTarget install_target)
 {
     auto filename = original_source_code->filename();
     auto source_code = original_source_code->code();
     auto event_loop_weak = Core::EventLoop::current_weak();
-    auto* callback = new Function<void(ByteBuffer, ::Crypto::Hash::Digest<::Crypto::Hash::SHA256::DigestSize * 8>)>(
-        [cache_context = move(cache_context), install_target = move(install_target), original_source_code = move(original_source_code), type](ByteBuffer blob, auto source_hash) mutable {
+    auto* callback = new Function<void(ByteBuffer)>(
+        [cache_context = move(cache_context), install_target = move(install_target), original_source_code = move(original_source_code), source_hash, type](ByteBuffer blob) mutable {
             if (blob.is_empty()) {
                 install_target.finish_generation_without_install();
                 return;
@@ -258,11 +319,13 @@ static void schedule_bytecode_cache_generation(NonnullRefPtr<JS::SourceCode cons
             if (!ResourceLoader::is_initialized() || !ResourceLoader::the().request_client())
                 return;
             (void)ResourceLoader::the().request_client()->store_cache_associated_data(cache_context.url, cache_context.method, *cache_context.request_headers, cache_context.vary_key, HTTP::CacheEntryAssociatedData::JavaScriptBytecode, immutable_blob.bytes());
+            (void)ResourceLoader::the().request_client()->store_shared_cache_associated_data(source_hash.bytes(), HTTP::CacheEntryAssociatedData::JavaScriptBytecode, immutable_blob.bytes());
+            schedule_bytecode_cache_profile_recording(move(immutable_blob), source_hash, move(cache_context), move(install_target));
         });
 
-    Threading::ThreadPool::the().submit([filename = move(filename), source_code = move(source_code), type, line_number_offset, callback, event_loop_weak = move(event_loop_weak)]() mutable {
+    // The source hash was already computed off-thread while the response was being decoded, so it is not recomputed here.
+    Threading::ThreadPool::the().submit([filename = move(filename), source_code = move(source_code), source_hash, type, line_number_offset, callback, event_loop_weak = move(event_loop_weak)]() mutable {
         auto source = JS::SourceCode::create(move(filename), move(source_code));
-        auto source_hash = bytecode_cache_source_hash(*source);
         ByteBuffer blob;
 
         auto* parsed = JS::RustIntegration::parse_program(source->utf16_data(), source->length_in_code_units(), type, line_number_offset);
@@ -282,8 +345,8 @@ static void schedule_bytecode_cache_generation(NonnullRefPtr<JS::SourceCode cons
         if (!origin)
             return;
 
-        origin->deferred_invoke([blob = move(blob), source_hash, callback]() mutable {
-            (*callback)(move(blob), source_hash);
+        origin->deferred_invoke([blob = move(blob), callback]() mutable {
+            (*callback)(move(blob));
             delete callback;
         });
     });
@@ -356,6 +419,99 @@ static void compile_remaining_functions_off_thread(JS::Bytecode::Executable& exe
     });
 }
 
+// Decode and validate the cached bytecode of the functions recorded as hot in the bytecode cache on the thread pool,
+// then materialize them on the main thread so their first call doesn't have to. Functions nested in a hot function only
+// get their SharedFunctionInstanceData once it has been materialized, so each batch of new executables is walked again.
+// NB: The worker thread only sees clones of the lazy cache records. They are made and freed on the main thread, which
+//     keeps the (non-thread-safe) blob owner refcounting off the worker.
+static void predecode_hot_functions_off_thread(Vector<GC::Root<JS::Bytecode::Executable>> executables, Vector<u32> hot_function_offsets)
+{
+    if (hot_function_offsets.is_empty())
+        return;
+
+    Vector<GC::Root<JS::SharedFunctionInstanceData>> shared_data_roots;
+    Vector<void*> cached_executables;
+
+    for (auto& executable : executables) {
+        for (auto& shared_data : executable->shared_function_data) {
+            if (!shared_data || shared_data->m_executable || !shared_data->m_cached_bytecode_executable)
+                continue;
+            if (!binary_search(hot_function_offsets, shared_data->bytecode_cache_source_text_offset()))
+                continue;
+
+            auto* cloned_executable = JS::RustIntegration::clone_cached_bytecode_executable(shared_data->m_cached_bytecode_executable);
+            if (!cloned_executable)
+                continue;
+
+            shared_data_roots.append(GC::make_root(*shared_data));
+            cached_executables.append(cloned_executable);
+        }
+    }
+
+    if (cached_executables.is_empty())
+        return;
+
+    auto* callback = new Function<void(Vector<void*>, Vector<void*>)>(
+        [shared_data_roots = move(shared_data_roots), hot_function_offsets = move(hot_function_offsets)](Vector<void*> cached_executables, Vector<void*> predecoded_executables) mutable {
+            VERIFY(predecoded_executables.size() == shared_data_roots.size());
+            for (auto* cached_executable : cached_executables)
+                JS::RustIntegration::free_cached_bytecode_executable(cached_executable);
+
+            auto& vm = Bindings::main_thread_vm();
+            Vector<GC::Root<JS::Bytecode::Executable>> materialized_executables;
+            for (size_t i = 0; i < predecoded_executables.size(); ++i) {
+                auto* predecoded_executable = predecoded_executables[i];
+                if (!predecoded_executable)
+                    continue;
+
+                auto& shared_data = *shared_data_roots[i];
+                auto executable = JS::RustIntegration::materialize_predecoded_bytecode_executable(vm, shared_data, predecoded_executable);
+                if (!executable)
+                    continue;
+
+                shared_data.set_executable(executable);
+                executable->name = shared_data.m_name;
+                shared_data.clear_compile_inputs();
+                materialized_executables.append(GC::make_root(*executable));
+            }
+            predecode_hot_functions_off_thread(move(materialized_executables), move(hot_function_offsets));
+        });
+
+    auto event_loop_weak = Core::EventLoop::current_weak();
+
+    Threading::ThreadPool::the().submit([cached_executables = move(cached_executables), callback, event_loop_weak = move(event_loop_weak)]() mutable {
+        Vector<void*> predecoded_executables;
+        predecoded_executables.ensure_capacity(cached_executables.size());
+        for (auto* cached_executable : cached_executables)
+            predecoded_executables.append(JS::RustIntegration::predecode_cached_bytecode_executable(cached_executable));
+
+        auto origin = event_loop_weak->take();
+        if (!origin)
+            return;
+        origin->deferred_invoke([cached_executables = move(cached_executables), predecoded_executables = move(predecoded_executables), callback]() mutable {
+            (*callback)(move(cached_executables), move(predecoded_executables));
+            delete callback;
+        });
+    });
+}
+
+static void predecode_hot_module_functions_off_thread(ModuleScript& module_script, Vector<u32> hot_function_offsets)
+{
+    module_script.record().visit(
+        [](Empty) {},
+        [](GC::Ref<JS::SyntheticModule>) {},
+        [](GC::Ref<WebAssembly::WebAssemblyModule>) {},
+        [&](GC::Ref<JS::SourceTextModule> module) {
+            auto* executable = module->cached_executable();
+            if (!executable) {
+                if (auto* top_level_await_shared_data = module->top_level_await_shared_data())
+                    executable = top_level_await_shared_data->m_executable.ptr();
+            }
+            if (executable)
+                predecode_hot_functions_off_thread({ GC::make_root(*executable) }, move(hot_function_offsets));
+        });
+}
+
 static void compile_remaining_module_functions_off_thread(ModuleScript& module_script, NonnullRefPtr<JS::SourceCode const> source_code)
 {
     module_script.record().visit(
@@ -420,6 +576,58 @@ static void compile_off_thread(NonnullRefPtr<JS::SourceCode const> source_code,
     });
 }
 
+struct OffThreadDecodedSourceText {
+    Optional<DecodedSourceTextInfo> info;
+    Optional<Utf16String> code;
+};
+
+// Decode a fetched source text to UTF-16 and/or compute its bytecode cache hash on the thread pool, then bounce back to
+// the main thread via deferred_invoke. Both are linear passes over the whole body, and a module graph runs one per
+// dependency, so doing them on the main thread serializes work that is otherwise spread across the pool.
+// NB: Like compile_off_thread(), the body bytes stay on the main thread inside the heap-allocated callback and the
+//     worker only borrows them, since ImmutableBytes is not safe to ref or unref from another thread.
+static void decode_source_text_off_thread(TextCodec::Decoder& fallback_decoder, Core::ImmutableBytes source_bytes, bool compute_info, bool decode_code, Function<void(OffThreadDecodedSourceText, Core::ImmutableBytes)> on_decoded)
+{
+    VERIFY(compute_info || decode_code);
+    auto bytes = source_bytes.bytes();
+
+    auto* callback = new Function<void(OffThreadDecodedSourceText)>(
+        [on_decoded = move(on_decoded), source_bytes = move(source_bytes)](OffThreadDecodedSourceText result) mutable {
+            on_decoded(move(result), move(source_bytes));
+        });
+
+    auto event_loop_weak = Core::EventLoop::current_weak();
+
+    Threading::ThreadPool::the().submit([decoder = &fallback_decoder, bytes, compute_info, decode_code,
+                                            callback,
+                                            event_loop_weak = move(event_loop_weak)]() mutable {
+        OffThreadDecodedSourceText result;
+        if (decode_code) {
+            // Hash the decoded text directly rather than making a second decoding pass for it.
+            auto code = Utf16String::from_utf8(decode_source_text(*decoder, bytes).release_value_but_fixme_should_propagate_errors());
+            if (compute_info) {
+                result.info = DecodedSourceTextInfo {
+                    .hash = bytecode_cache_source_hash(code.utf16_view()),
+                    .length_in_code_units = code.length_in_code_units(),
+                };
+            }
+            result.code = move(code);
+        } else {
+            result.info = decoded_source_text_info(*decoder, bytes).release_value_but_fixme_should_propagate_errors();
+        }
+
+        auto origin = event_loop_weak->take();
+        if (!origin)
+            return;
+        origin->deferred_invoke([result = move(result), callback]() mutable {
+            (*callback)(move(result));
+            delete callback;
+            // AD-HOC: See compile_off_thread(); the callback may complete a module fetch, which queues promise reactions.
+            perform_a_microtask_checkpoint();
+        });
+    });
+}
+
 GC_DEFINE_ALLOCATOR(FetchContext);
 
 OnFetchScriptComplete create_on_fetch_script_complete(GC::Heap& heap, Function<void(GC::Ptr<Script>)> function)
@@ -765,67 +973,85 @@ void fetch_classic_script(GC::Ref<HTMLScriptElement> element, URL::URL const& ur
         // FIXME: Pass options.
         auto response_url = response->url().value_or({});
 
-        // If the Rust pipeline is available, parse off the main thread.
+        // If the Rust pipeline is available, decode and parse off the main thread.
         if (JS::RustIntegration::rust_pipeline_available()) {
             auto on_complete_root = GC::make_root(on_complete);
             auto settings_root = GC::make_root(settings_object);
-            auto response_url_string = response_url.to_byte_string();
-            auto source_bytes = body_bytes_view(body_bytes);
-            auto const& bytecode = response->javascript_bytecode_cache();
-            Optional<DecodedSourceTextInfo> source_text_info;
-            if (bytecode.has_value())
-                source_text_info = decoded_source_text_info(*fallback_decoder, source_bytes).release_value_but_fixme_should_propagate_errors();
-            auto source_code_filename = String::from_utf8(response_url_string.view()).release_value_but_fixme_should_propagate_errors();
-            auto source_code = [&] {
-                if (source_text_info.has_value()) {
-                    return JS::SourceCode::create(
-                        move(source_code_filename),
-                        source_text_info->length_in_code_units,
-                        String::from_utf8(extracted_character_encoding).release_value_but_fixme_should_propagate_errors(),
-                        take_body_bytes(body_bytes));
-                }
-                return JS::SourceCode::create(move(source_code_filename), Utf16String::from_utf8(decode_source_text(*fallback_decoder, source_bytes).release_value_but_fixme_should_propagate_errors()));
-            }();
+            auto bytecode = response->javascript_bytecode_cache();
             auto bytecode_cache_context = bytecode_cache_context_for_request(*request, *response, response_url);
-            // Warm-cache fast path: a sidecar arrived with the response, decode it, and try to materialize a script
-            // straight from the cached bytecode without parsing or compiling. Pass non-moved source_code / response_url
-            // so the fallback compile path below can reuse them if decode or materialization is rejected.
-            if (bytecode.has_value()) {
-                VERIFY(source_text_info.has_value());
-                if (auto* bytecode_cache = JS::RustIntegration::decode_bytecode_cache_blob(*bytecode, JS::RustIntegration::ProgramType::Script, source_text_info->hash.bytes())) {
-                    auto script = ClassicScript::create_from_bytecode_cache(response_url_string, source_code, settings_object, response_url, bytecode_cache, muted_errors);
-                    // Bytecode validation runs during materialization and may reject a structurally valid blob whose
-                    // bytecode is corrupt. Treat that as a cache miss and fall through to off-thread source compile.
-                    if (script->parse_error().is_null()) {
-                        on_complete->function()(script);
-                        return;
-                    }
-                }
-            }
-
-            compile_off_thread(move(source_code), JS::RustIntegration::ProgramType::Script, 1,
-                [response_url = move(response_url), response_url_string = move(response_url_string),
+            auto source_encoding = String::from_utf8(extracted_character_encoding).release_value_but_fixme_should_propagate_errors();
+            // The source hash is only needed to validate, look up or generate a bytecode cache. The full UTF-16 decode is
+            // only needed if we end up compiling, which is unlikely when the response came with bytecode.
+            auto compute_source_text_info = bytecode.has_value() || bytecode_cache_context.has_value();
+            auto decode_code = !bytecode.has_value();
+            decode_source_text_off_thread(*fallback_decoder, take_body_bytes(body_bytes), compute_source_text_info, decode_code,
+                [response_url = move(response_url), response_bytecode = move(bytecode),
                     bytecode_cache_context = move(bytecode_cache_context),
-                    muted_errors, on_complete_root = move(on_complete_root),
-                    settings_root = move(settings_root)](auto result, auto source_code) mutable {
-                    auto source_code_for_cache = source_code;
-                    auto should_generate_bytecode_cache = result.compiled && bytecode_cache_context.has_value();
-                    auto script = result.compiled
-                        ? ClassicScript::create_from_pre_compiled(move(response_url_string), move(source_code), *settings_root, move(response_url), result.compiled, muted_errors)
-                        : ClassicScript::create_from_pre_parsed(move(response_url_string), move(source_code), *settings_root, move(response_url), result.parsed, muted_errors);
-                    BytecodeCacheInstallTarget install_target;
-                    if (auto* script_record = script->script_record()) {
-                        install_target.script = *script_record;
-                        if (!should_generate_bytecode_cache) {
-                            if (auto* executable = script_record->cached_executable())
-                                compile_remaining_functions_off_thread(*executable, source_code_for_cache);
-                        }
-                    }
-                    on_complete_root->function()(script);
-                    if (should_generate_bytecode_cache) {
-                        install_target.begin_generation();
-                        schedule_bytecode_cache_generation(move(source_code_for_cache), JS::RustIntegration::ProgramType::Script, 1, bytecode_cache_context.release_value(), move(install_target));
-                    }
+                    source_encoding = move(source_encoding), muted_errors,
+                    on_complete_root = move(on_complete_root),
+                    settings_root = move(settings_root)](OffThreadDecodedSourceText decoded, Core::ImmutableBytes source_bytes) mutable {
+                    auto source_text_info = decoded.info;
+                    retrieve_bytecode_cache(move(response_bytecode), source_text_info,
+                        [response_url = move(response_url), decoded = move(decoded), source_bytes = move(source_bytes),
+                            bytecode_cache_context = move(bytecode_cache_context),
+                            source_encoding = move(source_encoding), muted_errors,
+                            on_complete_root = move(on_complete_root),
+                            settings_root = move(settings_root)](Optional<Core::ImmutableBytes> bytecode) mutable {
+                            auto& source_text_info = decoded.info;
+                            auto response_url_string = response_url.to_byte_string();
+                            auto source_code_filename = String::from_utf8(response_url_string.view()).release_value_but_fixme_should_propagate_errors();
+                            // Keep the source as undecoded bytes when there's bytecode to materialize from; functions only
+                            // decode the ranges they need from it.
+                            auto source_code = decoded.code.has_value() && !bytecode.has_value()
+                                ? JS::SourceCode::create(move(source_code_filename), decoded.code.release_value())
+                                : JS::SourceCode::create(move(source_code_filename), source_text_info->length_in_code_units, move(source_encoding), move(source_bytes));
+                            // Warm-cache fast path: a sidecar arrived with the response (or another URL already compiled the
+                            // same source text), decode it, and try to materialize a script straight from the cached bytecode
+                            // without parsing or compiling. Pass non-moved source_code / response_url so the fallback compile
+                            // path below can reuse them if decode or materialization is rejected.
+                            if (bytecode.has_value()) {
+                                VERIFY(source_text_info.has_value());
+                                if (auto* bytecode_cache = JS::RustIntegration::decode_bytecode_cache_blob(*bytecode, JS::RustIntegration::ProgramType::Script, source_text_info->hash.bytes())) {
+                                    auto hot_function_offsets = JS::RustIntegration::bytecode_cache_hot_function_offsets(bytecode_cache);
+                                    auto script = ClassicScript::create_from_bytecode_cache(response_url_string, source_code, *settings_root, response_url, bytecode_cache, muted_errors);
+                                    // Bytecode validation runs during materialization and may reject a structurally valid blob
+                                    // whose bytecode is corrupt. Treat that as a cache miss and fall through to off-thread
+                                    // source compile.
+                                    if (script->parse_error().is_null()) {
+                                        if (auto* script_record = script->script_record(); script_record && script_record->cached_executable())
+                                            predecode_hot_functions_off_thread({ GC::make_root(*script_record->cached_executable()) }, move(hot_function_offsets));
+                                        on_complete_root->function()(script);
+                                        return;
+                                    }
+                                }
+                            }
+
+                            compile_off_thread(move(source_code), JS::RustIntegration::ProgramType::Script, 1,
+                                [response_url = move(response_url), response_url_string = move(response_url_string),
+                                    source_text_info = move(source_text_info),
+                                    bytecode_cache_context = move(bytecode_cache_context),
+                                    muted_errors, on_complete_root = move(on_complete_root),
+                                    settings_root = move(settings_root)](auto result, auto source_code) mutable {
+                                    auto source_code_for_cache = source_code;
+                                    auto should_generate_bytecode_cache = result.compiled && bytecode_cache_context.has_value();
+                                    auto script = result.compiled
+                                        ? ClassicScript::create_from_pre_compiled(move(response_url_string), move(source_code), *settings_root, move(response_url), result.compiled, muted_errors)
+                                        : ClassicScript::create_from_pre_parsed(move(response_url_string), move(source_code), *settings_root, move(response_url), result.parsed, muted_errors);
+                                    BytecodeCacheInstallTarget install_target;
+                                    if (auto* script_record = script->script_record()) {
+                                        install_target.script = *script_record;
+                                        if (!should_generate_bytecode_cache) {
+                                            if (auto* executable = script_record->cached_executable())
+                                                compile_remaining_functions_off_thread(*executable, source_code_for_cache);
+                                        }
+                                    }
+                                    on_complete_root->function()(script);
+                                    if (should_generate_bytecode_cache) {
+                                        install_target.begin_generation();
+                                        schedule_bytecode_cache_generation(move(source_code_for_cache), source_text_info->hash, JS::RustIntegration::ProgramType::Script, 1, bytecode_cache_context.release_value(), move(install_target));
+                                    }
+                                });
+                        });
                 });
         } else {
             auto source_text = decode_source_text(*fallback_decoder, body_bytes_view(body_bytes)).release_value_but_fixme_should_propagate_errors();
@@ -1169,69 +1395,84 @@ void fetch_single_module_script(JS::Realm& realm,
             if (mime_type.has_value() && mime_type->is_javascript() && module_type == "javascript-or-wasm") {
                 auto decoder = TextCodec::decoder_for("UTF-8"sv);
                 VERIFY(decoder.has_value());
-                // If the Rust pipeline is available, parse off the main thread.
+                // If the Rust pipeline is available, decode, parse and compile off the main thread, so that every
+                // module in a graph is prepared in parallel as its response arrives.
                 if (JS::RustIntegration::rust_pipeline_available()) {
                     auto on_complete_root = GC::make_root(on_complete);
                     auto settings_root = GC::make_root(settings_object);
-                    auto url_string = url.to_byte_string();
                     auto response_url = response->url().value_or({});
-                    auto module_type_string = module_type.to_byte_string();
-                    auto source_bytes = body_bytes_view(body_bytes);
-                    auto const& bytecode = internal_response->javascript_bytecode_cache();
-                    Optional<DecodedSourceTextInfo> source_text_info;
-                    if (bytecode.has_value())
-                        source_text_info = decoded_source_text_info(*decoder, source_bytes).release_value_but_fixme_should_propagate_errors();
-                    auto source_code_filename = String::from_utf8(url_string.view()).release_value_but_fixme_should_propagate_errors();
-                    auto source_code = [&] {
-                        if (source_text_info.has_value()) {
-                            return JS::SourceCode::create(
-                                move(source_code_filename),
-                                source_text_info->length_in_code_units,
-                                "UTF-8"_string,
-                                take_body_bytes(body_bytes));
-                        }
-                        return JS::SourceCode::create(move(source_code_filename), Utf16String::from_utf8(decode_source_text(*decoder, source_bytes).release_value_but_fixme_should_propagate_errors()));
-                    }();
+                    auto bytecode = internal_response->javascript_bytecode_cache();
                     auto bytecode_cache_context = bytecode_cache_context_for_request(*request, *internal_response, response_url);
-                    if (bytecode.has_value()) {
-                        VERIFY(source_text_info.has_value());
-                        if (auto* bytecode_cache = JS::RustIntegration::decode_bytecode_cache_blob(*bytecode, JS::RustIntegration::ProgramType::Module, source_text_info->hash.bytes())) {
-                            auto module_script = ModuleScript::create_from_bytecode_cache(url_string, source_code, settings_object, response_url, bytecode_cache).release_value_but_fixme_should_propagate_errors();
-                            if (module_script && module_script->parse_error().is_null()) {
-                                settings_object.module_map().set(url, module_type_string, { ModuleMap::EntryType::ModuleScript, module_script });
-                                on_complete->function()(module_script);
-                                return;
-                            }
-                        }
-                    }
-
-                    compile_off_thread(move(source_code), JS::RustIntegration::ProgramType::Module, 0,
-                        [url = move(url), url_string = move(url_string), response_url = move(response_url),
-                            module_type_string = move(module_type_string),
+                    // The source hash is only needed to validate, look up or generate a bytecode cache. The full UTF-16
+                    // decode is only needed if we end up compiling, which is unlikely when the response came with bytecode.
+                    auto compute_source_text_info = bytecode.has_value() || bytecode_cache_context.has_value();
+                    auto decode_code = !bytecode.has_value();
+                    decode_source_text_off_thread(*decoder, take_body_bytes(body_bytes), compute_source_text_info, decode_code,
+                        [url, url_string = url.to_byte_string(), response_url = move(response_url),
+                            module_type_string = module_type.to_byte_string(),
+                            response_bytecode = move(bytecode),
                             bytecode_cache_context = move(bytecode_cache_context),
                             on_complete_root = move(on_complete_root),
-                            settings_root = move(settings_root)](auto result, auto source_code) mutable {
-                            auto source_code_for_cache = source_code;
-                            auto should_generate_bytecode_cache = result.compiled && bytecode_cache_context.has_value();
-                            auto module_script = result.compiled
-                                ? ModuleScript::create_from_pre_compiled(url_string, move(source_code), *settings_root, move(response_url), result.compiled).release_value_but_fixme_should_propagate_errors()
-                                : ModuleScript::create_from_pre_parsed(url_string, move(source_code), *settings_root, move(response_url), result.parsed).release_value_but_fixme_should_propagate_errors();
-                            BytecodeCacheInstallTarget install_target;
-                            if (module_script) {
-                                module_script->record().visit(
-                                    [](Empty) {},
-                                    [&](GC::Ref<JS::SourceTextModule> module) { install_target.module = module; },
-                                    [](GC::Ref<JS::SyntheticModule>) {},
-                                    [](GC::Ref<WebAssembly::WebAssemblyModule>) {});
-                                if (!should_generate_bytecode_cache)
-                                    compile_remaining_module_functions_off_thread(*module_script, source_code_for_cache);
-                            }
-                            settings_root->module_map().set(url, module_type_string, { ModuleMap::EntryType::ModuleScript, module_script });
-                            on_complete_root->function()(module_script);
-                            if (should_generate_bytecode_cache) {
-                                install_target.begin_generation();
-                                schedule_bytecode_cache_generation(move(source_code_for_cache), JS::RustIntegration::ProgramType::Module, 0, bytecode_cache_context.release_value(), move(install_target));
-                            }
+                            settings_root = move(settings_root)](OffThreadDecodedSourceText decoded, Core::ImmutableBytes source_bytes) mutable {
+                            auto source_text_info = decoded.info;
+                            retrieve_bytecode_cache(move(response_bytecode), source_text_info,
+                                [url = move(url), url_string = move(url_string), response_url = move(response_url),
+                                    module_type_string = move(module_type_string),
+                                    decoded = move(decoded), source_bytes = move(source_bytes),
+                                    bytecode_cache_context = move(bytecode_cache_context),
+                                    on_complete_root = move(on_complete_root),
+                                    settings_root = move(settings_root)](Optional<Core::ImmutableBytes> bytecode) mutable {
+                                    auto& source_text_info = decoded.info;
+                                    auto source_code_filename = String::from_utf8(url_string.view()).release_value_but_fixme_should_propagate_errors();
+                                    // Keep the source as UTF-8 bytes when there's bytecode to materialize from; functions
+                                    // only decode the ranges they need from it.
+                                    auto source_code = decoded.code.has_value() && !bytecode.has_value()
+                                        ? JS::SourceCode::create(move(source_code_filename), decoded.code.release_value())
+                                        : JS::SourceCode::create(move(source_code_filename), source_text_info->length_in_code_units, "UTF-8"_string, move(source_bytes));
+                                    if (bytecode.has_value()) {
+                                        VERIFY(source_text_info.has_value());
+                                        if (auto* bytecode_cache = JS::RustIntegration::decode_bytecode_cache_blob(*bytecode, JS::RustIntegration::ProgramType::Module, source_text_info->hash.bytes())) {
+                                            auto hot_function_offsets = JS::RustIntegration::bytecode_cache_hot_function_offsets(bytecode_cache);
+                                            auto module_script = ModuleScript::create_from_bytecode_cache(url_string, source_code, *settings_root, response_url, bytecode_cache).release_value_but_fixme_should_propagate_errors();
+                                            if (module_script && module_script->parse_error().is_null()) {
+                                                predecode_hot_module_functions_off_thread(*module_script, move(hot_function_offsets));
+                                                settings_root->module_map().set(url, module_type_string, { ModuleMap::EntryType::ModuleScript, module_script });
+                                                on_complete_root->function()(module_script);
+                                                return;
+                                            }
+                                        }
+                                    }
+
+                                    compile_off_thread(move(source_code), JS::RustIntegration::ProgramType::Module, 0,
+                                        [url = move(url), url_string = move(url_string), response_url = move(response_url),
+                                            module_type_string = move(module_type_string),
+                                            source_text_info = move(source_text_info),
+                                            bytecode_cache_context = move(bytecode_cache_context),
+                                            on_complete_root = move(on_complete_root),
+                                            settings_root = move(settings_root)](auto result, auto source_code) mutable {
+                                            auto source_code_for_cache = source_code;
+                                            auto should_generate_bytecode_cache = result.compiled && bytecode_cache_context.has_value();
+                                            auto module_script = result.compiled
+                                                ? ModuleScript::create_from_pre_compiled(url_string, move(source_code), *settings_root, move(response_url), result.compiled).release_value_but_fixme_should_propagate_errors()
+                                                : ModuleScript::create_from_pre_parsed(url_string, move(source_code), *settings_root, move(response_url), result.parsed).release_value_but_fixme_should_propagate_errors();
+                                            BytecodeCacheInstallTarget install_target;
+                                            if (module_script) {
+                                                module_script->record().visit(
+                                                    [](Empty) {},
+                                                    [&](GC::Ref<JS::SourceTextModule> module) { install_target.module = module; },
+                                                    [](GC::Ref<JS::SyntheticModule>) {},
+                                                    [](GC::Ref<WebAssembly::WebAssemblyModule>) {});
+                                                if (!should_generate_bytecode_cache)
+                                                    compile_remaining_module_functions_off_thread(*module_script, source_code_for_cache);
+                                            }
+                                            settings_root->module_map().set(url, module_type_string, { ModuleMap::EntryType::ModuleScript, module_script });
+                                            on_complete_root->function()(module_script);
+                                            if (should_generate_bytecode_cache) {
+                                                install_target.begin_generation();
+                                                schedule_bytecode_cache_generation(move(source_code_for_cache), source_text_info->hash, JS::RustIntegration::ProgramType::Module, 0, bytecode_cache_context.release_value(), move(install_target));
+                                            }
+                                        });
+                                });
                         });
                     return;
                 }
@@ -275,7 +275,7 @@ WebIDL::Promise* ModuleScript::run(PreventErrorReporting prevent_error_reporting
         // NON-STANDARD: To ensure that LibJS can find the module on the stack, we push a new execution context.
         auto& stack = vm().interpreter_stack();
         auto* stack_mark = stack.top();
-        auto* module_execution_context = stack.allocate(0, ReadonlySpan<JS::Value> {}, 0);
+        auto* module_execution_context = stack.allocate(0, 0);
         VERIFY(module_execution_context);
         module_execution_context->realm = &realm;
         module_execution_context->script_or_module = record;
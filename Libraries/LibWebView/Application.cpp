@@ -1467,6 +1467,17 @@ void Application::initialize_actions()
             }
         }
     }));
+    m_debug_menu->add_action(Action::create("Take Heap Snapshot"sv, ActionID::TakeHeapSnapshot, [this]() {
+        if (auto view = active_web_view(); view.has_value()) {
+            view->take_heap_snapshot()
+                ->when_resolved([](auto const& path) {
+                    warnln("\033[33;1mWrote heap snapshot to {}\033[0m", path);
+                })
+                .when_rejected([](auto const& error) {
+                    warnln("\033[31;1mFailed to take heap snapshot: {}\033[0m", error);
+                });
+        }
+    }));
     m_debug_menu->add_separator();
 
     m_show_line_box_borders_action = Action::create_checkable("Show Line Box Borders"sv, ActionID::ShowLineBoxBorders, check(m_show_line_box_borders_action, "set-line-box-borders"sv));
@@ -1985,6 +1996,52 @@ void Application::stop_listening_for_console_messages(DevTools::TabDescription c
     view->on_console_message = nullptr;
 }
 
+void Application::start_javascript_profiler(DevTools::TabDescription const& description) const
+{
+    if (auto view = ViewImplementation::find_view_by_id(description.id); view.has_value())
+        view->start_js_profiler();
+}
+
+void Application::stop_javascript_profiler(DevTools::TabDescription const& description, OnJavaScriptProfileReceived on_complete) const
+{
+    auto view = ViewImplementation::find_view_by_id(description.id);
+    if (!view.has_value()) {
+        on_complete(Error::from_string_literal("Unable to locate tab"));
+        return;
+    }
+
+    view->on_received_js_profile = [&view = *view, on_complete = move(on_complete)](JsonValue profile) {
+        view.on_received_js_profile = nullptr;
+        on_complete(move(profile));
+    };
+
+    view->stop_js_profiler();
+}
+
+void Application::take_heap_snapshot(DevTools::TabDescription const& description, OnHeapSnapshotTaken on_complete) const
+{
+    auto view = ViewImplementation::find_view_by_id(description.id);
+    if (!view.has_value()) {
+        on_complete("Unable to locate tab"_string);
+        return;
+    }
+
+    // Only one of the promise's handlers will run, but both of them need the callback.
+    struct PendingSnapshot : RefCounted<PendingSnapshot> {
+        OnHeapSnapshotTaken on_complete;
+    };
+    auto pending_snapshot = make_ref_counted<PendingSnapshot>();
+    pending_snapshot->on_complete = move(on_complete);
+
+    view->take_heap_snapshot()
+        ->when_resolved([pending_snapshot](LexicalPath const& path) {
+            pending_snapshot->on_complete(path);
+        })
+        .when_rejected([pending_snapshot](String const& error) {
+            pending_snapshot->on_complete(error);
+        });
+}
+
 void Application::listen_for_network_events(DevTools::TabDescription const& description, OnNetworkRequestStarted on_request_started, OnNetworkResponseHeadersReceived on_response_headers, OnNetworkResponseBodyReceived on_response_body, OnNetworkRequestFinished on_request_finished) const
 {
     auto view = ViewImplementation::find_view_by_id(description.id);
@@ -273,6 +273,9 @@ private:
     virtual void evaluate_javascript(DevTools::TabDescription const&, String const&, OnScriptEvaluationComplete) const override;
     virtual void listen_for_console_messages(DevTools::TabDescription const&, OnConsoleMessage) const override;
     virtual void stop_listening_for_console_messages(DevTools::TabDescription const&) const override;
+    virtual void start_javascript_profiler(DevTools::TabDescription const&) const override;
+    virtual void stop_javascript_profiler(DevTools::TabDescription const&, OnJavaScriptProfileReceived) const override;
+    virtual void take_heap_snapshot(DevTools::TabDescription const&, OnHeapSnapshotTaken) const override;
     virtual void listen_for_network_events(DevTools::TabDescription const&, OnNetworkRequestStarted, OnNetworkResponseHeadersReceived, OnNetworkResponseBodyReceived, OnNetworkRequestFinished) const override;
     virtual void stop_listening_for_network_events(DevTools::TabDescription const&) const override;
     virtual void listen_for_navigation_events(DevTools::TabDescription const&, OnNavigationStarted, OnNavigationFinished) const override;
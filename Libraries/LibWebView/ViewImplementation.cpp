@@ -581,6 +581,16 @@ void ViewImplementation::js_console_input(String const& js_source)
     client().async_js_console_input(page_id(), js_source);
 }
 
+void ViewImplementation::start_js_profiler()
+{
+    client().async_start_js_profiler(page_id());
+}
+
+void ViewImplementation::stop_js_profiler()
+{
+    client().async_stop_js_profiler(page_id());
+}
+
 void ViewImplementation::exit_fullscreen()
 {
     client().async_exit_fullscreen(page_id());
@@ -776,6 +786,13 @@ void ViewImplementation::handle_web_content_process_crash(LoadErrorPage load_err
         dbgln("Consider raising an issue at https://github.com/LadybirdBrowser/ladybird/issues/new/choose");
     }
 
+    // The crashed process will never report back on a heap snapshot it was writing.
+    if (m_pending_heap_snapshot) {
+        m_pending_heap_snapshot->reject("WebContent process crashed while taking the heap snapshot"_string);
+        m_pending_heap_snapshot = nullptr;
+        m_pending_heap_snapshot_path.clear();
+    }
+
     ++m_crash_count;
     constexpr size_t max_reasonable_crash_count = 5U;
     if (m_crash_count >= max_reasonable_crash_count) {
@@ -999,6 +1016,51 @@ ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
     return path;
 }
 
+NonnullRefPtr<Core::Promise<LexicalPath, String>> ViewImplementation::take_heap_snapshot()
+{
+    auto promise = Core::Promise<LexicalPath, String>::construct();
+
+    if (m_pending_heap_snapshot) {
+        promise->reject("A heap snapshot is already in progress"_string);
+        return promise;
+    }
+
+    auto open_snapshot_file = [&]() -> ErrorOr<NonnullOwnPtr<Core::File>> {
+        LexicalPath path { Core::StandardPaths::tempfile_directory() };
+        path = path.append(TRY(AK::UnixDateTime::now().to_string("heap-%Y-%m-%d-%H-%M-%S.heapsnapshot"sv)));
+
+        auto file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+        m_pending_heap_snapshot_path = move(path);
+        return file;
+    };
+
+    auto file = open_snapshot_file();
+    if (file.is_error()) {
+        promise->reject(MUST(String::formatted("{}", file.error())));
+        return promise;
+    }
+
+    m_pending_heap_snapshot = promise;
+    client().async_take_heap_snapshot(page_id(), IPC::File::adopt_file(file.release_value()));
+
+    return promise;
+}
+
+void ViewImplementation::did_take_heap_snapshot(Badge<WebContentClient>, Optional<String> const& error)
+{
+    if (!m_pending_heap_snapshot)
+        return;
+
+    if (error.has_value()) {
+        m_pending_heap_snapshot->reject(*error);
+    } else {
+        m_pending_heap_snapshot->resolve(m_pending_heap_snapshot_path.release_value());
+    }
+
+    m_pending_heap_snapshot = nullptr;
+    m_pending_heap_snapshot_path.clear();
+}
+
 void ViewImplementation::set_user_style_sheet(String const& source)
 {
     client().async_set_user_style(page_id(), source);
@@ -149,6 +149,8 @@ public:
 
     void run_javascript(String const&);
     void js_console_input(String const&);
+    void start_js_profiler();
+    void stop_js_profiler();
     void exit_fullscreen();
 
     void set_is_fullscreen(Web::ViewportIsFullscreen is_fullscreen);
@@ -189,6 +191,10 @@ public:
 
     ErrorOr<LexicalPath> dump_gc_graph();
 
+    // Resolves with the path of a .heapsnapshot file, which can be loaded into the Chrome DevTools memory panel.
+    NonnullRefPtr<Core::Promise<LexicalPath, String>> take_heap_snapshot();
+    void did_take_heap_snapshot(Badge<WebContentClient>, Optional<String> const& error);
+
     void set_user_style_sheet(String const& source);
     // Load Native.css as the User style sheet, which attempts to make WebView content look as close to
     // native GUI widgets as possible.
@@ -237,6 +243,7 @@ public:
     Function<void(Vector<Web::CSS::StyleSheetIdentifier>)> on_received_style_sheet_list;
     Function<void(Web::CSS::StyleSheetIdentifier const&, URL::URL const&, String const&)> on_received_style_sheet_source;
     Function<void(JsonValue)> on_received_js_console_result;
+    Function<void(JsonValue)> on_received_js_profile;
     Function<void(ConsoleOutput)> on_console_message;
     Function<void(u64 request_id, URL::URL const&, ByteString const&, Vector<HTTP::Header> const&, ByteBuffer, Optional<String>)> on_network_request_started;
     Function<void(u64 request_id, u32 status_code, Optional<String> const&, Vector<HTTP::Header> const&)> on_network_response_headers_received;
@@ -408,6 +415,8 @@ protected:
 
     RefPtr<Core::Promise<LexicalPath>> m_pending_screenshot;
     RefPtr<Core::Promise<String>> m_pending_info_request;
+    RefPtr<Core::Promise<LexicalPath, String>> m_pending_heap_snapshot;
+    Optional<LexicalPath> m_pending_heap_snapshot_path;
 
     Web::HTML::VisibilityState m_system_visibility_state { Web::HTML::VisibilityState::Hidden };
 
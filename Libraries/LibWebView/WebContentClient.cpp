@@ -689,6 +689,20 @@ void WebContentClient::did_execute_js_console_input(u64 page_id, JsonValue resul
     }
 }
 
+void WebContentClient::did_stop_js_profiler(u64 page_id, JsonValue profile)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value()) {
+        if (view->on_received_js_profile)
+            view->on_received_js_profile(move(profile));
+    }
+}
+
+void WebContentClient::did_take_heap_snapshot(u64 page_id, Optional<String> error)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value())
+        view->did_take_heap_snapshot({}, error);
+}
+
 void WebContentClient::did_output_js_console_message(u64 page_id, ConsoleOutput console_output)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -353,6 +353,7 @@ CACHE_INDEX_TYPES = {
     "TemplateObjectCacheIndex",
     "ObjectShapeCacheIndex",
     "ObjectPropertyIteratorCacheIndex",
+    "TypeFeedbackSlotIndex",
 }
 
 
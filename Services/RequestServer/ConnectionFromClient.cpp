@@ -491,6 +491,36 @@ Messages::RequestServer::RetrieveCacheAssociatedDataResponse ConnectionFromClien
     return Optional<Core::AnonymousBuffer> { buffer.release_value() };
 }
 
+void ConnectionFromClient::store_shared_cache_associated_data(ByteBuffer content_hash, HTTP::CacheEntryAssociatedData associated_data, Core::AnonymousBuffer data)
+{
+    if (!m_disk_cache.has_value() || !data.is_valid())
+        return;
+
+    if (auto result = m_disk_cache->store_shared_associated_data(content_hash, associated_data, data.bytes()); result.is_error())
+        dbgln("Failed to store shared cache associated data: {}", result.error());
+}
+
+void ConnectionFromClient::retrieve_shared_cache_associated_data(u64 shared_cache_retrieval_id, ByteBuffer content_hash, HTTP::CacheEntryAssociatedData associated_data)
+{
+    if (!m_disk_cache.has_value()) {
+        async_shared_cache_associated_data_retrieved(shared_cache_retrieval_id, {}, 0);
+        return;
+    }
+
+    auto data = m_disk_cache->retrieve_shared_associated_data_file(content_hash, associated_data);
+    if (data.is_error()) {
+        dbgln("Failed to retrieve shared cache associated data: {}", data.error());
+        async_shared_cache_associated_data_retrieved(shared_cache_retrieval_id, {}, 0);
+        return;
+    }
+    if (!data.value().has_value()) {
+        async_shared_cache_associated_data_retrieved(shared_cache_retrieval_id, {}, 0);
+        return;
+    }
+
+    async_shared_cache_associated_data_retrieved(shared_cache_retrieval_id, IPC::File::adopt_fd(data.value()->fd), data.value()->size);
+}
+
 void ConnectionFromClient::websocket_connect(u64 websocket_id, URL::URL url, ByteString origin, Vector<ByteString> protocols, Vector<ByteString> extensions, Vector<HTTP::Header> additional_request_headers)
 {
     auto host = url.serialized_host().to_byte_string();
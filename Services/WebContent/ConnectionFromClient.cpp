@@ -13,6 +13,7 @@
 #include <AK/JsonObject.h>
 #include <AK/OwnPtr.h>
 #include <AK/QuickSort.h>
+#include <LibCore/File.h>
 #include <LibCore/System.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
@@ -20,6 +21,7 @@
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -1349,6 +1351,38 @@ void ConnectionFromClient::run_javascript(u64 page_id, String js_source)
         page->run_javascript(js_source);
 }
 
+// NB: All pages in this process share the main thread VM, so the profile covers every page rather than just this one.
+void ConnectionFromClient::start_js_profiler(u64)
+{
+    Web::Bindings::main_thread_vm().ensure_sampling_profiler().start();
+}
+
+void ConnectionFromClient::stop_js_profiler(u64 page_id)
+{
+    auto& profiler = Web::Bindings::main_thread_vm().ensure_sampling_profiler();
+    profiler.stop();
+
+    async_did_stop_js_profiler(page_id, profiler.to_cpuprofile());
+}
+
+// NB: Like the profile above, the snapshot covers the main thread VM's heap, which all pages in this process share.
+//     The client hands us the file to write to, so the snapshot never has to fit in an IPC message (or in memory).
+void ConnectionFromClient::take_heap_snapshot(u64 page_id, IPC::File file)
+{
+    auto write_snapshot = [&]() -> ErrorOr<void> {
+        auto stream = TRY(Core::File::adopt_fd(file.take_fd(), Core::File::OpenMode::Write));
+        TRY(Web::Bindings::main_thread_vm().heap().write_heap_snapshot(*stream));
+        stream->close();
+        return {};
+    };
+
+    if (auto result = write_snapshot(); result.is_error()) {
+        async_did_take_heap_snapshot(page_id, MUST(String::formatted("{}", result.error())));
+        return;
+    }
+    async_did_take_heap_snapshot(page_id, {});
+}
+
 void ConnectionFromClient::alert_closed(u64 page_id)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -137,6 +137,11 @@ private:
     virtual void js_console_input(u64 page_id, String) override;
     virtual void run_javascript(u64 page_id, String) override;
 
+    virtual void start_js_profiler(u64 page_id) override;
+    virtual void stop_js_profiler(u64 page_id) override;
+
+    virtual void take_heap_snapshot(u64 page_id, IPC::File) override;
+
     virtual void alert_closed(u64 page_id) override;
     virtual void confirm_closed(u64 page_id, bool accepted) override;
     virtual void prompt_closed(u64 page_id, Optional<String> response) override;
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/NeverDestroyed.h>
+#include <LibGC/Cell.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Ptr.h>
+#include <LibGC/Root.h>
+#include <LibTest/TestCase.h>
+
+static Atomic<size_t> s_destroyed_node_count { 0 };
+
+class ListNode : public GC::Cell {
+    GC_CELL(ListNode, GC::Cell);
+    GC_DECLARE_ALLOCATOR(ListNode);
+
+public:
+    static constexpr bool CAN_BE_SWEPT_CONCURRENTLY = true;
+
+    virtual ~ListNode() override
+    {
+        s_destroyed_node_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    }
+
+    GC::Ptr<ListNode> next() const { return m_next; }
+    void set_next(GC::Ptr<ListNode> next) { m_next = next; }
+
+private:
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_next);
+    }
+
+    GC::Ptr<ListNode> m_next;
+};
+
+GC_DEFINE_ALLOCATOR(ListNode);
+
+static GC::Heap& test_heap()
+{
+    static AK::NeverDestroyed<GC::Heap> heap([](auto&) { });
+    return *heap;
+}
+
+TEST_SETUP
+{
+    GC::Heap::set_default_heap_for_testing(test_heap());
+}
+
+TEST_CASE(background_sweep_frees_dead_cells_and_keeps_live_ones)
+{
+    auto& heap = test_heap();
+
+    static constexpr size_t live_node_count = 1000;
+    static constexpr size_t dead_node_count = 100'000;
+
+    auto head = GC::make_root(heap.allocate<ListNode>());
+    for (size_t i = 1; i < live_node_count; ++i) {
+        auto node = heap.allocate<ListNode>();
+        node->set_next(head->next());
+        head->set_next(node);
+    }
+    for (size_t i = 0; i < dead_node_count; ++i)
+        (void)heap.allocate<ListNode>();
+
+    s_destroyed_node_count.store(0);
+
+    // The first collection hands the blocks to the background sweeper. There is no event loop here, so the second
+    // one is what waits for the sweep to finish before it starts marking.
+    heap.collect_garbage();
+    heap.collect_garbage();
+
+    EXPECT(s_destroyed_node_count.load() > 0);
+    EXPECT(s_destroyed_node_count.load() <= dead_node_count);
+
+    size_t reachable_nodes = 0;
+    for (auto node = GC::Ptr<ListNode> { *head }; node; node = node->next())
+        ++reachable_nodes;
+    EXPECT_EQ(reachable_nodes, live_node_count);
+
+    // Swept blocks went back to the allocator, so allocating into them must work.
+    for (size_t i = 0; i < dead_node_count; ++i)
+        (void)heap.allocate<ListNode>();
+    heap.collect_garbage();
+}
+
+TEST_CASE(blocks_being_swept_stay_visible_to_their_allocator)
+{
+    auto& heap = test_heap();
+
+    for (size_t i = 0; i < 10'000; ++i)
+        (void)heap.allocate<ListNode>();
+
+    // Nothing hands the swept blocks back until the main thread allocates or collects again, so every block of this
+    // allocator is now with the background sweeper. They must still be counted.
+    heap.collect_garbage();
+
+    size_t block_count = 0;
+    size_t blocks_being_swept = 0;
+    ListNode::cell_allocator.allocator->for_each_block([&](GC::HeapBlock& block) {
+        ++block_count;
+        if (block.is_being_swept_concurrently())
+            ++blocks_being_swept;
+        return IterationDecision::Continue;
+    });
+    EXPECT(block_count > 0);
+    EXPECT_EQ(blocks_being_swept, block_count);
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/MemoryStream.h>
+#include <AK/NeverDestroyed.h>
+#include <LibGC/Cell.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Ptr.h>
+#include <LibGC/Root.h>
+#include <LibTest/TestCase.h>
+
+class SnapshotNode : public GC::Cell {
+    GC_CELL(SnapshotNode, GC::Cell);
+    GC_DECLARE_ALLOCATOR(SnapshotNode);
+
+public:
+    void set_next(GC::Ptr<SnapshotNode> next) { m_next = next; }
+
+private:
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit_named(Visitor::EdgeType::Property, "next"sv, m_next);
+    }
+
+    virtual size_t external_memory_size() const override { return 1000; }
+
+    GC::Ptr<SnapshotNode> m_next;
+};
+
+GC_DEFINE_ALLOCATOR(SnapshotNode);
+
+static GC::Heap& test_heap()
+{
+    static AK::NeverDestroyed<GC::Heap> heap([](auto&) { });
+    return *heap;
+}
+
+TEST_SETUP
+{
+    GC::Heap::set_default_heap_for_testing(test_heap());
+}
+
+TEST_CASE(heap_snapshot_uses_the_v8_schema)
+{
+    auto& heap = test_heap();
+
+    auto head = GC::make_root(heap.allocate<SnapshotNode>());
+    auto tail = heap.allocate<SnapshotNode>();
+    head->set_next(tail);
+
+    AllocatingMemoryStream stream;
+    TRY_OR_FAIL(heap.write_heap_snapshot(stream));
+    auto buffer = TRY_OR_FAIL(stream.read_until_eof());
+    auto json = TRY_OR_FAIL(JsonValue::from_string(StringView { buffer }));
+    auto const& snapshot = json.as_object();
+
+    auto const& meta = snapshot.get_object("snapshot"sv)->get_object("meta"sv).value();
+    auto node_field_count = meta.get_array("node_fields"sv)->size();
+    auto edge_field_count = meta.get_array("edge_fields"sv)->size();
+    EXPECT_EQ(node_field_count, 7u);
+    EXPECT_EQ(edge_field_count, 3u);
+
+    auto const& nodes = snapshot.get_array("nodes"sv).value();
+    auto const& edges = snapshot.get_array("edges"sv).value();
+    auto const& strings = snapshot.get_array("strings"sv).value();
+    auto node_count = snapshot.get_object("snapshot"sv)->get_u64("node_count"sv).value();
+    EXPECT_EQ(nodes.size(), node_count * node_field_count);
+
+    // Every node's edges are accounted for, and every edge points at the start of a node.
+    size_t total_edges = 0;
+    size_t snapshot_nodes = 0;
+    for (size_t i = 0; i < nodes.size(); i += node_field_count) {
+        total_edges += nodes[i + 4].get_u32().value();
+        auto name = strings[nodes[i + 1].get_u32().value()].as_string();
+        if (name == "SnapshotNode"sv) {
+            ++snapshot_nodes;
+            EXPECT(nodes[i + 3].get_u32().value() >= 1000u);
+        }
+    }
+    EXPECT_EQ(edges.size(), total_edges * edge_field_count);
+    for (size_t i = 0; i < edges.size(); i += edge_field_count)
+        EXPECT_EQ(edges[i + 2].get_u32().value() % node_field_count, 0u);
+
+    EXPECT(snapshot_nodes >= 2);
+}
+
+TEST_CASE(heap_snapshot_names_edges_visited_by_name)
+{
+    auto& heap = test_heap();
+
+    auto head = GC::make_root(heap.allocate<SnapshotNode>());
+    head->set_next(heap.allocate<SnapshotNode>());
+
+    AllocatingMemoryStream stream;
+    TRY_OR_FAIL(heap.write_heap_snapshot(stream));
+    auto buffer = TRY_OR_FAIL(stream.read_until_eof());
+    auto json = TRY_OR_FAIL(JsonValue::from_string(StringView { buffer }));
+    auto const& snapshot = json.as_object();
+
+    auto const& edge_types = snapshot.get_object("snapshot"sv)->get_object("meta"sv)->get_array("edge_types"sv)->at(0).as_array();
+    auto const& edges = snapshot.get_array("edges"sv).value();
+    auto const& strings = snapshot.get_array("strings"sv).value();
+
+    size_t next_edges = 0;
+    for (size_t i = 0; i < edges.size(); i += 3) {
+        auto type = edge_types.at(edges[i].get_u32().value()).as_string();
+        if (type != "property"sv)
+            continue;
+        // Property edges refer to their name in the string table.
+        if (strings[edges[i + 1].get_u32().value()].as_string() == "next"sv)
+            ++next_edges;
+    }
+    EXPECT(next_edges >= 1);
+}
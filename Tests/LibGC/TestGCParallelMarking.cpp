@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NeverDestroyed.h>
+#include <LibGC/Cell.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Ptr.h>
+#include <LibGC/Root.h>
+#include <LibTest/TestCase.h>
+#include <stdlib.h>
+
+static size_t s_finalized_node_count = 0;
+
+class TreeNode : public GC::Cell {
+    GC_CELL(TreeNode, GC::Cell);
+    GC_DECLARE_ALLOCATOR(TreeNode);
+
+public:
+    static constexpr bool OVERRIDES_FINALIZE = true;
+
+    void set_children(GC::Ptr<TreeNode> left, GC::Ptr<TreeNode> right)
+    {
+        m_left = left;
+        m_right = right;
+    }
+
+    GC::Ptr<TreeNode> left() const { return m_left; }
+    GC::Ptr<TreeNode> right() const { return m_right; }
+    bool was_finalized() const { return m_was_finalized; }
+
+private:
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_left);
+        visitor.visit(m_right);
+    }
+
+    virtual void finalize() override
+    {
+        Base::finalize();
+        m_was_finalized = true;
+        ++s_finalized_node_count;
+    }
+
+    GC::Ptr<TreeNode> m_left;
+    GC::Ptr<TreeNode> m_right;
+    bool m_was_finalized { false };
+};
+
+GC_DEFINE_ALLOCATOR(TreeNode);
+
+static GC::Heap& test_heap()
+{
+    static AK::NeverDestroyed<GC::Heap> heap([](auto&) { });
+    return *heap;
+}
+
+TEST_SETUP
+{
+    // Force helper threads regardless of how many cores the test machine has.
+    setenv("LIBGC_MARKING_THREADS", "4", 1);
+    GC::Heap::set_default_heap_for_testing(test_heap());
+}
+
+static GC::Ref<TreeNode> build_tree(GC::Heap& heap, size_t depth)
+{
+    auto node = heap.allocate<TreeNode>();
+    if (depth > 0)
+        node->set_children(build_tree(heap, depth - 1), build_tree(heap, depth - 1));
+    return node;
+}
+
+static size_t count_live_nodes(TreeNode const& node)
+{
+    if (node.was_finalized())
+        return 0;
+    size_t count = 1;
+    if (node.left())
+        count += count_live_nodes(*node.left());
+    if (node.right())
+        count += count_live_nodes(*node.right());
+    return count;
+}
+
+TEST_CASE(parallel_marking_keeps_every_reachable_cell_alive)
+{
+    auto& heap = test_heap();
+
+    // 2^20 nodes is comfortably above the live block count at which marking goes parallel.
+    static constexpr size_t tree_depth = 19;
+    static constexpr size_t tree_node_count = (1 << (tree_depth + 1)) - 1;
+
+    auto root = GC::make_root(build_tree(heap, tree_depth));
+    for (size_t i = 0; i < 4096; ++i)
+        (void)heap.allocate<TreeNode>();
+
+    s_finalized_node_count = 0;
+    heap.collect_garbage();
+
+    EXPECT_EQ(count_live_nodes(*root), tree_node_count);
+    EXPECT(s_finalized_node_count > 0);
+}
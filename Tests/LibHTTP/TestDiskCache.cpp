@@ -214,3 +214,90 @@ TEST_CASE(associated_data_participates_in_cache_eviction)
     auto retrieved_bytecode = TRY_OR_FAIL(disk_cache.retrieve_associated_data(url, "GET"sv, *request_headers, {}, HTTP::CacheEntryAssociatedData::JavaScriptBytecode));
     EXPECT(!retrieved_bytecode.has_value());
 }
+
+TEST_CASE(shared_associated_data_round_trips_by_content_hash)
+{
+    auto disk_cache = MUST(HTTP::DiskCache::create(HTTP::DiskCache::Mode::Testing));
+
+    auto content_hash = TRY_OR_FAIL(ByteBuffer::copy("0123456789abcdef0123456789abcdef"sv.bytes()));
+    auto other_content_hash = TRY_OR_FAIL(ByteBuffer::copy("fedcba9876543210fedcba9876543210"sv.bytes()));
+    auto bytecode = TRY_OR_FAIL(ByteBuffer::copy("bytecode"sv.bytes()));
+    EXPECT(TRY_OR_FAIL(disk_cache.store_shared_associated_data(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode, bytecode.bytes())));
+
+    auto retrieved_bytecode_file = TRY_OR_FAIL(disk_cache.retrieve_shared_associated_data_file(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode));
+    VERIFY(retrieved_bytecode_file.has_value());
+    auto mapped_bytecode = TRY_OR_FAIL(Core::ImmutableBytes::map_from_fd_range_and_close(retrieved_bytecode_file->fd, "bytecode"sv, retrieved_bytecode_file->offset, retrieved_bytecode_file->size));
+    EXPECT_EQ(mapped_bytecode.bytes(), bytecode.bytes());
+
+    retrieved_bytecode_file = TRY_OR_FAIL(disk_cache.retrieve_shared_associated_data_file(other_content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode));
+    EXPECT(!retrieved_bytecode_file.has_value());
+
+    disk_cache.remove_entries_accessed_since(UnixDateTime::earliest());
+
+    retrieved_bytecode_file = TRY_OR_FAIL(disk_cache.retrieve_shared_associated_data_file(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode));
+    EXPECT(!retrieved_bytecode_file.has_value());
+}
+
+TEST_CASE(shared_associated_data_store_replaces_existing_data)
+{
+    auto disk_cache = MUST(HTTP::DiskCache::create(HTTP::DiskCache::Mode::Testing));
+
+    auto content_hash = TRY_OR_FAIL(ByteBuffer::copy("0123456789abcdef0123456789abcdef"sv.bytes()));
+    auto bytecode = TRY_OR_FAIL(ByteBuffer::copy("bytecode"sv.bytes()));
+    auto profiled_bytecode = TRY_OR_FAIL(ByteBuffer::copy("bytecode with a profile"sv.bytes()));
+    EXPECT(TRY_OR_FAIL(disk_cache.store_shared_associated_data(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode, bytecode.bytes())));
+    EXPECT(TRY_OR_FAIL(disk_cache.store_shared_associated_data(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode, profiled_bytecode.bytes())));
+
+    auto retrieved_bytecode_file = TRY_OR_FAIL(disk_cache.retrieve_shared_associated_data_file(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode));
+    VERIFY(retrieved_bytecode_file.has_value());
+    auto mapped_bytecode = TRY_OR_FAIL(Core::ImmutableBytes::map_from_fd_range_and_close(retrieved_bytecode_file->fd, "bytecode"sv, retrieved_bytecode_file->offset, retrieved_bytecode_file->size));
+    EXPECT_EQ(mapped_bytecode.bytes(), profiled_bytecode.bytes());
+}
+
+TEST_CASE(profiled_bytecode_replaces_first_blob)
+{
+    auto disk_cache = MUST(HTTP::DiskCache::create(HTTP::DiskCache::Mode::Testing));
+    TestCacheRequest request;
+
+    auto url = parse_url("https://example.com/script.js"sv);
+    auto request_headers = create_cacheable_request_headers();
+    auto response_headers = create_cacheable_response_headers();
+
+    auto& writer = create_cache_entry(disk_cache, request, url, *request_headers);
+    TRY_OR_FAIL(writer.write_status_and_reason(200, "OK"_string, *request_headers, *response_headers));
+    TRY_OR_FAIL(writer.write_data("console.log('hello');"sv.bytes()));
+    TRY_OR_FAIL(writer.flush(request_headers, response_headers));
+
+    // This mirrors what WebContent does: it stores the freshly generated blob, then stores it again with the profile of
+    // its hot functions once the script has run for a while.
+    auto content_hash = TRY_OR_FAIL(ByteBuffer::copy("0123456789abcdef0123456789abcdef"sv.bytes()));
+    auto bytecode = TRY_OR_FAIL(ByteBuffer::copy("bytecode"sv.bytes()));
+    auto profiled_bytecode = TRY_OR_FAIL(ByteBuffer::copy("bytecode with a profile"sv.bytes()));
+    for (auto const& blob : { bytecode, profiled_bytecode }) {
+        EXPECT(TRY_OR_FAIL(disk_cache.store_associated_data(url, "GET"sv, *request_headers, {}, HTTP::CacheEntryAssociatedData::JavaScriptBytecode, blob.bytes())));
+        EXPECT(TRY_OR_FAIL(disk_cache.store_shared_associated_data(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode, blob.bytes())));
+    }
+
+    auto retrieved_bytecode = TRY_OR_FAIL(disk_cache.retrieve_associated_data(url, "GET"sv, *request_headers, {}, HTTP::CacheEntryAssociatedData::JavaScriptBytecode));
+    VERIFY(retrieved_bytecode.has_value());
+    EXPECT_EQ(retrieved_bytecode->bytes(), profiled_bytecode.bytes());
+
+    auto retrieved_bytecode_file = TRY_OR_FAIL(disk_cache.retrieve_shared_associated_data_file(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode));
+    VERIFY(retrieved_bytecode_file.has_value());
+    auto mapped_bytecode = TRY_OR_FAIL(Core::ImmutableBytes::map_from_fd_range_and_close(retrieved_bytecode_file->fd, "bytecode"sv, retrieved_bytecode_file->offset, retrieved_bytecode_file->size));
+    EXPECT_EQ(mapped_bytecode.bytes(), profiled_bytecode.bytes());
+}
+
+TEST_CASE(shared_associated_data_rejects_malformed_content_hash)
+{
+    auto disk_cache = MUST(HTTP::DiskCache::create(HTTP::DiskCache::Mode::Testing));
+
+    auto bytecode = TRY_OR_FAIL(ByteBuffer::copy("bytecode"sv.bytes()));
+    for (auto content_hash_string : { ""sv, "0123456789abcdef"sv, "0123456789abcdef0123456789abcdef0"sv }) {
+        auto content_hash = TRY_OR_FAIL(ByteBuffer::copy(content_hash_string.bytes()));
+        EXPECT(!TRY_OR_FAIL(disk_cache.store_shared_associated_data(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode, bytecode.bytes())));
+
+        auto retrieved_bytecode_file = TRY_OR_FAIL(disk_cache.retrieve_shared_associated_data_file(content_hash, HTTP::CacheEntryAssociatedData::JavaScriptBytecode));
+        EXPECT(!retrieved_bytecode_file.has_value());
+    }
+}
@@ -28,3 +28,31 @@ test("is unscopable", () => {
         }).toThrowWithMessage(ReferenceError, "'fill' is not defined");
     }
 });
+
+test("packed arrays", () => {
+    var array = [1, 2, 3, 4];
+    expect(array.fill(1.5, 1, 3)).toEqual([1, 1.5, 1.5, 4]);
+    expect(array.indexOf(1.5)).toBe(1);
+    expect(array.fill("x", -1)).toEqual([1, 1.5, 1.5, "x"]);
+});
+
+test("start and end conversion can change the array", () => {
+    var array = [1, 2, 3, 4];
+    var start = {
+        valueOf() {
+            array.push(5, 6);
+            return 0;
+        },
+    };
+    expect(array.fill(0, start)).toEqual([0, 0, 0, 0, 5, 6]);
+
+    array = [1, 2, 3, 4];
+    start = {
+        valueOf() {
+            Object.freeze(array);
+            return 0;
+        },
+    };
+    expect(() => array.fill(0, start)).toThrow(TypeError);
+    expect(array).toEqual([1, 2, 3, 4]);
+});
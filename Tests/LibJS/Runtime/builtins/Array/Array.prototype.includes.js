@@ -26,3 +26,22 @@ test("is unscopable", () => {
         }).toThrowWithMessage(ReferenceError, "'includes' is not defined");
     }
 });
+
+test("numeric arrays", () => {
+    var ints = [1, 2, 3, 0];
+    expect(ints.includes(3)).toBeTrue();
+    expect(ints.includes(-0)).toBeTrue();
+    expect(ints.includes(2.5)).toBeFalse();
+    expect(ints.includes("2")).toBeFalse();
+    expect(ints.includes(NaN)).toBeFalse();
+    expect(ints.includes(1, 1)).toBeFalse();
+
+    var doubles = [1.5, NaN, 2];
+    expect(doubles.includes(1.5)).toBeTrue();
+    expect(doubles.includes(NaN)).toBeTrue();
+    expect(doubles.includes(NaN, 2)).toBeFalse();
+
+    doubles[0] = {};
+    expect(doubles.includes(NaN)).toBeTrue();
+    expect(doubles.includes(1.5)).toBeFalse();
+});
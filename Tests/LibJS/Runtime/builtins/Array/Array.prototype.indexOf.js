@@ -76,3 +76,22 @@ test("fromIndex side effects can make prototype indexed properties observable",
         delete Array.prototype[1];
     }
 });
+
+test("numeric arrays", () => {
+    var ints = [1, 2, 3, 0];
+    expect(ints.indexOf(3)).toBe(2);
+    expect(ints.indexOf(3.0)).toBe(2);
+    expect(ints.indexOf(-0)).toBe(3);
+    expect(ints.indexOf(2.5)).toBe(-1);
+    expect(ints.indexOf("2")).toBe(-1);
+    expect(ints.indexOf(NaN)).toBe(-1);
+
+    var doubles = [1.5, NaN, 2, -0];
+    expect(doubles.indexOf(1.5)).toBe(0);
+    expect(doubles.indexOf(2)).toBe(2);
+    expect(doubles.indexOf(0)).toBe(3);
+    expect(doubles.indexOf(NaN)).toBe(-1);
+
+    doubles[1] = "foo";
+    expect(doubles.indexOf("foo")).toBe(1);
+});
@@ -45,3 +45,45 @@ describe("normal behavior", () => {
         expect(squaredNumbers).toEqual([0, 1, 4, 9, 16]);
     });
 });
+
+test("callback shrinking the array exposes prototype properties for removed indices", () => {
+    Array.prototype[2] = "from prototype";
+    try {
+        var array = [1, 2, 3];
+        var result = array.map((value, index) => {
+            if (index === 0) array.length = 2;
+            return value;
+        });
+        expect(result).toEqual([1, 2, "from prototype"]);
+    } finally {
+        delete Array.prototype[2];
+    }
+});
+
+test("callback turning the array holey skips the new holes", () => {
+    var array = [1, 2, 3, 4];
+    var seen = [];
+    var result = array.map((value, index) => {
+        seen.push(index);
+        if (index === 0) delete array[2];
+        return value * 2;
+    });
+    expect(seen).toEqual([0, 1, 3]);
+    expect(result.length).toBe(4);
+    expect(2 in result).toBeFalse();
+    expect(result[3]).toBe(8);
+});
+
+test("species constructor result is written through its own properties", () => {
+    class MyArray extends Array {
+        static get [Symbol.species]() {
+            return function (length) {
+                var result = new Array(length);
+                Object.freeze(result);
+                return result;
+            };
+        }
+    }
+    var array = MyArray.from([1, 2]);
+    expect(() => array.map(x => x)).toThrow(TypeError);
+});
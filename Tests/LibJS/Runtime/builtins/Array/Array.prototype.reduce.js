@@ -110,3 +110,29 @@ describe("normal behavior", () => {
         expect(a1).toBe(a2);
     });
 });
+
+test("callback mutations are observed", () => {
+    var array = [1, 2, 3, 4];
+    expect(
+        array.reduce((accumulator, value, index) => {
+            if (index === 1) {
+                array[2] = 30;
+                array.length = 3;
+            }
+            return accumulator + value;
+        })
+    ).toBe(33);
+
+    Array.prototype[3] = 100;
+    try {
+        array = [1, 2, 3, 4];
+        expect(
+            array.reduce((accumulator, value, index) => {
+                if (index === 1) array.length = 3;
+                return accumulator + value;
+            }, 0)
+        ).toBe(106);
+    } finally {
+        delete Array.prototype[3];
+    }
+});
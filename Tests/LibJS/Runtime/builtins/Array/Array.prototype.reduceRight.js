@@ -112,3 +112,26 @@ describe("normal behavior", () => {
         expect(a1).toBe(a2);
     });
 });
+
+test("callback mutations are observed", () => {
+    var array = [1, 2, 3, 4];
+    expect(
+        array.reduceRight((accumulator, value, index) => {
+            if (index === 2) delete array[1];
+            return accumulator + value;
+        })
+    ).toBe(8);
+
+    Array.prototype[0] = 100;
+    try {
+        array = [1, 2, 3];
+        expect(
+            array.reduceRight((accumulator, value, index) => {
+                if (index === 2) array.length = 0;
+                return accumulator + value;
+            }, 0)
+        ).toBe(103);
+    } finally {
+        delete Array.prototype[0];
+    }
+});
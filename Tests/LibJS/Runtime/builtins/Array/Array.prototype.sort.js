@@ -172,4 +172,49 @@ describe("Array.prototype.sort", () => {
         );
         Array.prototype.sort.call(obj);
     });
+
+    test("that it is stable and handles long runs", () => {
+        const records = [];
+        for (let i = 0; i < 500; ++i) records.push({ key: i % 7, index: i });
+        records.sort((a, b) => a.key - b.key);
+        for (let i = 1; i < records.length; ++i) {
+            const previous = records[i - 1];
+            const current = records[i];
+            expect(previous.key < current.key || (previous.key === current.key && previous.index < current.index)).toBeTrue();
+        }
+
+        const descending = [];
+        for (let i = 300; i > 0; --i) descending.push(i);
+        descending.push(1000, 0);
+        descending.sort((a, b) => a - b);
+        expect(descending[0]).toBe(0);
+        expect(descending[1]).toBe(1);
+        expect(descending[300]).toBe(300);
+        expect(descending[301]).toBe(1000);
+    });
+
+    test("default comparison of integers and strings", () => {
+        expect([10, 9, 1, -1, -10, 100, 0, 2147483647, -2147483648].sort()).toEqual([
+            -1, -10, -2147483648, 0, 1, 10, 100, 2147483647, 9,
+        ]);
+        expect(["b", "a", "ab", "", "B", "\u00e9", "aa"].sort()).toEqual(["", "B", "a", "aa", "ab", "b", "\u00e9"]);
+    });
+});
+
+test("comparator mutations are observed when writing back", () => {
+    var array = [3, 1, 2];
+    array.sort((a, b) => {
+        array.length = 1;
+        return a - b;
+    });
+    expect(array).toEqual([1, 2, 3]);
+
+    array = [3, 1, 2];
+    expect(() => {
+        array.sort((a, b) => {
+            Object.freeze(array);
+            return a - b;
+        });
+    }).toThrow(TypeError);
+    expect(array).toEqual([3, 1, 2]);
 });
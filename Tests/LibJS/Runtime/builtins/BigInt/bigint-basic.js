@@ -192,6 +192,31 @@ describe("correct behavior", () => {
         expect("0x1" <= 1n).toBeTrue();
         expect("0X2" <= 2n).toBeTrue();
     });
+
+    test("arithmetic around the 64-bit boundary", () => {
+        const max = 9223372036854775807n;
+        const min = -9223372036854775808n;
+        expect(max + 1n).toBe(9223372036854775808n);
+        expect(min - 1n).toBe(-9223372036854775809n);
+        expect(max + 1n - 1n).toBe(max);
+        expect(4294967296n * 4294967296n).toBe(18446744073709551616n);
+        expect(-4294967296n * 2147483648n).toBe(min);
+        expect(-min).toBe(9223372036854775808n);
+        expect(-(min + 1n)).toBe(max);
+        expect(1n << 62n).toBe(4611686018427387904n);
+        expect(1n << 63n).toBe(9223372036854775808n);
+        expect(-1n << 63n).toBe(min);
+        expect(-5n >> 1n).toBe(-3n);
+        expect(-5n >> 100n).toBe(-1n);
+        expect(5n >> 100n).toBe(0n);
+        expect(5n << -1n).toBe(2n);
+        expect(max < max + 1n).toBeTrue();
+        expect(min + 1n > min).toBeTrue();
+        expect(max + 1n === 9223372036854775808n).toBeTrue();
+        expect(BigInt(2 ** 62) === 4611686018427387904n).toBeTrue();
+        expect(BigInt(2 ** 63)).toBe(9223372036854775808n);
+        expect(BigInt(-(2 ** 63))).toBe(min);
+    });
 });
 
 describe("errors", () => {
@@ -54,3 +54,19 @@ describe("correct behavior", () => {
         expect(d1.toLocaleString("ar-u-nu-arab", { timeStyle: "short", timeZone: "UTC" })).toBe("٧:٠٨ ص");
     });
 });
+
+describe("repeated calls", () => {
+    test("system time zone changes are picked up", () => {
+        const d = new Date(Date.UTC(2021, 11, 7, 17, 40, 50));
+
+        const originalTimeZone = setTimeZone("UTC");
+        expect(d.toLocaleString("en")).toBe("12/7/2021, 5:40:50 PM");
+        expect(d.toLocaleTimeString("en")).toBe("5:40:50 PM");
+
+        setTimeZone("America/New_York");
+        expect(d.toLocaleString("en")).toBe("12/7/2021, 12:40:50 PM");
+        expect(d.toLocaleTimeString("en")).toBe("12:40:50 PM");
+
+        setTimeZone(originalTimeZone);
+    });
+});
@@ -0,0 +1,45 @@
+test("objects with the same keys", () => {
+    const parsed = JSON.parse('[{"id":1,"name":"a"},{"id":2,"name":"b"},{"id":3,"name":"c"}]');
+    expect(parsed).toEqual([
+        { id: 1, name: "a" },
+        { id: 2, name: "b" },
+        { id: 3, name: "c" },
+    ]);
+    expect(Object.keys(parsed[2])).toEqual(["id", "name"]);
+});
+
+test("objects that share a first key but differ afterwards", () => {
+    const parsed = JSON.parse(
+        '[{"a":1,"b":2,"c":3},{"a":4,"c":5,"b":6},{"a":7,"b":8},{"a":9,"b":10,"c":11,"d":12},{"a":13},{}]'
+    );
+    expect(parsed).toEqual([
+        { a: 1, b: 2, c: 3 },
+        { a: 4, c: 5, b: 6 },
+        { a: 7, b: 8 },
+        { a: 9, b: 10, c: 11, d: 12 },
+        { a: 13 },
+        {},
+    ]);
+    expect(Object.keys(parsed[1])).toEqual(["a", "c", "b"]);
+    expect(Object.keys(parsed[3])).toEqual(["a", "b", "c", "d"]);
+});
+
+test("duplicate and numeric keys", () => {
+    const parsed = JSON.parse('[{"a":1,"b":2},{"a":3,"a":4,"b":5},{"a":6,"b":7,"b":8},{"a":9,"0":10,"b":11}]');
+    expect(parsed).toEqual([{ a: 1, b: 2 }, { a: 4, b: 5 }, { a: 6, b: 8 }, { a: 9, 0: 10, b: 11 }]);
+    expect(Object.keys(parsed[3])).toEqual(["0", "a", "b"]);
+});
+
+test("nested objects", () => {
+    const text = '[{"p":{"x":1,"y":2},"q":[{"x":3,"y":4}]},{"p":{"x":5,"y":6},"q":[]}]';
+    expect(JSON.stringify(JSON.parse(text))).toBe(text);
+});
+
+test("parsed objects are ordinary and mutable", () => {
+    const [first, second] = JSON.parse('[{"a":1,"b":2},{"a":3,"b":4}]');
+    second.c = 5;
+    delete second.a;
+    expect(first).toEqual({ a: 1, b: 2 });
+    expect(second).toEqual({ b: 4, c: 5 });
+    expect(Object.getPrototypeOf(second)).toBe(Object.prototype);
+});
@@ -26,3 +26,21 @@ test("basic functionality", () => {
 
     expect(JSON.stringify(o)).toBe('{"0":0,"1":1,"2":2,"key2":"key2","defined":"defined","key4":"key4","key1":"key1"}');
 });
+
+test("toJSON changing the object being serialized", () => {
+    let o = {
+        before: "before",
+        nested: {
+            toJSON() {
+                delete o.removed;
+                o.changed = "new";
+                o.added = "added";
+                return "nested";
+            },
+        },
+        removed: "removed",
+        changed: "old",
+    };
+
+    expect(JSON.stringify(o)).toBe('{"before":"before","nested":"nested","changed":"new"}');
+});
@@ -83,3 +83,39 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
     });
 });
+
+test("delete and insert churn at a power-of-two boundary", () => {
+    // With 2^k - 1 live entries, every delete+insert pair used to rehash the whole table.
+    const liveCount = 4095;
+    const map = new Map();
+    for (let i = 0; i < liveCount; ++i) map.set(i, i);
+
+    for (let i = liveCount; i < liveCount + 200_000; ++i) {
+        expect(map.delete(i - liveCount)).toBeTrue();
+        map.set(i, i);
+    }
+
+    expect(map).toHaveSize(liveCount);
+    expect(map.has(200_000 - 1)).toBeFalse();
+    expect(map.get(200_000)).toBe(200_000);
+    expect(map.keys().next().value).toBe(200_000);
+});
+
+test("shrinking keeps iteration order and active iterators", () => {
+    const map = new Map();
+    for (let i = 0; i < 1000; ++i) map.set(i, i);
+
+    const iterator = map.keys();
+    expect(iterator.next()).toBeIteratorResultWithValue(0);
+
+    for (let i = 0; i < 990; ++i) map.delete(i);
+
+    expect(map).toHaveSize(10);
+    expect(iterator.next()).toBeIteratorResultWithValue(990);
+    expect(Array.from(map.keys())).toEqual([990, 991, 992, 993, 994, 995, 996, 997, 998, 999]);
+
+    map.set("new", 1);
+    for (let i = 991; i < 1000; ++i) expect(iterator.next()).toBeIteratorResultWithValue(i);
+    expect(iterator.next()).toBeIteratorResultWithValue("new");
+    expect(iterator.next()).toBeIteratorResultDone();
+});
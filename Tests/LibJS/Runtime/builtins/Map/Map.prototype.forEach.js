@@ -53,4 +53,43 @@ describe("normal behavior", () => {
             expect(map).toBe(a);
         });
     });
+
+    test("deleting and re-adding entries while iterating", () => {
+        var map = new Map();
+        for (var i = 0; i < 100; ++i) map.set(i, i);
+
+        var seen = [];
+        map.forEach((value, key) => {
+            seen.push(key);
+            if (key < 100) {
+                // Enough churn to force the entry list to be compacted mid-iteration.
+                map.delete(key);
+                map.delete(key + 1);
+                map.set(key + 1000, value);
+            }
+        });
+        expect(seen.length).toBe(100);
+        expect(seen[0]).toBe(0);
+        expect(seen[1]).toBe(2);
+        expect(seen[49]).toBe(98);
+        expect(seen[50]).toBe(1000);
+        expect(seen[99]).toBe(1098);
+        expect(map.size).toBe(50);
+    });
+
+    test("iteration continues with entries added after clear", () => {
+        var map = new Map([
+            ["a", 0],
+            ["b", 1],
+        ]);
+        var seen = [];
+        map.forEach((value, key) => {
+            seen.push(key);
+            if (key === "a") {
+                map.clear();
+                map.set("c", 2);
+            }
+        });
+        expect(seen).toEqual(["a", "c"]);
+    });
 });
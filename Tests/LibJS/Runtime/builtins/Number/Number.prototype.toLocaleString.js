@@ -15,6 +15,43 @@ describe("correct behavior", () => {
     });
 });
 
+describe("repeated calls", () => {
+    test("alternating locales", () => {
+        const locales = ["en", "de", "ar-u-nu-arab", "ja", "hi-u-nu-deva"];
+        const expected = [
+            "1,234.5",
+            "1.234,5",
+            "\u0661\u066c\u0662\u0663\u0664\u066b\u0665",
+            "1,234.5",
+            "\u0967,\u0968\u0969\u096a.\u096b",
+        ];
+
+        for (let i = 0; i < 100; ++i) {
+            const index = i % locales.length;
+            expect((1234.5).toLocaleString(locales[index])).toBe(expected[index]);
+        }
+    });
+
+    test("options are read on every call", () => {
+        let getterCalls = 0;
+        const options = {
+            get maximumFractionDigits() {
+                ++getterCalls;
+                return 1;
+            },
+        };
+
+        expect((1.25).toLocaleString("en", options)).toBe("1.3");
+        expect((1.25).toLocaleString("en", options)).toBe("1.3");
+        expect(getterCalls).toBe(2);
+    });
+
+    test("invalid locales throw on every call", () => {
+        expect(() => (1).toLocaleString("a-")).toThrow(RangeError);
+        expect(() => (1).toLocaleString("a-")).toThrow(RangeError);
+    });
+});
+
 describe("special values", () => {
     test("NaN", () => {
         expect(NaN.toLocaleString()).toBe("NaN");
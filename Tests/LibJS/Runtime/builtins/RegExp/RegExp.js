@@ -944,3 +944,58 @@ test("string properties allowed as set operation operands in negated /v mode cla
         RegExp("[^\\p{Emoji_Keycap_Sequence}]", "v");
     }).toThrowWithMessage(SyntaxError, "RegExp compile error: invalid Unicode property 'Emoji_Keycap_Sequence'");
 });
+
+test("regexes constructed from the same source share nothing observable", () => {
+    for (let i = 0; i < 100; ++i) {
+        const first = new RegExp("(\\w+)@(\\w+)", "g");
+        const second = new RegExp("(\\w+)@(\\w+)", "g");
+        const insensitive = new RegExp("(\\w+)@(\\w+)", "i");
+
+        expect(first.exec("a@b c@d")).toEqual(["a@b", "a", "b"]);
+        expect(first.lastIndex).toBe(3);
+        expect(second.lastIndex).toBe(0);
+        expect(second.exec("x@y")).toEqual(["x@y", "x", "y"]);
+        expect(first.exec("a@b c@d")).toEqual(["c@d", "c", "d"]);
+        expect(insensitive.flags).toBe("i");
+        expect(insensitive.test("A@B")).toBeTrue();
+    }
+
+    for (let i = 0; i < 3; ++i) {
+        expect(() => {
+            RegExp("(");
+        }).toThrowWithMessage(SyntaxError, "RegExp compile error: unexpected end of pattern");
+    }
+});
+
+test("regexes constructed from the same source and flags hit the compiled regex cache", () => {
+    const pattern = "compiled-regexp-cache-[0-9]+";
+
+    let before = getCompiledRegExpCacheStats();
+    RegExp(pattern, "g");
+    let after = getCompiledRegExpCacheStats();
+    expect(after.misses).toBe(before.misses + 1);
+    expect(after.hits).toBe(before.hits);
+
+    before = after;
+    const second = RegExp(pattern, "g");
+    after = getCompiledRegExpCacheStats();
+    expect(after.hits).toBe(before.hits + 1);
+    expect(after.misses).toBe(before.misses);
+    expect(second.exec("compiled-regexp-cache-42")[0]).toBe("compiled-regexp-cache-42");
+
+    before = after;
+    RegExp(pattern, "gi");
+    after = getCompiledRegExpCacheStats();
+    expect(after.misses).toBe(before.misses + 1);
+
+    // Patterns that fail to compile are not cached, so every attempt is a miss.
+    before = after;
+    for (let i = 0; i < 2; ++i) {
+        expect(() => {
+            RegExp("compiled-regexp-cache-(");
+        }).toThrow(SyntaxError);
+    }
+    after = getCompiledRegExpCacheStats();
+    expect(after.misses).toBe(before.misses + 2);
+    expect(after.hits).toBe(before.hits);
+});
@@ -90,3 +90,29 @@ test("detached buffer", () => {
         expect(typedArray[2]).toBeUndefined();
     });
 });
+
+test("default sort orders negative numbers, signed zeros and NaN numerically", () => {
+    const signedArray = new Int32Array([5, -1, 2147483647, -2147483648, 0, -5]);
+    expect(signedArray.sort()).toBe(signedArray);
+    expect(Array.from(signedArray)).toEqual([-2147483648, -5, -1, 0, 5, 2147483647]);
+
+    const floatArray = new Float64Array([NaN, 1.5, -0, 0, -Infinity, Infinity, -1.5, NaN]);
+    floatArray.sort();
+    expect(floatArray[0]).toBe(-Infinity);
+    expect(floatArray[1]).toBe(-1.5);
+    expect(Object.is(floatArray[2], -0)).toBeTrue();
+    expect(Object.is(floatArray[3], 0)).toBeTrue();
+    expect(floatArray[4]).toBe(1.5);
+    expect(floatArray[5]).toBe(Infinity);
+    expect(floatArray[6]).toBeNaN();
+    expect(floatArray[7]).toBeNaN();
+
+    const bigIntArray = new BigInt64Array([3n, -(2n ** 63n), 2n ** 63n - 1n, -3n]);
+    bigIntArray.sort();
+    expect(Array.from(bigIntArray)).toEqual([-(2n ** 63n), -3n, 3n, 2n ** 63n - 1n]);
+
+    const largeArray = new Uint16Array(1000);
+    for (let i = 0; i < largeArray.length; ++i) largeArray[i] = (i * 7919) % 65536;
+    largeArray.sort();
+    for (let i = 1; i < largeArray.length; ++i) expect(largeArray[i - 1] <= largeArray[i]).toBeTrue();
+});
@@ -0,0 +1,101 @@
+test("Add quickened for int32 operands still handles other operands", () => {
+    function add(a, b) {
+        return a + b;
+    }
+
+    for (let i = 0; i < 100; ++i) expect(add(i, 1)).toBe(i + 1);
+
+    expect(add(2147483647, 1)).toBe(2147483648);
+    expect(add(-2147483648, -1)).toBe(-2147483649);
+    expect(add(1.5, 1)).toBe(2.5);
+    expect(add("foo", 1)).toBe("foo1");
+    expect(add(1, { valueOf: () => 41 })).toBe(42);
+    expect(add(1n, 2n)).toBe(3n);
+
+    for (let i = 0; i < 100; ++i) expect(add(i, 1)).toBe(i + 1);
+});
+
+test("Add quickened for int32 operands overflows to a double", () => {
+    function add(a, b) {
+        return a + b;
+    }
+
+    for (let i = 0; i < 100; ++i) add(i, i);
+
+    let sum = 2147483600;
+    for (let i = 0; i < 100; ++i) sum = add(sum, 1);
+    expect(sum).toBe(2147483700);
+});
+
+test("compound Add assignment quickened for int32 operands", () => {
+    let total = 0;
+    for (let i = 0; i < 100; ++i) total += i;
+    expect(total).toBe(4950);
+
+    total += 0.5;
+    expect(total).toBe(4950.5);
+    total += "!";
+    expect(total).toBe("4950.5!");
+});
+
+test("GetByValue quickened for packed arrays still handles other bases", () => {
+    function get(base, index) {
+        return base[index];
+    }
+
+    let packed = [];
+    for (let i = 0; i < 100; ++i) packed.push(i * 2);
+    for (let i = 0; i < 100; ++i) expect(get(packed, i)).toBe(i * 2);
+
+    expect(get(packed, 100)).toBeUndefined();
+    expect(get(packed, -1)).toBeUndefined();
+    expect(get(packed, "length")).toBe(100);
+
+    let holey = [1, , 3];
+    expect(get(holey, 1)).toBeUndefined();
+    expect(get(holey, 2)).toBe(3);
+
+    expect(get(new Int32Array([7, 8, 9]), 1)).toBe(8);
+    expect(get("abc", 2)).toBe("c");
+    expect(get({ 0: "zero" }, 0)).toBe("zero");
+
+    for (let i = 0; i < 100; ++i) expect(get(packed, i)).toBe(i * 2);
+});
+
+test("GetByValue quickened for packed arrays respects getters on the prototype chain", () => {
+    function get(base, index) {
+        return base[index];
+    }
+
+    let packed = [1, 2, 3];
+    for (let i = 0; i < 100; ++i) expect(get(packed, i % 3)).toBe((i % 3) + 1);
+
+    let sparse = [1, 2, 3];
+    sparse.length = 5;
+    Object.defineProperty(Array.prototype, 4, {
+        get() {
+            return "from prototype";
+        },
+        configurable: true,
+    });
+    try {
+        expect(get(sparse, 4)).toBe("from prototype");
+        expect(get(packed, 1)).toBe(2);
+    } finally {
+        delete Array.prototype[4];
+    }
+});
+
+test("GetByValue quickened for packed arrays sees elements change", () => {
+    function get(base, index) {
+        return base[index];
+    }
+
+    let array = [10, 20, 30];
+    for (let i = 0; i < 100; ++i) get(array, 0);
+
+    array[0] = "changed";
+    expect(get(array, 0)).toBe("changed");
+    array.length = 0;
+    expect(get(array, 0)).toBeUndefined();
+});
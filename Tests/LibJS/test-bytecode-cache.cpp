@@ -512,6 +512,120 @@ TEST_CASE(bytecode_cache_materializes_function_executables_lazily)
     EXPECT(!shared_data.m_cached_bytecode_executable);
 }
 
+TEST_CASE(bytecode_cache_records_hot_function_profile)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto source = "function hot() { return 1; }\n"
+                  "function cold() { return 2; }\n"
+                  "hot();"_string;
+    auto test_data = create_bytecode_cache_blob(source);
+
+    auto script_or_error = JS::Script::parse(source, realm, "test.js"sv);
+    VERIFY(!script_or_error.is_error());
+    auto script = script_or_error.release_value();
+    auto result = vm->run(script);
+    VERIFY(!result.is_throw_completion());
+
+    auto hot_function_offsets = script->bytecode_cache_offsets_of_called_functions();
+    EXPECT_EQ(hot_function_offsets.size(), 1u);
+
+    auto profiled_blob = JS::RustIntegration::bytecode_cache_blob_with_hot_function_offsets(test_data.blob.bytes(), hot_function_offsets);
+    VERIFY(!profiled_blob.is_empty());
+
+    auto* decoded_blob = JS::RustIntegration::decode_bytecode_cache_blob(Core::ImmutableBytes::adopt(move(profiled_blob)), JS::RustIntegration::ProgramType::Script, test_data.source_hash.bytes());
+    VERIFY(decoded_blob);
+    ScopeGuard free_decoded_blob = [&] {
+        JS::RustIntegration::free_decoded_bytecode_cache_blob(decoded_blob);
+    };
+    EXPECT_EQ(JS::RustIntegration::bytecode_cache_hot_function_offsets(decoded_blob), hot_function_offsets);
+}
+
+TEST_CASE(bytecode_cache_materializes_predecoded_function_executables)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto test_data = create_bytecode_cache_blob("let f = function lazy() { return 1; }; f();"_string);
+
+    auto* decoded_blob = JS::RustIntegration::decode_bytecode_cache_blob(test_data.blob, JS::RustIntegration::ProgramType::Script, test_data.source_hash.bytes());
+    VERIFY(decoded_blob);
+
+    auto script_or_error = JS::Script::create_from_bytecode_cache(decoded_blob, test_data.source_code, realm);
+    VERIFY(!script_or_error.is_error());
+    auto script = script_or_error.release_value();
+
+    auto* executable = script->cached_executable();
+    VERIFY(executable);
+    VERIFY(!executable->shared_function_data.is_empty());
+    auto& shared_data = *executable->shared_function_data[0];
+    VERIFY(shared_data.m_cached_bytecode_executable);
+
+    auto* cloned_executable = JS::RustIntegration::clone_cached_bytecode_executable(shared_data.m_cached_bytecode_executable);
+    auto* predecoded_executable = JS::RustIntegration::predecode_cached_bytecode_executable(cloned_executable);
+    JS::RustIntegration::free_cached_bytecode_executable(cloned_executable);
+    VERIFY(predecoded_executable);
+
+    auto function_executable = JS::RustIntegration::materialize_predecoded_bytecode_executable(*vm, shared_data, predecoded_executable);
+    VERIFY(function_executable);
+    shared_data.set_executable(function_executable);
+    shared_data.clear_compile_inputs();
+    EXPECT(!shared_data.m_cached_bytecode_executable);
+
+    auto result = vm->run(script);
+    VERIFY(!result.is_throw_completion());
+    EXPECT(shared_data.m_executable == function_executable);
+}
+
+TEST_CASE(bytecode_cache_flushes_cold_function_executables)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto test_data = create_bytecode_cache_blob("var f = function cold() { return 1; }; f();"_string);
+
+    auto* decoded_blob = JS::RustIntegration::decode_bytecode_cache_blob(test_data.blob, JS::RustIntegration::ProgramType::Script, test_data.source_hash.bytes());
+    VERIFY(decoded_blob);
+
+    auto script_or_error = JS::Script::create_from_bytecode_cache(decoded_blob, test_data.source_code, realm);
+    VERIFY(!script_or_error.is_error());
+    auto script = script_or_error.release_value();
+
+    auto* executable = script->cached_executable();
+    VERIFY(executable);
+    VERIFY(!executable->shared_function_data.is_empty());
+    auto& shared_data = *executable->shared_function_data[0];
+
+    auto result = vm->run(script);
+    VERIFY(!result.is_throw_completion());
+    VERIFY(shared_data.m_executable);
+    EXPECT(shared_data.m_retained_cached_bytecode_executable);
+    EXPECT(shared_data.m_bytecode_flush_candidate_list_node.is_in_list());
+
+    // The first collection notices the call, after which the function ages by one for every collection.
+    for (size_t i = 0; i < JS::SharedFunctionInstanceData::bytecode_flush_age_threshold; ++i)
+        vm->heap().collect_garbage();
+    EXPECT(shared_data.m_executable);
+
+    vm->heap().collect_garbage();
+    EXPECT(!shared_data.m_executable);
+    EXPECT(shared_data.m_cached_bytecode_executable);
+    EXPECT(!shared_data.m_retained_cached_bytecode_executable);
+
+    auto call_script_or_error = JS::Script::parse("f();"sv, realm, "call.js"sv);
+    VERIFY(!call_script_or_error.is_error());
+    auto call_result = vm->run(call_script_or_error.release_value());
+    VERIFY(!call_result.is_throw_completion());
+    EXPECT_EQ(call_result.value().as_i32(), 1);
+    EXPECT(shared_data.m_executable);
+    EXPECT(!shared_data.m_cached_bytecode_executable);
+    EXPECT(shared_data.m_retained_cached_bytecode_executable);
+}
+
 TEST_CASE(bytecode_cache_install_shares_template_object_cache_slots)
 {
     auto vm = JS::VM::create();
@@ -891,6 +1005,37 @@ TEST_CASE(bytecode_cache_materializes_from_mapped_blob)
     EXPECT_EQ(result.value().as_string().utf8_string(), "hello"_string);
 }
 
+TEST_CASE(bytecode_cache_uses_source_map_in_place)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto test_data = create_bytecode_cache_blob("let x = 1;\nlet y = x + 1;\ny;"_string);
+
+    auto* decoded_blob = JS::RustIntegration::decode_bytecode_cache_blob(test_data.blob, JS::RustIntegration::ProgramType::Script, test_data.source_hash.bytes());
+    VERIFY(decoded_blob);
+
+    auto script_or_error = JS::Script::create_from_bytecode_cache(decoded_blob, test_data.source_code, realm);
+    VERIFY(!script_or_error.is_error());
+    auto script = script_or_error.release_value();
+
+    auto* executable = script->cached_executable();
+    VERIFY(executable);
+    VERIFY(!executable->source_map.is_empty());
+
+    auto blob = test_data.blob.bytes();
+    auto const* source_map_data = reinterpret_cast<u8 const*>(executable->source_map.span().data());
+    EXPECT(source_map_data >= blob.data());
+    EXPECT(source_map_data + executable->source_map.size() * sizeof(JS::Bytecode::SourceMapEntry) <= blob.data() + blob.size());
+
+    auto const& first_entry = executable->source_map[0];
+    auto source_range = executable->source_range_at(first_entry.bytecode_offset);
+    VERIFY(source_range.has_value());
+    EXPECT_EQ(source_range->start.line, first_entry.line);
+    EXPECT_EQ(source_range->start.column, first_entry.column);
+}
+
 TEST_CASE(fresh_precompiled_function_executables_materialize_lazily)
 {
     auto vm = JS::VM::create();
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/SharedFunctionInstanceData.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static JS::SharedFunctionInstanceData& shared_function_named(JS::Bytecode::Executable& executable, StringView name)
+{
+    for (auto& shared_data : executable.shared_function_data) {
+        if (shared_data && shared_data->m_name == name)
+            return *shared_data;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+TEST_CASE(executable_counts_calls_and_back_edges)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto script_or_error = JS::Script::parse("function callee() { return 1; }\n"
+                                             "for (let i = 0; i < 10; ++i) callee();"sv,
+        realm, "test.js"sv);
+    VERIFY(!script_or_error.is_error());
+    auto script = script_or_error.release_value();
+
+    auto result = vm->run(script);
+    VERIFY(!result.is_throw_completion());
+
+    auto* executable = script->cached_executable();
+    VERIFY(executable);
+    EXPECT(executable->back_edge_count >= 9u);
+
+    auto& callee = shared_function_named(*executable, "callee"sv);
+    VERIFY(callee.m_executable);
+    EXPECT_EQ(callee.m_executable->call_count, 10u);
+    EXPECT_EQ(callee.m_executable->back_edge_count, 0u);
+}
+
+TEST_CASE(sampling_profiler_attributes_samples_to_running_executable)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    // NB: Native functions never poll for samples, so every sample taken while spinning lands on spin()'s back-edge.
+    auto script_or_error = JS::Script::parse("function spin() {\n"
+                                             "    let start = Date.now();\n"
+                                             "    let iterations = 0;\n"
+                                             "    while (Date.now() - start < 50)\n"
+                                             "        ++iterations;\n"
+                                             "    return iterations;\n"
+                                             "}\n"
+                                             "spin();"sv,
+        realm, "test.js"sv);
+    VERIFY(!script_or_error.is_error());
+    auto script = script_or_error.release_value();
+
+    auto& profiler = vm->ensure_sampling_profiler();
+    profiler.start();
+    auto result = vm->run(script);
+    profiler.stop();
+    VERIFY(!result.is_throw_completion());
+    EXPECT(profiler.sample_count() > 0);
+
+    auto profile = profiler.to_cpuprofile();
+    auto const& nodes = profile.get_array("nodes"sv).value();
+
+    u32 total_hit_count = 0;
+    u32 spin_hit_count = 0;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        auto const& node = nodes[i].as_object();
+        auto hit_count = node.get_u32("hitCount"sv).value();
+        total_hit_count += hit_count;
+
+        auto const& call_frame = node.get_object("callFrame"sv).value();
+        if (call_frame.get_string("functionName"sv).value() != "spin"sv)
+            continue;
+        EXPECT_EQ(call_frame.get_string("url"sv).value(), "test.js"sv);
+        spin_hit_count += hit_count;
+    }
+
+    EXPECT_EQ(total_hit_count, profiler.sample_count());
+    EXPECT(spin_hit_count > 0);
+}
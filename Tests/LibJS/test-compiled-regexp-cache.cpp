@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Utf16String.h>
+#include <AK/Utf16View.h>
+#include <LibJS/Runtime/CompiledRegExpCache.h>
+#include <LibTest/TestCase.h>
+
+static size_t footprint_of(Utf16View const& pattern)
+{
+    JS::CompiledRegExpCache cache;
+    MUST(cache.get_or_compile(pattern, 0));
+    return cache.total_footprint();
+}
+
+TEST_CASE(cache_returns_the_same_program_for_the_same_pattern_and_flags)
+{
+    JS::CompiledRegExpCache cache;
+
+    auto first = MUST(cache.get_or_compile(u"a+b"sv, 0));
+    auto second = MUST(cache.get_or_compile(u"a+b"sv, 0));
+    EXPECT_EQ(first.ptr(), second.ptr());
+    EXPECT_EQ(cache.size(), 1u);
+
+    auto with_flags = MUST(cache.get_or_compile(u"a+b"sv, 1));
+    EXPECT_NE(first.ptr(), with_flags.ptr());
+    EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST_CASE(cache_evicts_least_recently_used_entry_over_entry_limit)
+{
+    JS::CompiledRegExpCache cache { 2, JS::CompiledRegExpCache::default_max_total_footprint };
+
+    MUST(cache.get_or_compile(u"a"sv, 0));
+    MUST(cache.get_or_compile(u"b"sv, 0));
+
+    // Looking up "a" makes "b" the least recently used entry.
+    MUST(cache.get_or_compile(u"a"sv, 0));
+    MUST(cache.get_or_compile(u"c"sv, 0));
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT(cache.contains(u"a"sv, 0));
+    EXPECT(!cache.contains(u"b"sv, 0));
+    EXPECT(cache.contains(u"c"sv, 0));
+}
+
+TEST_CASE(cache_evicts_least_recently_used_entries_over_footprint_budget)
+{
+    auto footprint_x = footprint_of(u"x[0-9]+x"sv);
+    auto footprint_y = footprint_of(u"y[0-9]+y"sv);
+    auto footprint_z = footprint_of(u"z[0-9]+z"sv);
+
+    // Room for any two of the three entries, but not for all of them.
+    JS::CompiledRegExpCache cache { JS::CompiledRegExpCache::default_max_entry_count, footprint_x + footprint_y + footprint_z - 1 };
+
+    MUST(cache.get_or_compile(u"x[0-9]+x"sv, 0));
+    MUST(cache.get_or_compile(u"y[0-9]+y"sv, 0));
+    EXPECT_EQ(cache.total_footprint(), footprint_x + footprint_y);
+
+    MUST(cache.get_or_compile(u"z[0-9]+z"sv, 0));
+    EXPECT(!cache.contains(u"x[0-9]+x"sv, 0));
+    EXPECT(cache.contains(u"y[0-9]+y"sv, 0));
+    EXPECT(cache.contains(u"z[0-9]+z"sv, 0));
+    EXPECT_EQ(cache.total_footprint(), footprint_y + footprint_z);
+}
+
+TEST_CASE(cache_charges_memory_allocated_while_matching)
+{
+    JS::CompiledRegExpCache cache;
+
+    auto compiled = MUST(cache.get_or_compile(u"(a)(b)(c)"sv, 0));
+    auto footprint_before_matching = cache.total_footprint();
+
+    (void)compiled->regex().exec(u"xxabcxx"sv, 0);
+    MUST(cache.get_or_compile(u"(a)(b)(c)"sv, 0));
+    EXPECT(cache.total_footprint() > footprint_before_matching);
+}
+
+TEST_CASE(cache_does_not_keep_huge_patterns)
+{
+    JS::CompiledRegExpCache cache;
+
+    auto huge_pattern = Utf16String::repeated('a', 64 * KiB + 1);
+    MUST(cache.get_or_compile(huge_pattern.utf16_view(), 0));
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.total_footprint(), 0u);
+}
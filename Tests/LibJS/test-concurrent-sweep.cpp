@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Root.h>
+#include <LibJS/Runtime/Intrinsics.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibTest/TestCase.h>
+
+using namespace JS;
+
+namespace {
+
+struct TestVM {
+    TestVM()
+        : vm(VM::create())
+        , execution_context(MUST(Realm::initialize_host_defined_realm(*vm, nullptr, nullptr)))
+    {
+    }
+
+    ~TestVM()
+    {
+        vm->pop_execution_context();
+    }
+
+    NonnullRefPtr<VM> vm;
+    NonnullOwnPtr<ExecutionContext> execution_context;
+};
+
+struct BlockCounts {
+    size_t total { 0 };
+    size_t being_swept_concurrently { 0 };
+};
+
+template<typename T>
+BlockCounts count_blocks()
+{
+    BlockCounts counts;
+    T::cell_allocator.allocator->for_each_block([&](GC::HeapBlock& block) {
+        ++counts.total;
+        if (block.is_being_swept_concurrently())
+            ++counts.being_swept_concurrently;
+        return IterationDecision::Continue;
+    });
+    return counts;
+}
+
+}
+
+TEST_CASE(promise_capabilities_are_swept_in_the_background)
+{
+    TestVM test_vm;
+    auto& vm = *test_vm.vm;
+    auto& realm = *vm.current_realm();
+
+    static constexpr size_t live_capability_count = 1000;
+    static constexpr size_t dead_capability_count = 100'000;
+
+    auto template_capability = GC::make_root(MUST(new_promise_capability(vm, realm.intrinsics().promise_constructor())));
+    auto promise = template_capability->promise();
+    auto resolve = template_capability->resolve();
+    auto reject = template_capability->reject();
+
+    Vector<GC::Root<PromiseCapability>> live_capabilities;
+    for (size_t i = 0; i < live_capability_count; ++i)
+        live_capabilities.append(PromiseCapability::create(vm, promise, resolve, reject));
+    for (size_t i = 0; i < dead_capability_count; ++i)
+        (void)PromiseCapability::create(vm, promise, resolve, reject);
+
+    // The collection hands every PromiseCapability block to the background sweeper, while plain objects, whose
+    // destructors may touch global state, stay on the main thread.
+    vm.heap().collect_garbage();
+
+    auto capability_blocks = count_blocks<PromiseCapability>();
+    EXPECT(capability_blocks.total > 0);
+    EXPECT_EQ(capability_blocks.being_swept_concurrently, capability_blocks.total);
+
+    auto object_blocks = count_blocks<Object>();
+    EXPECT(object_blocks.total > 0);
+    EXPECT_EQ(object_blocks.being_swept_concurrently, 0u);
+
+    // The next collection waits for the background sweep before marking, so the survivors must be intact.
+    vm.heap().collect_garbage();
+
+    for (auto const& capability : live_capabilities) {
+        EXPECT_EQ(capability->state(), GC::Cell::State::Live);
+        EXPECT_EQ(capability->promise().ptr(), promise.ptr());
+        EXPECT_EQ(capability->resolve().ptr(), resolve.ptr());
+        EXPECT_EQ(capability->reject().ptr(), reject.ptr());
+    }
+
+    // Swept blocks go back to the allocator, so allocating into them must work.
+    for (size_t i = 0; i < dead_capability_count; ++i)
+        (void)PromiseCapability::create(vm, promise, resolve, reject);
+    vm.heap().collect_garbage();
+}
@@ -9,6 +9,7 @@
 #include <AK/StringView.h>
 #include <LibCore/TimeZone.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/CompiledRegExpCache.h>
 #include <LibJS/Runtime/Date.h>
 #include <LibJS/Runtime/FinalizationRegistry.h>
 #include <LibJS/Runtime/TypedArray.h>
@@ -189,6 +190,17 @@ TESTJS_GLOBAL_FUNCTION(create_default_typed_array, createDefaultTypedArray)
     return TRY(typed_array->create_default(realm, length));
 }
 
+TESTJS_GLOBAL_FUNCTION(get_compiled_regexp_cache_stats, getCompiledRegExpCacheStats)
+{
+    auto& realm = *vm.current_realm();
+    auto& cache = JS::CompiledRegExpCache::the();
+
+    auto stats = JS::Object::create(realm, realm.intrinsics().object_prototype());
+    MUST(stats->create_data_property_or_throw("hits"_utf16_fly_string, JS::Value(cache.hits())));
+    MUST(stats->create_data_property_or_throw("misses"_utf16_fly_string, JS::Value(cache.misses())));
+    return stats;
+}
+
 TESTJS_RUN_FILE_FUNCTION(ByteString const& test_file, JS::Realm& realm, JS::ExecutionContext&)
 {
     if (!test262_parser_tests)
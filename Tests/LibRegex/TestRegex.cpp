@@ -728,3 +728,135 @@ TEST_CASE(restored_long_fork_chain_coverage)
 
     EXPECT_EQ(regex.test(utf16_subject, 0), regex::MatchResult::Match);
 }
+
+TEST_CASE(catastrophic_backtracking_falls_back_to_linear_engine)
+{
+    auto subject = Utf16String::repeated('a', 30000);
+
+    auto regex = compile_regex("(a|aa)*[bc]"sv);
+    EXPECT_EQ(regex.test(subject, 0), regex::MatchResult::NoMatch);
+    EXPECT_EQ(regex.exec(subject, 0), regex::MatchResult::NoMatch);
+    EXPECT_EQ(regex.find_all(subject, 0), 0);
+
+    StringBuilder words;
+    for (size_t i = 0; i < 3000; ++i)
+        words.append("word "sv);
+    EXPECT(matches("^(\\w+\\s?)*$"sv, words.string_view()));
+    words.append('!');
+    EXPECT(!matches("^(\\w+\\s?)*$"sv, words.string_view()));
+}
+
+TEST_CASE(linear_engine_preserves_captures)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 30000; ++i)
+        builder.append('a');
+    builder.append('b');
+    auto subject = Utf16String::from_utf8(builder.string_view());
+
+    auto regex = compile_regex("(a|aa)*[bc]"sv);
+    EXPECT_EQ(regex.exec(subject, 0), regex::MatchResult::Match);
+    EXPECT_EQ(regex.capture_slot(0), 0);
+    EXPECT_EQ(regex.capture_slot(1), 30001);
+    EXPECT_EQ(regex.capture_slot(2), 29999);
+    expect_capture_eq(regex, subject, 1, "a"sv);
+
+    builder.clear();
+    for (size_t i = 0; i < 20000; ++i)
+        builder.append('1');
+    builder.append('y');
+    auto digits = Utf16String::from_utf8(builder.string_view());
+
+    auto sticky_regex = compile_regex("(\\d+)*([x-z])"sv, { .sticky = true });
+    EXPECT_EQ(sticky_regex.exec(digits, 0), regex::MatchResult::Match);
+    EXPECT_EQ(sticky_regex.capture_slot(1), 20001);
+    EXPECT_EQ(sticky_regex.capture_slot(2), 0);
+    EXPECT_EQ(sticky_regex.capture_slot(3), 20000);
+    expect_capture_eq(sticky_regex, digits, 2, "y"sv);
+}
+
+TEST_CASE(literal_alternation_prefilter_finds_matches_past_vector_width)
+{
+    auto regex = compile_regex("<script|<style|href|src|data-id"sv);
+
+    StringBuilder builder;
+    builder.append_repeated("Ā·é "sv, 20);
+    builder.append("<style>"sv);
+    builder.append_repeated("Ā·é "sv, 20);
+    builder.append("data-id"sv);
+    auto subject = Utf16String::from_utf8(builder.string_view());
+
+    EXPECT_EQ(regex.find_all(subject, 0), 2);
+    EXPECT_EQ(regex.find_all_match(0).start, 80);
+    EXPECT_EQ(regex.find_all_match(0).end, 86);
+    EXPECT_EQ(regex.find_all_match(1).start, 167);
+    EXPECT_EQ(regex.find_all_match(1).end, 174);
+
+    auto ignore_case_regex = compile_regex("<script|<style|href|src|data-id"sv, { .ignore_case = true });
+    builder.append(" HREF"sv);
+    auto ignore_case_subject = Utf16String::from_utf8(builder.string_view());
+
+    EXPECT_EQ(ignore_case_regex.find_all(ignore_case_subject, 0), 3);
+    EXPECT_EQ(ignore_case_regex.find_all_match(2).start, 175);
+    EXPECT_EQ(ignore_case_regex.find_all_match(2).end, 179);
+}
+
+TEST_CASE(leading_literal_prefilter_preserves_captures)
+{
+    auto regex = compile_regex("(?:width|height|top|left)=(\\d+)"sv);
+
+    StringBuilder builder;
+    builder.append_repeated("tip=1 lift=2 "sv, 8);
+    builder.append("left=42"sv);
+    auto subject = Utf16String::from_utf8(builder.string_view());
+
+    EXPECT_EQ(regex.exec(subject, 0), regex::MatchResult::Match);
+    EXPECT_EQ(regex.capture_slot(0), 104);
+    EXPECT_EQ(regex.capture_slot(1), 111);
+    expect_capture_eq(regex, subject, 1, "42"sv);
+    EXPECT_EQ(regex.test(u"tip=1 lift=2"sv, 0), regex::MatchResult::NoMatch);
+}
+
+TEST_CASE(ignore_case_first_character_prefilter_includes_case_folded_code_units)
+{
+    StringBuilder builder;
+    builder.append_repeated("abcdefgh"sv, 4);
+    builder.append("\u212A1 \u017F2"sv);
+    auto subject = Utf16String::from_utf8(builder.string_view());
+
+    auto unicode_regex = compile_regex("k\\d|s\\d"sv, { .ignore_case = true, .unicode = true });
+    EXPECT_EQ(unicode_regex.find_all(subject, 0), 2);
+    EXPECT_EQ(unicode_regex.find_all_match(0).start, 32);
+    EXPECT_EQ(unicode_regex.find_all_match(1).start, 35);
+
+    auto kelvin_regex = compile_regex("k\\d"sv, { .ignore_case = true, .unicode = true });
+    EXPECT_EQ(kelvin_regex.exec(subject, 0), regex::MatchResult::Match);
+    EXPECT_EQ(kelvin_regex.capture_slot(0), 32);
+
+    auto legacy_regex = compile_regex("k\\d"sv, { .ignore_case = true });
+    EXPECT_EQ(legacy_regex.test(subject, 0), regex::MatchResult::NoMatch);
+}
+
+TEST_CASE(hot_regex_results_are_stable)
+{
+    auto regex = compile_regex("(\\w+)=(\\d+);"sv);
+    auto ascii_subject = Utf16String::from_utf8("key=value; width=100; flag;"sv);
+    auto utf16_subject = Utf16String::from_utf8("clé=valeur; höhe=200;"sv);
+
+    // Run well past the point where a regex is considered hot, so both the
+    // interpreted and (if enabled) the natively compiled matcher are covered.
+    for (size_t i = 0; i < 5000; ++i) {
+        EXPECT_EQ(regex.exec(ascii_subject, 0), regex::MatchResult::Match);
+        EXPECT_EQ(regex.capture_slot(0), 11);
+        EXPECT_EQ(regex.capture_slot(1), 21);
+        expect_capture_eq(regex, ascii_subject, 1, "width"sv);
+        expect_capture_eq(regex, ascii_subject, 2, "100"sv);
+
+        EXPECT_EQ(regex.exec(utf16_subject, 0), regex::MatchResult::Match);
+        EXPECT_EQ(regex.capture_slot(0), 14);
+        expect_capture_eq(regex, utf16_subject, 1, "he"sv);
+
+        EXPECT_EQ(regex.exec(ascii_subject, 21), regex::MatchResult::NoMatch);
+        EXPECT_EQ(regex.test(u"a=1;"sv, 0), regex::MatchResult::Match);
+    }
+}
@@ -23,6 +23,7 @@
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -194,6 +195,29 @@ static ErrorOr<void> write_to_file(String const& path)
     return {};
 }
 
+static ErrorOr<void> write_cpuprofile(StringView path)
+{
+    auto& profiler = g_vm->ensure_sampling_profiler();
+    profiler.stop();
+
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write, 0666));
+    TRY(file->write_until_depleted(profiler.to_cpuprofile().serialized().bytes()));
+    file->close();
+
+    warnln("Wrote {} samples to {}", profiler.sample_count(), path);
+    return {};
+}
+
+static ErrorOr<void> write_heap_snapshot(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write, 0666));
+    TRY(g_vm->heap().write_heap_snapshot(*file));
+    file->close();
+
+    warnln("Wrote heap snapshot to {}", path);
+    return {};
+}
+
 static ErrorOr<bool> parse_and_run(JS::Realm& realm, StringView source, StringView source_name, bool parse_only = false)
 {
     auto& vm = realm.vm();
@@ -860,6 +884,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool use_test262_global = false;
     bool parse_only = false;
     StringView evaluate_script;
+    StringView profile_path;
+    StringView heap_snapshot_path;
     Vector<StringView> script_paths;
 
     Core::ArgsParser args_parser;
@@ -877,6 +903,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
+    args_parser.add_option(profile_path, "Record a CPU profile and write it to the given .cpuprofile file", "profile", {}, "path");
+    args_parser.add_option(heap_snapshot_path, "Write a heap snapshot to the given .heapsnapshot file after running", "heap-snapshot", {}, "path");
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -962,9 +990,20 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             source_name = "eval"sv;
         }
 
+        if (!profile_path.is_empty())
+            g_vm->ensure_sampling_profiler().start();
+
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only)))
+        auto success = TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only));
+
+        if (!profile_path.is_empty())
+            TRY(write_cpuprofile(profile_path));
+
+        if (!heap_snapshot_path.is_empty())
+            TRY(write_heap_snapshot(heap_snapshot_path));
+
+        if (!success)
             return 1;
     }
 